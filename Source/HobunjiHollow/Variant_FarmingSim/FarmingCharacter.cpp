@@ -8,6 +8,7 @@
 #include "Inventory/InventoryComponent.h"
 #include "Inventory/GearInventoryComponent.h"
 #include "Save/FarmingCharacterSaveGame.h"
+#include "Save/SaveManager.h"
 #include "Data/SpeciesDatabase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Engine/DataTable.h"
@@ -222,6 +223,7 @@ bool AFarmingCharacter::SaveCharacter()
 
 	if (bSuccess)
 	{
+		USaveManager::UpdateCharacterSaveHeader(CharacterSave);
 		UE_LOG(LogTemp, Log, TEXT("Character saved: %s"), *CharacterSave->CharacterName);
 	}
 	else
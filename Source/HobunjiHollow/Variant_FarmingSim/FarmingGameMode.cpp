@@ -5,6 +5,7 @@
 #include "FarmingPlayerState.h"
 #include "FarmingGameState.h"
 #include "Save/FarmingWorldSaveGame.h"
+#include "Save/SaveManager.h"
 #include "Kismet/GameplayStatics.h"
 
 AFarmingGameMode::AFarmingGameMode()
@@ -50,6 +51,7 @@ void AFarmingGameMode::CreateNewWorld(const FString& WorldName)
 
 		if (bSaved)
 		{
+			USaveManager::UpdateWorldSaveHeader(CurrentWorldSave);
 			UE_LOG(LogTemp, Log, TEXT("Created and saved new world: %s"), *WorldName);
 		}
 		else
@@ -129,6 +131,7 @@ bool AFarmingGameMode::SaveWorld()
 
 	if (bSuccess)
 	{
+		USaveManager::UpdateWorldSaveHeader(CurrentWorldSave);
 		UE_LOG(LogTemp, Log, TEXT("World saved: %s"), *CurrentWorldSave->WorldName);
 	}
 	else
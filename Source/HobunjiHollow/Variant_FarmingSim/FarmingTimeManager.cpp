@@ -49,6 +49,8 @@ void AFarmingTimeManager::Tick(float DeltaTime)
 
 void AFarmingTimeManager::UpdateTime(float DeltaTime)
 {
+	TGuardValue<bool> AdvancingClockGuard(bAdvancingClock, true);
+
 	float PreviousTime = CurrentTime;
 
 	// Calculate time advancement
@@ -68,6 +70,8 @@ void AFarmingTimeManager::UpdateTime(float DeltaTime)
 		FarmingGameState->SetCurrentTime(CurrentDay, (int32)CurrentSeason, CurrentYear, CurrentTime);
 	}
 
+	ProcessGameTimers(/*bJump*/ false);
+
 	// Broadcast time change
 	if (FMath::Abs(CurrentTime - PreviousTime) > 0.01f)
 	{
@@ -90,6 +94,8 @@ void AFarmingTimeManager::SetTime(float NewTime)
 		FarmingGameState->SetCurrentTime(CurrentDay, (int32)CurrentSeason, CurrentYear, CurrentTime);
 	}
 
+	ProcessGameTimers(/*bJump*/ true);
+
 	OnTimeChanged.Broadcast(CurrentTime);
 	UE_LOG(LogTemp, Log, TEXT("Time set to: %s"), *GetFormattedTime());
 }
@@ -111,6 +117,12 @@ void AFarmingTimeManager::AdvanceDay()
 		FarmingGameState->SetCurrentTime(CurrentDay, (int32)CurrentSeason, CurrentYear, CurrentTime);
 	}
 
+	// The clock's own midnight rollover is processed by UpdateTime
+	if (!bAdvancingClock)
+	{
+		ProcessGameTimers(/*bJump*/ true);
+	}
+
 	OnDayChanged.Broadcast(CurrentDay);
 	UE_LOG(LogTemp, Log, TEXT("Day advanced to: %s"), *GetFormattedDate());
 }
@@ -136,6 +148,11 @@ void AFarmingTimeManager::AdvanceSeason()
 		FarmingGameState->SetCurrentTime(CurrentDay, (int32)CurrentSeason, CurrentYear, CurrentTime);
 	}
 
+	if (!bAdvancingClock)
+	{
+		ProcessGameTimers(/*bJump*/ true);
+	}
+
 	OnSeasonChanged.Broadcast(CurrentSeason, CurrentYear);
 	UE_LOG(LogTemp, Log, TEXT("Season changed to: %s (Year %d)"), *GetSeasonName(), CurrentYear);
 }
@@ -177,6 +194,15 @@ FString AFarmingTimeManager::GetFormattedDate() const
 	return FString::Printf(TEXT("%s %d, Year %d"), *GetSeasonName(), CurrentDay, CurrentYear);
 }
 
+double AFarmingTimeManager::GetTotalGameHours() const
+{
+	const int64 DaysPerYear = (int64)DaysPerSeason * 4;
+	const int64 ElapsedDays = (int64)(CurrentYear - 1) * DaysPerYear
+		+ (int64)CurrentSeason * DaysPerSeason
+		+ (CurrentDay - 1);
+	return (double)ElapsedDays * 24.0 + CurrentTime;
+}
+
 void AFarmingTimeManager::SaveToWorldSave(UFarmingWorldSaveGame* WorldSave)
 {
 	if (!WorldSave || !HasAuthority())
@@ -214,8 +240,147 @@ void AFarmingTimeManager::RestoreFromSave(UFarmingWorldSaveGame* WorldSave)
 
 	UE_LOG(LogTemp, Log, TEXT("Restored time state: %s %s"), *GetFormattedDate(), *GetFormattedTime());
 
+	ProcessGameTimers(/*bJump*/ true);
+
 	// Broadcast events to update UI
 	OnTimeChanged.Broadcast(CurrentTime);
 	OnDayChanged.Broadcast(CurrentDay);
 	OnSeasonChanged.Broadcast(CurrentSeason, CurrentYear);
 }
+
+// ---- Game-time timers ----
+
+FGameTimerHandle AFarmingTimeManager::SetTimerAtTimeOfDay(float TimeOfDay, FSimpleDelegate Callback, bool bRepeatDaily)
+{
+	EnsureTimerWheelStarted();
+
+	const int64 MinuteOfDay = FMath::Clamp<int64>(FMath::RoundToInt(TimeOfDay * 60.0f), 0, FGameTimerWheel::MinutesPerDay - 1);
+	if (bRepeatDaily)
+	{
+		return TimerWheel.AddRepeating(FGameTimerWheel::MinutesPerDay, MinuteOfDay, MoveTemp(Callback));
+	}
+
+	// Today if still ahead, otherwise tomorrow
+	const int64 Now = TimerWheel.GetCurrentMinute();
+	int64 DueMinute = Now - (Now % FGameTimerWheel::MinutesPerDay) + MinuteOfDay;
+	if (DueMinute <= Now)
+	{
+		DueMinute += FGameTimerWheel::MinutesPerDay;
+	}
+	return TimerWheel.AddOneShot(DueMinute, MoveTemp(Callback));
+}
+
+FGameTimerHandle AFarmingTimeManager::SetTimerEveryHours(float IntervalHours, FSimpleDelegate Callback, bool bAlignToInterval)
+{
+	EnsureTimerWheelStarted();
+
+	const int64 IntervalMinutes = FMath::Max<int64>(FMath::RoundToInt(IntervalHours * 60.0f), 1);
+	const int64 Phase = bAlignToInterval ? 0 : TimerWheel.GetCurrentMinute();
+	return TimerWheel.AddRepeating(IntervalMinutes, Phase, MoveTemp(Callback));
+}
+
+FGameTimerHandle AFarmingTimeManager::SetTimerAtDayStart(FSimpleDelegate Callback, bool bRepeating)
+{
+	return SetTimerAtTimeOfDay(0.0f, MoveTemp(Callback), bRepeating);
+}
+
+FGameTimerHandle AFarmingTimeManager::SetTimerAfterHours(float DelayHours, FSimpleDelegate Callback)
+{
+	EnsureTimerWheelStarted();
+
+	const int64 DelayMinutes = FMath::Max<int64>(FMath::RoundToInt(DelayHours * 60.0f), 1);
+	return TimerWheel.AddOneShot(TimerWheel.GetCurrentMinute() + DelayMinutes, MoveTemp(Callback));
+}
+
+FGameTimerHandle AFarmingTimeManager::K2_SetTimerAtTimeOfDay(float TimeOfDay, FOnGameTimerFired Event, bool bRepeatDaily)
+{
+	// An unbound Blueprint event has no function to call; hand back an invalid handle like K2_SetTimerDelegate
+	if (!Event.IsBound())
+	{
+		return FGameTimerHandle();
+	}
+
+	return SetTimerAtTimeOfDay(TimeOfDay, FSimpleDelegate::CreateUFunction(Event.GetUObject(), Event.GetFunctionName()), bRepeatDaily);
+}
+
+FGameTimerHandle AFarmingTimeManager::K2_SetTimerEveryHours(float IntervalHours, FOnGameTimerFired Event, bool bAlignToInterval)
+{
+	if (!Event.IsBound())
+	{
+		return FGameTimerHandle();
+	}
+
+	return SetTimerEveryHours(IntervalHours, FSimpleDelegate::CreateUFunction(Event.GetUObject(), Event.GetFunctionName()), bAlignToInterval);
+}
+
+FGameTimerHandle AFarmingTimeManager::K2_SetTimerAtDayStart(FOnGameTimerFired Event, bool bRepeating)
+{
+	if (!Event.IsBound())
+	{
+		return FGameTimerHandle();
+	}
+
+	return SetTimerAtDayStart(FSimpleDelegate::CreateUFunction(Event.GetUObject(), Event.GetFunctionName()), bRepeating);
+}
+
+FGameTimerHandle AFarmingTimeManager::K2_SetTimerAfterHours(float DelayHours, FOnGameTimerFired Event)
+{
+	if (!Event.IsBound())
+	{
+		return FGameTimerHandle();
+	}
+
+	return SetTimerAfterHours(DelayHours, FSimpleDelegate::CreateUFunction(Event.GetUObject(), Event.GetFunctionName()));
+}
+
+void AFarmingTimeManager::ClearGameTimer(FGameTimerHandle& Handle)
+{
+	TimerWheel.Remove(Handle);
+}
+
+bool AFarmingTimeManager::IsGameTimerActive(FGameTimerHandle Handle) const
+{
+	return TimerWheel.IsActive(Handle);
+}
+
+float AFarmingTimeManager::GetGameTimerRemainingHours(FGameTimerHandle Handle) const
+{
+	if (!TimerWheel.IsActive(Handle))
+	{
+		return -1.0f;
+	}
+	return (float)((TimerWheel.GetDueMinute(Handle) / 60.0) - GetTotalGameHours());
+}
+
+int64 AFarmingTimeManager::GetCurrentGameMinute() const
+{
+	return FMath::FloorToInt64(GetTotalGameHours() * 60.0);
+}
+
+void AFarmingTimeManager::EnsureTimerWheelStarted()
+{
+	if (!bTimerWheelStarted)
+	{
+		TimerWheel.Reset(GetCurrentGameMinute());
+		bTimerWheelStarted = true;
+	}
+}
+
+void AFarmingTimeManager::ProcessGameTimers(bool bJump)
+{
+	if (!bTimerWheelStarted)
+	{
+		// Nothing scheduled yet; the wheel starts from whatever time the first timer sees
+		return;
+	}
+
+	const int64 NowMinute = GetCurrentGameMinute();
+	if (bJump)
+	{
+		TimerWheel.Jump(NowMinute);
+	}
+	else
+	{
+		TimerWheel.Advance(NowMinute);
+	}
+}
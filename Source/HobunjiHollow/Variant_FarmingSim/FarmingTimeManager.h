@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "GameTimerWheel.h"
 #include "FarmingTimeManager.generated.h"
 
 class UFarmingWorldSaveGame;
@@ -28,7 +29,13 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnDayChanged, int32, NewDay);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSeasonChanged, ESeason, NewSeason, int32, Year);
 
 /**
- * Manages in-game time, day/night cycle, and seasonal progression
+ * Manages in-game time, day/night cycle, and seasonal progression.
+ *
+ * Also runs game-time timers ("at 14:30", "every game hour", "at day start") so systems can
+ * schedule a callback instead of checking CurrentTime every frame. Timers fire where time
+ * advances (server / standalone), at one game minute resolution, in game time: TimeMultiplier
+ * changes don't affect them. SetTime, AdvanceDay/AdvanceSeason outside the normal clock and save
+ * restore are jumps: each overdue timer fires once and repeating ones continue from the new time.
  */
 UCLASS(Blueprintable)
 class HOBUNJIHOLLOW_API AFarmingTimeManager : public AActor
@@ -110,6 +117,56 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Time")
 	FString GetFormattedDate() const;
 
+	/**
+	 * Game hours elapsed since 0:00 on Spring 1, Year 1. Unlike CurrentTime this never wraps,
+	 * so it can order events across midnight and season changes.
+	 */
+	UFUNCTION(BlueprintPure, Category = "Time")
+	double GetTotalGameHours() const;
+
+	// ---- Game-time timers ----
+
+	/** Call Callback at TimeOfDay (0-24), the next time the clock reaches it; daily if bRepeatDaily */
+	FGameTimerHandle SetTimerAtTimeOfDay(float TimeOfDay, FSimpleDelegate Callback, bool bRepeatDaily = false);
+
+	/**
+	 * Call Callback every IntervalHours of game time. Aligned timers fire on multiples of the
+	 * interval (every hour on the hour); otherwise the first call is one interval from now.
+	 */
+	FGameTimerHandle SetTimerEveryHours(float IntervalHours, FSimpleDelegate Callback, bool bAlignToInterval = true);
+
+	/** Call Callback at 0:00 of the next day, and every day after if bRepeating */
+	FGameTimerHandle SetTimerAtDayStart(FSimpleDelegate Callback, bool bRepeating = true);
+
+	/** Call Callback once, DelayHours of game time from now */
+	FGameTimerHandle SetTimerAfterHours(float DelayHours, FSimpleDelegate Callback);
+
+	UFUNCTION(BlueprintCallable, Category = "Time|Timers", meta = (DisplayName = "Set Timer At Time Of Day"))
+	FGameTimerHandle K2_SetTimerAtTimeOfDay(float TimeOfDay, FOnGameTimerFired Event, bool bRepeatDaily = false);
+
+	UFUNCTION(BlueprintCallable, Category = "Time|Timers", meta = (DisplayName = "Set Timer Every Hours"))
+	FGameTimerHandle K2_SetTimerEveryHours(float IntervalHours, FOnGameTimerFired Event, bool bAlignToInterval = true);
+
+	UFUNCTION(BlueprintCallable, Category = "Time|Timers", meta = (DisplayName = "Set Timer At Day Start"))
+	FGameTimerHandle K2_SetTimerAtDayStart(FOnGameTimerFired Event, bool bRepeating = true);
+
+	UFUNCTION(BlueprintCallable, Category = "Time|Timers", meta = (DisplayName = "Set Timer After Hours"))
+	FGameTimerHandle K2_SetTimerAfterHours(float DelayHours, FOnGameTimerFired Event);
+
+	/** Cancel a timer and invalidate its handle */
+	UFUNCTION(BlueprintCallable, Category = "Time|Timers")
+	void ClearGameTimer(UPARAM(ref) FGameTimerHandle& Handle);
+
+	UFUNCTION(BlueprintPure, Category = "Time|Timers")
+	bool IsGameTimerActive(FGameTimerHandle Handle) const;
+
+	/** Game hours until the timer next fires, or -1 if it isn't active */
+	UFUNCTION(BlueprintPure, Category = "Time|Timers")
+	float GetGameTimerRemainingHours(FGameTimerHandle Handle) const;
+
+	UFUNCTION(BlueprintPure, Category = "Time|Timers")
+	int32 GetNumGameTimers() const { return TimerWheel.GetNumTimers(); }
+
 	/** Save time state to world save */
 	void SaveToWorldSave(UFarmingWorldSaveGame* WorldSave);
 
@@ -119,4 +176,21 @@ public:
 protected:
 	/** Update time progression */
 	void UpdateTime(float DeltaTime);
+
+	/** Timers keyed on game minutes since 0:00, Spring 1, Year 1 */
+	FGameTimerWheel TimerWheel;
+
+	bool bTimerWheelStarted = false;
+
+	/** Set while UpdateTime runs, so its midnight AdvanceDay isn't treated as a jump */
+	bool bAdvancingClock = false;
+
+	/** GetTotalGameHours in whole minutes */
+	int64 GetCurrentGameMinute() const;
+
+	/** Start the wheel at the current time the first time it's used */
+	void EnsureTimerWheelStarted();
+
+	/** Fire timers up to the current time, stepping through it or as a jump */
+	void ProcessGameTimers(bool bJump);
 };
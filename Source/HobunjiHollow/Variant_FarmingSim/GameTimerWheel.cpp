@@ -0,0 +1,241 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GameTimerWheel.h"
+
+void FGameTimerWheel::Reset(int64 NowMinute)
+{
+	CurrentMinute = NowMinute;
+
+	for (TPair<uint64, FTimer>& Pair : Timers)
+	{
+		FTimer& Timer = Pair.Value;
+		if (Timer.RepeatMinutes > 0)
+		{
+			Timer.DueMinute = NextOccurrence(Timer, CurrentMinute);
+		}
+		else
+		{
+			Timer.DueMinute = FMath::Max(Timer.DueMinute, CurrentMinute + 1);
+		}
+	}
+
+	RebuildSlots();
+}
+
+FGameTimerHandle FGameTimerWheel::AddOneShot(int64 DueMinute, FSimpleDelegate Callback)
+{
+	FTimer Timer;
+	Timer.Callback = MoveTemp(Callback);
+	Timer.DueMinute = FMath::Max(DueMinute, CurrentMinute + 1);
+	return AddTimer(MoveTemp(Timer));
+}
+
+FGameTimerHandle FGameTimerWheel::AddRepeating(int64 RepeatMinutes, int64 Phase, FSimpleDelegate Callback)
+{
+	FTimer Timer;
+	Timer.Callback = MoveTemp(Callback);
+	Timer.RepeatMinutes = FMath::Max<int64>(RepeatMinutes, 1);
+	Timer.Phase = ((Phase % Timer.RepeatMinutes) + Timer.RepeatMinutes) % Timer.RepeatMinutes;
+	Timer.DueMinute = NextOccurrence(Timer, CurrentMinute);
+	return AddTimer(MoveTemp(Timer));
+}
+
+FGameTimerHandle FGameTimerWheel::AddTimer(FTimer&& Timer)
+{
+	const uint64 Id = NextId++;
+	const int64 DueMinute = Timer.DueMinute;
+	Timers.Add(Id, MoveTemp(Timer));
+	Insert(Id, DueMinute);
+
+	FGameTimerHandle Handle;
+	Handle.Id = Id;
+	return Handle;
+}
+
+void FGameTimerWheel::Remove(FGameTimerHandle& Handle)
+{
+	// Slot entries are dropped lazily when their slot comes up
+	Timers.Remove(Handle.Id);
+	Handle.Invalidate();
+}
+
+bool FGameTimerWheel::IsActive(const FGameTimerHandle& Handle) const
+{
+	return Handle.IsValid() && Timers.Contains(Handle.Id);
+}
+
+int64 FGameTimerWheel::GetDueMinute(const FGameTimerHandle& Handle) const
+{
+	const FTimer* Timer = Timers.Find(Handle.Id);
+	return Timer ? Timer->DueMinute : INDEX_NONE;
+}
+
+void FGameTimerWheel::Advance(int64 NowMinute)
+{
+	// Backwards, or too far to be worth stepping through (a huge TimeMultiplier)
+	if (NowMinute < CurrentMinute || NowMinute - CurrentMinute > MinutesPerDay)
+	{
+		Jump(NowMinute);
+		return;
+	}
+
+	while (CurrentMinute < NowMinute)
+	{
+		++CurrentMinute;
+
+		if (CurrentMinute % MinutesPerHour == 0)
+		{
+			// New day: pull its timers out of the overflow list
+			if (CurrentMinute % MinutesPerDay == 0)
+			{
+				TArray<uint64> Later = MoveTemp(Overflow);
+				Overflow.Reset();
+				for (const uint64 Id : Later)
+				{
+					if (const FTimer* Timer = Timers.Find(Id))
+					{
+						Insert(Id, Timer->DueMinute);
+					}
+				}
+			}
+
+			// New hour: spread its timers over the minute slots
+			TArray<uint64>& HourSlot = HourSlots[(CurrentMinute / MinutesPerHour) % 24];
+			TArray<uint64> ThisHour = MoveTemp(HourSlot);
+			HourSlot.Reset();
+			for (const uint64 Id : ThisHour)
+			{
+				if (const FTimer* Timer = Timers.Find(Id))
+				{
+					Insert(Id, Timer->DueMinute);
+				}
+			}
+		}
+
+		FireSlot(MinuteSlots[CurrentMinute % MinutesPerHour]);
+	}
+}
+
+void FGameTimerWheel::Jump(int64 NowMinute)
+{
+	if (NowMinute == CurrentMinute)
+	{
+		return;
+	}
+
+	// Overdue timers fire once each, in due order
+	TArray<TPair<int64, uint64>> Overdue;
+	if (NowMinute > CurrentMinute)
+	{
+		for (const TPair<uint64, FTimer>& Pair : Timers)
+		{
+			if (Pair.Value.DueMinute <= NowMinute)
+			{
+				Overdue.Emplace(Pair.Value.DueMinute, Pair.Key);
+			}
+		}
+		Overdue.Sort([](const TPair<int64, uint64>& A, const TPair<int64, uint64>& B) { return A.Key < B.Key; });
+	}
+
+	CurrentMinute = NowMinute;
+
+	// Overdue one-shots keep a due minute at or before CurrentMinute, so RebuildSlots skips them
+	for (TPair<uint64, FTimer>& Pair : Timers)
+	{
+		if (Pair.Value.RepeatMinutes > 0)
+		{
+			Pair.Value.DueMinute = NextOccurrence(Pair.Value, CurrentMinute);
+		}
+	}
+	RebuildSlots();
+
+	for (const TPair<int64, uint64>& Entry : Overdue)
+	{
+		// An earlier callback may have cleared it
+		FTimer* Timer = Timers.Find(Entry.Value);
+		if (!Timer)
+		{
+			continue;
+		}
+
+		FSimpleDelegate Callback = Timer->Callback;
+		if (Timer->RepeatMinutes == 0 || !Callback.IsBound())
+		{
+			Timers.Remove(Entry.Value);
+		}
+		Callback.ExecuteIfBound();
+	}
+}
+
+int64 FGameTimerWheel::NextOccurrence(const FTimer& Timer, int64 AfterMinute)
+{
+	const int64 SinceLast = ((AfterMinute - Timer.Phase) % Timer.RepeatMinutes + Timer.RepeatMinutes) % Timer.RepeatMinutes;
+	return AfterMinute - SinceLast + Timer.RepeatMinutes;
+}
+
+void FGameTimerWheel::Insert(uint64 Id, int64 DueMinute)
+{
+	if (DueMinute / MinutesPerHour == CurrentMinute / MinutesPerHour)
+	{
+		MinuteSlots[DueMinute % MinutesPerHour].Add(Id);
+	}
+	else if (DueMinute / MinutesPerDay == CurrentMinute / MinutesPerDay)
+	{
+		HourSlots[(DueMinute / MinutesPerHour) % 24].Add(Id);
+	}
+	else
+	{
+		Overflow.Add(Id);
+	}
+}
+
+void FGameTimerWheel::RebuildSlots()
+{
+	for (TArray<uint64>& Slot : MinuteSlots)
+	{
+		Slot.Reset();
+	}
+	for (TArray<uint64>& Slot : HourSlots)
+	{
+		Slot.Reset();
+	}
+	Overflow.Reset();
+
+	for (const TPair<uint64, FTimer>& Pair : Timers)
+	{
+		if (Pair.Value.DueMinute > CurrentMinute)
+		{
+			Insert(Pair.Key, Pair.Value.DueMinute);
+		}
+	}
+}
+
+void FGameTimerWheel::FireSlot(TArray<uint64>& Slot)
+{
+	// Callbacks may add or clear timers, including into this slot
+	TArray<uint64> Due = MoveTemp(Slot);
+	Slot.Reset();
+
+	for (const uint64 Id : Due)
+	{
+		FTimer* Timer = Timers.Find(Id);
+		if (!Timer || Timer->DueMinute != CurrentMinute)
+		{
+			continue;
+		}
+
+		// Copied: the callback may add timers and reallocate the map
+		FSimpleDelegate Callback = Timer->Callback;
+		if (Timer->RepeatMinutes > 0 && Callback.IsBound())
+		{
+			Timer->DueMinute = NextOccurrence(*Timer, CurrentMinute);
+			Insert(Id, Timer->DueMinute);
+		}
+		else
+		{
+			// One-shot, or its object is gone
+			Timers.Remove(Id);
+		}
+		Callback.ExecuteIfBound();
+	}
+}
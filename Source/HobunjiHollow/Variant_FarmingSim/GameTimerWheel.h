@@ -0,0 +1,117 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameTimerWheel.generated.h"
+
+/** Callback for a game-time timer */
+DECLARE_DYNAMIC_DELEGATE(FOnGameTimerFired);
+
+/**
+ * Handle to a timer scheduled on AFarmingTimeManager's game clock
+ */
+USTRUCT(BlueprintType)
+struct HOBUNJIHOLLOW_API FGameTimerHandle
+{
+	GENERATED_BODY()
+
+	bool IsValid() const { return Id != 0; }
+	void Invalidate() { Id = 0; }
+
+	bool operator==(const FGameTimerHandle& Other) const { return Id == Other.Id; }
+
+private:
+	friend class FGameTimerWheel;
+
+	UPROPERTY(Transient)
+	uint64 Id = 0;
+};
+
+/**
+ * Hierarchical timer wheel keyed on absolute game minutes (minutes since 0:00, Spring 1, Year 1).
+ *
+ * Three levels: a 60-slot wheel for the minutes of the current hour, a 24-slot wheel for the
+ * remaining hours of the current day, and an overflow list for later days that is only
+ * re-bucketed at midnight. Advancing one minute touches a single slot, so the cost follows the
+ * timers that fire rather than the timers that exist.
+ *
+ * A repeating timer fires every RepeatMinutes on minutes congruent to its phase, which makes
+ * "every hour", "at 14:30 daily" and "at day start" all the same kind of timer and lets a jump
+ * re-anchor it to its next occurrence without drift.
+ */
+class HOBUNJIHOLLOW_API FGameTimerWheel
+{
+public:
+	static constexpr int64 MinutesPerHour = 60;
+	static constexpr int64 MinutesPerDay = 24 * 60;
+
+	/** Start counting from NowMinute without firing anything */
+	void Reset(int64 NowMinute);
+
+	/** One-shot timer at DueMinute (moved to the next minute if not after the current one) */
+	FGameTimerHandle AddOneShot(int64 DueMinute, FSimpleDelegate Callback);
+
+	/** Repeating timer firing on every minute M after the current one where M % RepeatMinutes == Phase */
+	FGameTimerHandle AddRepeating(int64 RepeatMinutes, int64 Phase, FSimpleDelegate Callback);
+
+	void Remove(FGameTimerHandle& Handle);
+	bool IsActive(const FGameTimerHandle& Handle) const;
+
+	/** Minute the timer next fires on, or INDEX_NONE */
+	int64 GetDueMinute(const FGameTimerHandle& Handle) const;
+
+	/** Fire everything due up to NowMinute in order, minute by minute (normal clock progression) */
+	void Advance(int64 NowMinute);
+
+	/**
+	 * Move straight to NowMinute (SetTime, skipped days, save restore). Going forward, each
+	 * overdue timer fires once however many occurrences were skipped; going back nothing fires.
+	 * Repeating timers are then re-anchored to their next occurrence after NowMinute.
+	 */
+	void Jump(int64 NowMinute);
+
+	int64 GetCurrentMinute() const { return CurrentMinute; }
+	int32 GetNumTimers() const { return Timers.Num(); }
+
+private:
+	struct FTimer
+	{
+		FSimpleDelegate Callback;
+		int64 DueMinute = 0;
+
+		/** 0 for one-shot timers */
+		int64 RepeatMinutes = 0;
+		int64 Phase = 0;
+	};
+
+	/** First minute after AfterMinute on the timer's repeat schedule */
+	static int64 NextOccurrence(const FTimer& Timer, int64 AfterMinute);
+
+	FGameTimerHandle AddTimer(FTimer&& Timer);
+
+	/** Put a timer into the slot for its due minute (which must be after CurrentMinute) */
+	void Insert(uint64 Id, int64 DueMinute);
+
+	/** Clear every slot and re-insert all timers */
+	void RebuildSlots();
+
+	/** Fire the timers in one minute slot, rescheduling repeating ones */
+	void FireSlot(TArray<uint64>& Slot);
+
+	TMap<uint64, FTimer> Timers;
+
+	/** Minutes of the current hour */
+	TArray<uint64> MinuteSlots[60];
+
+	/** Hours of the current day after the current one */
+	TArray<uint64> HourSlots[24];
+
+	/** Due on a later day */
+	TArray<uint64> Overflow;
+
+	/** Last minute processed; everything due at or before it has fired */
+	int64 CurrentMinute = 0;
+
+	uint64 NextId = 1;
+};
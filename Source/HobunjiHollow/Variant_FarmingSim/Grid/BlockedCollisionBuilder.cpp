@@ -0,0 +1,110 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "BlockedCollisionBuilder.h"
+
+void FBlockedCollisionBuilder::BuildChunkRects(const TBitArray<>& Blocked, TConstArrayView<float> ChunkHeights, int32 GridWidth, int32 GridHeight,
+	const FIntPoint& Chunk, float MaxHeightDelta, TArray<FBlockedCollisionRect>& OutRects)
+{
+	const int32 MinX = Chunk.X * ChunkSize;
+	const int32 MinY = Chunk.Y * ChunkSize;
+	const int32 SizeX = FMath::Min(ChunkSize, GridWidth - MinX);
+	const int32 SizeY = FMath::Min(ChunkSize, GridHeight - MinY);
+	if (SizeX <= 0 || SizeY <= 0 || !ensure(ChunkHeights.Num() >= TilesPerChunk))
+	{
+		return;
+	}
+
+	// Local copy of the chunk's blocked tiles; claimed tiles are cleared as rectangles are emitted
+	bool Open[ChunkSize * ChunkSize];
+	for (int32 LocalY = 0; LocalY < SizeY; ++LocalY)
+	{
+		for (int32 LocalX = 0; LocalX < SizeX; ++LocalX)
+		{
+			Open[LocalY * ChunkSize + LocalX] = Blocked[(MinY + LocalY) * GridWidth + MinX + LocalX];
+		}
+	}
+
+	auto HeightAt = [&](int32 LocalX, int32 LocalY)
+	{
+		return ChunkHeights[LocalY * ChunkSize + LocalX];
+	};
+
+	for (int32 StartY = 0; StartY < SizeY; ++StartY)
+	{
+		for (int32 StartX = 0; StartX < SizeX; ++StartX)
+		{
+			if (!Open[StartY * ChunkSize + StartX])
+			{
+				continue;
+			}
+
+			float MinZ = HeightAt(StartX, StartY);
+			float MaxZ = MinZ;
+
+			// Grow right along the first row
+			int32 RectWidth = 1;
+			while (StartX + RectWidth < SizeX && Open[StartY * ChunkSize + StartX + RectWidth])
+			{
+				const float Z = HeightAt(StartX + RectWidth, StartY);
+				if (FMath::Max(MaxZ, Z) - FMath::Min(MinZ, Z) > MaxHeightDelta)
+				{
+					break;
+				}
+				MinZ = FMath::Min(MinZ, Z);
+				MaxZ = FMath::Max(MaxZ, Z);
+				++RectWidth;
+			}
+
+			// Grow down while the whole next row fits
+			int32 RectHeight = 1;
+			while (StartY + RectHeight < SizeY)
+			{
+				const int32 RowY = StartY + RectHeight;
+				float RowMinZ = MinZ;
+				float RowMaxZ = MaxZ;
+				bool bRowFits = true;
+				for (int32 X = StartX; X < StartX + RectWidth; ++X)
+				{
+					if (!Open[RowY * ChunkSize + X])
+					{
+						bRowFits = false;
+						break;
+					}
+
+					const float Z = HeightAt(X, RowY);
+					RowMinZ = FMath::Min(RowMinZ, Z);
+					RowMaxZ = FMath::Max(RowMaxZ, Z);
+					if (RowMaxZ - RowMinZ > MaxHeightDelta)
+					{
+						bRowFits = false;
+						break;
+					}
+				}
+
+				if (!bRowFits)
+				{
+					break;
+				}
+				MinZ = RowMinZ;
+				MaxZ = RowMaxZ;
+				++RectHeight;
+			}
+
+			for (int32 Y = StartY; Y < StartY + RectHeight; ++Y)
+			{
+				for (int32 X = StartX; X < StartX + RectWidth; ++X)
+				{
+					Open[Y * ChunkSize + X] = false;
+				}
+			}
+
+			FBlockedCollisionRect& Rect = OutRects.AddDefaulted_GetRef();
+			Rect.X = MinX + StartX;
+			Rect.Y = MinY + StartY;
+			Rect.Width = RectWidth;
+			Rect.Height = RectHeight;
+			Rect.MinZ = MinZ;
+			Rect.MaxZ = MaxZ;
+		}
+	}
+}
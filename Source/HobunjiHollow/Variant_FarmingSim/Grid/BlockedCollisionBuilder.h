@@ -0,0 +1,47 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * A run of blocked tiles covered by one collision box.
+ * Tile coordinates are grid-space; heights are the terrain range under the rectangle.
+ */
+struct FBlockedCollisionRect
+{
+	int32 X = 0;
+	int32 Y = 0;
+	int32 Width = 1;
+	int32 Height = 1;
+	float MinZ = 0.0f;
+	float MaxZ = 0.0f;
+};
+
+/**
+ * Greedy rectangle merging for blocked-tile collision.
+ *
+ * The grid is split into fixed chunks so a terrain edit only rebuilds the chunk it lands in.
+ * Inside a chunk, each unclaimed blocked tile (row-major) grows right as far as it can, then
+ * grows down one full row at a time. A tile joins a rectangle only while the terrain height
+ * range of the rectangle stays within MaxHeightDelta, so slopes split into several boxes
+ * rather than one box floating above (or sunk into) part of the terrain.
+ */
+class HOBUNJIHOLLOW_API FBlockedCollisionBuilder
+{
+public:
+	/** Chunk edge length in tiles */
+	static constexpr int32 ChunkSize = 16;
+	static constexpr int32 TilesPerChunk = ChunkSize * ChunkSize;
+
+	static FIntPoint GetChunkForTile(int32 X, int32 Y) { return FIntPoint(X / ChunkSize, Y / ChunkSize); }
+
+	/**
+	 * Merge the blocked tiles of one chunk.
+	 * Blocked is grid-wide, row-major (GridWidth * GridHeight). ChunkHeights covers just this
+	 * chunk, row-major with a stride of ChunkSize (TilesPerChunk entries), and only needs valid
+	 * values for its blocked tiles.
+	 */
+	static void BuildChunkRects(const TBitArray<>& Blocked, TConstArrayView<float> ChunkHeights, int32 GridWidth, int32 GridHeight,
+		const FIntPoint& Chunk, float MaxHeightDelta, TArray<FBlockedCollisionRect>& OutRects);
+};
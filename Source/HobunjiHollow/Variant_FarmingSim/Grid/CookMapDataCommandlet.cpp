@@ -0,0 +1,65 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CookMapDataCommandlet.h"
+#include "MapDataCookedFile.h"
+#include "MapDataStreamReader.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+UCookMapDataCommandlet::UCookMapDataCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UCookMapDataCommandlet::Main(const FString& Params)
+{
+	FString RelativeDir = TEXT("Maps/Data");
+	FParse::Value(*Params, TEXT("Path="), RelativeDir);
+	const bool bForce = FParse::Param(*Params, TEXT("Force"));
+
+	const FString Directory = FPaths::Combine(FPaths::ProjectContentDir(), RelativeDir);
+	TArray<FString> JsonFiles;
+	IFileManager::Get().FindFiles(JsonFiles, *FPaths::Combine(Directory, TEXT("*.json")), true, false);
+
+	int32 NumCooked = 0;
+	int32 NumSkipped = 0;
+	int32 NumFailed = 0;
+	for (const FString& FileName : JsonFiles)
+	{
+		const FString JsonPath = FPaths::Combine(Directory, FileName);
+		const FString CookedPath = FMapDataCookedFile::GetCookedPath(JsonPath);
+		if (!bForce && FMapDataCookedFile::IsUpToDate(JsonPath, CookedPath))
+		{
+			++NumSkipped;
+			continue;
+		}
+
+		FString JsonString;
+		FMapData MapData;
+		FString Error;
+		if (!FFileHelper::LoadFileToString(JsonString, *JsonPath) || !FMapDataStreamReader::ReadFromString(JsonString, MapData, Error))
+		{
+			UE_LOG(LogTemp, Error, TEXT("CookMapData: Failed to parse %s: %s"), *JsonPath, *Error);
+			++NumFailed;
+			continue;
+		}
+
+		if (!FMapDataCookedFile::Write(MapData, CookedPath))
+		{
+			UE_LOG(LogTemp, Error, TEXT("CookMapData: Failed to write %s"), *CookedPath);
+			++NumFailed;
+			continue;
+		}
+
+		UE_LOG(LogTemp, Display, TEXT("CookMapData: %s (%lld -> %lld bytes)"),
+			*FileName, IFileManager::Get().FileSize(*JsonPath), IFileManager::Get().FileSize(*CookedPath));
+		++NumCooked;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("CookMapData: %d cooked, %d up to date, %d failed in %s"), NumCooked, NumSkipped, NumFailed, *Directory);
+	return NumFailed > 0 ? 1 : 0;
+}
@@ -0,0 +1,24 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "CookMapDataCommandlet.generated.h"
+
+/**
+ * Cooks every map JSON under a Content-relative directory into its .mapbin.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=CookMapData [-Path=Maps/Data] [-Force]
+ * Up-to-date cooked files are skipped unless -Force is given.
+ */
+UCLASS()
+class HOBUNJIHOLLOW_API UCookMapDataCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UCookMapDataCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,275 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CropSimulation.h"
+#include "Async/ParallelFor.h"
+
+uint32 FCropGrowthRules::MakeSeasonMask(const TArray<int32>& Seasons)
+{
+	uint32 Mask = 0;
+	for (int32 Season : Seasons)
+	{
+		if (Season >= 0 && Season < 32)
+		{
+			Mask |= 1u << Season;
+		}
+	}
+	return Mask;
+}
+
+FCropGrowthRules FCropGrowthRules::FromCrop(const AGridPlaceableCrop& Crop)
+{
+	FCropGrowthRules Rules;
+	Rules.DaysToMature = Crop.DaysToMature;
+	Rules.bDiesWithoutWater = Crop.bDiesWithoutWater;
+	Rules.ValidSeasonMask = MakeSeasonMask(Crop.ValidSeasons);
+	return Rules;
+}
+
+FCropDayState FCropDayState::FromCrop(const AGridPlaceableCrop& Crop)
+{
+	FCropDayState State;
+	State.DaysGrown = Crop.DaysGrown;
+	State.Stage = Crop.GrowthStage;
+	State.bWateredToday = Crop.bWateredToday;
+	State.TotalDaysWatered = Crop.TotalDaysWatered;
+	return State;
+}
+
+ECropGrowthStage FCropSimulation::GetStageForProgress(int32 InDaysGrown, int32 InDaysToMature, ECropGrowthStage CurrentStage)
+{
+	// Integer form of DaysGrown / DaysToMature against 1, 0.75 and 0.5
+	if (InDaysGrown >= InDaysToMature)
+	{
+		return ECropGrowthStage::Harvestable;
+	}
+	if (InDaysGrown * 4 >= InDaysToMature * 3)
+	{
+		return ECropGrowthStage::Mature;
+	}
+	if (InDaysGrown * 2 >= InDaysToMature)
+	{
+		return ECropGrowthStage::Growing;
+	}
+	if (InDaysGrown > 0)
+	{
+		return ECropGrowthStage::Sprout;
+	}
+	return CurrentStage;
+}
+
+void FCropSimulation::AdvanceCropDay(FCropDayState& State, const FCropGrowthRules& Rules, int32 Season)
+{
+	const ECropGrowthStage Stage = State.Stage;
+
+	// Dies from lack of water (seeds don't need it)
+	if (Rules.bDiesWithoutWater && !State.bWateredToday && Stage != ECropGrowthStage::Dead && Stage != ECropGrowthStage::Seed)
+	{
+		State.Stage = ECropGrowthStage::Dead;
+		State.bWateredToday = false;
+		return;
+	}
+
+	// Growing in the wrong season
+	const bool bValidSeason = Rules.ValidSeasonMask == 0 || (Season >= 0 && Season < 32 && (Rules.ValidSeasonMask & (1u << Season)) != 0);
+	if (!bValidSeason)
+	{
+		State.Stage = ECropGrowthStage::Dead;
+		State.bWateredToday = false;
+		return;
+	}
+
+	// Only grow if watered (or seed stage doesn't require water)
+	if ((State.bWateredToday || Stage == ECropGrowthStage::Seed) && Stage != ECropGrowthStage::Harvestable && Stage != ECropGrowthStage::Dead)
+	{
+		++State.DaysGrown;
+		State.Stage = GetStageForProgress(State.DaysGrown, Rules.DaysToMature, Stage);
+	}
+
+	// Reset watered status for new day
+	State.bWateredToday = false;
+}
+
+int32 FCropSimulation::Add(FName CropTypeId, const FIntPoint& Tile, const FCropGrowthRules& Rules, const FCropDayState& State, AGridPlaceableCrop* View)
+{
+	const int32 Index = Stages.Num();
+
+	DaysGrown.Add(State.DaysGrown);
+	DaysToMature.Add(Rules.DaysToMature);
+	Stages.Add(State.Stage);
+	Flags.Add(static_cast<uint8>((State.bWateredToday ? Flag_WateredToday : 0) | (Rules.bDiesWithoutWater ? Flag_DiesWithoutWater : 0)));
+	SeasonMasks.Add(Rules.ValidSeasonMask);
+	TotalDaysWatered.Add(State.TotalDaysWatered);
+	CropTypeIds.Add(CropTypeId);
+	Tiles.Add(Tile);
+	Views.Add(View);
+
+	if (View)
+	{
+		ViewIndices.Add(View, Index);
+	}
+	return Index;
+}
+
+int32 FCropSimulation::AddView(AGridPlaceableCrop* View)
+{
+	check(View);
+	return Add(View->CropTypeId, FIntPoint(View->GridPosition.X, View->GridPosition.Y),
+		FCropGrowthRules::FromCrop(*View), FCropDayState::FromCrop(*View), View);
+}
+
+void FCropSimulation::PushView(int32 Index, const AGridPlaceableCrop& View)
+{
+	SetRules(Index, FCropGrowthRules::FromCrop(View));
+	SetState(Index, FCropDayState::FromCrop(View));
+	CropTypeIds[Index] = View.CropTypeId;
+	Tiles[Index] = FIntPoint(View.GridPosition.X, View.GridPosition.Y);
+}
+
+void FCropSimulation::PullView(int32 Index, AGridPlaceableCrop& View) const
+{
+	const FCropDayState State = GetState(Index);
+	View.DaysGrown = State.DaysGrown;
+	View.GrowthStage = State.Stage;
+	View.bWateredToday = State.bWateredToday;
+	View.TotalDaysWatered = State.TotalDaysWatered;
+}
+
+void FCropSimulation::RemoveAt(int32 Index)
+{
+	if (!Stages.IsValidIndex(Index))
+	{
+		return;
+	}
+
+	if (AGridPlaceableCrop* View = Views[Index].Get())
+	{
+		ViewIndices.Remove(View);
+	}
+
+	DaysGrown.RemoveAtSwap(Index);
+	DaysToMature.RemoveAtSwap(Index);
+	Stages.RemoveAtSwap(Index);
+	Flags.RemoveAtSwap(Index);
+	SeasonMasks.RemoveAtSwap(Index);
+	TotalDaysWatered.RemoveAtSwap(Index);
+	CropTypeIds.RemoveAtSwap(Index);
+	Tiles.RemoveAtSwap(Index);
+	Views.RemoveAtSwap(Index);
+
+	// The former last crop now lives at Index
+	if (Views.IsValidIndex(Index))
+	{
+		if (AGridPlaceableCrop* Moved = Views[Index].Get())
+		{
+			ViewIndices.Add(Moved, Index);
+		}
+	}
+}
+
+void FCropSimulation::Remove(const AGridPlaceableCrop* View)
+{
+	RemoveAt(Find(View));
+}
+
+void FCropSimulation::Reset()
+{
+	DaysGrown.Reset();
+	DaysToMature.Reset();
+	Stages.Reset();
+	Flags.Reset();
+	SeasonMasks.Reset();
+	TotalDaysWatered.Reset();
+	CropTypeIds.Reset();
+	Tiles.Reset();
+	Views.Reset();
+	ViewIndices.Reset();
+}
+
+int32 FCropSimulation::Find(const AGridPlaceableCrop* View) const
+{
+	if (!View)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32* Index = ViewIndices.Find(View);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void FCropSimulation::AdvanceDay(int32 Season, TArray<FCropStageChange>& OutChanges)
+{
+	const int32 NumCrops = Stages.Num();
+	const int32 NumChunks = FMath::DivideAndRoundUp(NumCrops, ChunkSize);
+
+	// Each chunk records its own stage changes, concatenated afterwards to keep index order
+	TArray<TArray<FCropStageChange>> ChunkChanges;
+	ChunkChanges.SetNum(NumChunks);
+
+	ParallelFor(NumChunks, [this, Season, NumCrops, &ChunkChanges](int32 Chunk)
+	{
+		const int32 Begin = Chunk * ChunkSize;
+		const int32 End = FMath::Min(Begin + ChunkSize, NumCrops);
+		TArray<FCropStageChange>& Changes = ChunkChanges[Chunk];
+
+		for (int32 Index = Begin; Index < End; ++Index)
+		{
+			FCropGrowthRules Rules;
+			Rules.DaysToMature = DaysToMature[Index];
+			Rules.bDiesWithoutWater = (Flags[Index] & Flag_DiesWithoutWater) != 0;
+			Rules.ValidSeasonMask = SeasonMasks[Index];
+
+			FCropDayState State;
+			State.DaysGrown = DaysGrown[Index];
+			State.Stage = Stages[Index];
+			State.bWateredToday = (Flags[Index] & Flag_WateredToday) != 0;
+
+			AdvanceCropDay(State, Rules, Season);
+
+			DaysGrown[Index] = State.DaysGrown;
+			Flags[Index] &= static_cast<uint8>(~Flag_WateredToday);
+			if (State.Stage != Stages[Index])
+			{
+				Changes.Add({ Index, Stages[Index] });
+				Stages[Index] = State.Stage;
+			}
+		}
+	});
+
+	for (TArray<FCropStageChange>& Changes : ChunkChanges)
+	{
+		OutChanges.Append(Changes);
+	}
+}
+
+FCropDayState FCropSimulation::GetState(int32 Index) const
+{
+	FCropDayState State;
+	State.DaysGrown = DaysGrown[Index];
+	State.Stage = Stages[Index];
+	State.bWateredToday = (Flags[Index] & Flag_WateredToday) != 0;
+	State.TotalDaysWatered = TotalDaysWatered[Index];
+	return State;
+}
+
+void FCropSimulation::SetState(int32 Index, const FCropDayState& State)
+{
+	DaysGrown[Index] = State.DaysGrown;
+	Stages[Index] = State.Stage;
+	Flags[Index] = static_cast<uint8>(State.bWateredToday ? (Flags[Index] | Flag_WateredToday) : (Flags[Index] & ~Flag_WateredToday));
+	TotalDaysWatered[Index] = State.TotalDaysWatered;
+}
+
+void FCropSimulation::SetRules(int32 Index, const FCropGrowthRules& Rules)
+{
+	DaysToMature[Index] = Rules.DaysToMature;
+	SeasonMasks[Index] = Rules.ValidSeasonMask;
+	Flags[Index] = static_cast<uint8>(Rules.bDiesWithoutWater ? (Flags[Index] | Flag_DiesWithoutWater) : (Flags[Index] & ~Flag_DiesWithoutWater));
+}
+
+SIZE_T FCropSimulation::GetAllocatedSize() const
+{
+	return DaysGrown.GetAllocatedSize() + DaysToMature.GetAllocatedSize() + Stages.GetAllocatedSize()
+		+ Flags.GetAllocatedSize() + SeasonMasks.GetAllocatedSize() + TotalDaysWatered.GetAllocatedSize()
+		+ CropTypeIds.GetAllocatedSize() + Tiles.GetAllocatedSize() + Views.GetAllocatedSize()
+		+ ViewIndices.GetAllocatedSize();
+}
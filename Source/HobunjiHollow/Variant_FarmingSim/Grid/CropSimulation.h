@@ -0,0 +1,128 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GridPlaceableCrop.h"
+#include "UObject/ObjectKey.h"
+
+/** Per-crop growth rules, fixed once the crop is planted */
+struct FCropGrowthRules
+{
+	int32 DaysToMature = 4;
+	bool bDiesWithoutWater = false;
+
+	/** Bit N set = season N is valid; 0 = every season */
+	uint32 ValidSeasonMask = 0;
+
+	/** Seasons outside 0-31 can't be represented and are dropped */
+	static uint32 MakeSeasonMask(const TArray<int32>& Seasons);
+
+	static FCropGrowthRules FromCrop(const AGridPlaceableCrop& Crop);
+};
+
+/** Crop state that changes from day to day */
+struct FCropDayState
+{
+	int32 DaysGrown = 0;
+	ECropGrowthStage Stage = ECropGrowthStage::Seed;
+	bool bWateredToday = false;
+	int32 TotalDaysWatered = 0;
+
+	static FCropDayState FromCrop(const AGridPlaceableCrop& Crop);
+};
+
+/** A crop whose growth stage changed during FCropSimulation::AdvanceDay */
+struct FCropStageChange
+{
+	int32 Index = INDEX_NONE;
+	ECropGrowthStage OldStage = ECropGrowthStage::Seed;
+};
+
+/**
+ * Structure-of-arrays store for every planted crop in a world, owned by UFarmGridManager.
+ *
+ * The store is authoritative for crop state. AGridPlaceableCrop actors are views: they
+ * register on BeginPlay, read their state back before acting on it and push it after
+ * changing it, and are only touched by a day advance when their growth stage changes.
+ * Views are optional, so the store can also hold crops with no actor.
+ *
+ * AdvanceDay runs AdvanceCropDay, the single copy of the growth rules, over contiguous
+ * arrays in parallel chunks. Removal swaps the last crop into the freed slot.
+ */
+class HOBUNJIHOLLOW_API FCropSimulation
+{
+public:
+	/** One crop's day transition: water/season death, growth, then the watered flag resets */
+	static void AdvanceCropDay(FCropDayState& State, const FCropGrowthRules& Rules, int32 Season);
+
+	/** Growth stage for a number of days grown (before dying or being harvestable is considered) */
+	static ECropGrowthStage GetStageForProgress(int32 DaysGrown, int32 DaysToMature, ECropGrowthStage CurrentStage);
+
+	/** Add a crop, returns its index. View may be null. */
+	int32 Add(FName CropTypeId, const FIntPoint& Tile, const FCropGrowthRules& Rules, const FCropDayState& State, AGridPlaceableCrop* View = nullptr);
+
+	/** Register a crop actor as the view of a new crop, seeded from its properties */
+	int32 AddView(AGridPlaceableCrop* View);
+
+	/** Copy a view's rules, state, type and tile into its crop */
+	void PushView(int32 Index, const AGridPlaceableCrop& View);
+
+	/** Copy a crop's state into its view's properties */
+	void PullView(int32 Index, AGridPlaceableCrop& View) const;
+
+	/** Remove the crop at Index (the last crop takes its index) */
+	void RemoveAt(int32 Index);
+
+	/** Remove a view's crop, if registered */
+	void Remove(const AGridPlaceableCrop* View);
+
+	void Reset();
+
+	/** Index of a view's crop, or INDEX_NONE */
+	int32 Find(const AGridPlaceableCrop* View) const;
+
+	int32 Num() const { return Stages.Num(); }
+
+	/** Advance every crop one day; crops whose stage changed are appended to OutChanges in index order */
+	void AdvanceDay(int32 Season, TArray<FCropStageChange>& OutChanges);
+
+	FCropDayState GetState(int32 Index) const;
+	void SetState(int32 Index, const FCropDayState& State);
+	void SetRules(int32 Index, const FCropGrowthRules& Rules);
+
+	FName GetCropTypeId(int32 Index) const { return CropTypeIds[Index]; }
+	void SetCropTypeId(int32 Index, FName CropTypeId) { CropTypeIds[Index] = CropTypeId; }
+
+	const FIntPoint& GetTile(int32 Index) const { return Tiles[Index]; }
+	void SetTile(int32 Index, const FIntPoint& Tile) { Tiles[Index] = Tile; }
+
+	AGridPlaceableCrop* GetView(int32 Index) const { return Views[Index].Get(); }
+
+	/** Approximate heap memory used by the arrays */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	/** Crops per ParallelFor task */
+	static constexpr int32 ChunkSize = 4096;
+
+	// Hot data read by AdvanceDay
+	TArray<int32> DaysGrown;
+	TArray<int32> DaysToMature;
+	TArray<ECropGrowthStage> Stages;
+	TArray<uint8> Flags;
+	TArray<uint32> SeasonMasks;
+
+	// Cold data
+	TArray<int32> TotalDaysWatered;
+	TArray<FName> CropTypeIds;
+	TArray<FIntPoint> Tiles;
+	TArray<TWeakObjectPtr<AGridPlaceableCrop>> Views;
+	TMap<TObjectKey<AGridPlaceableCrop>, int32> ViewIndices;
+
+	enum EFlags : uint8
+	{
+		Flag_WateredToday = 1 << 0,
+		Flag_DiesWithoutWater = 1 << 1,
+	};
+};
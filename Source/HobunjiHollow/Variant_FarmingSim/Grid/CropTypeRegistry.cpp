@@ -0,0 +1,157 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CropTypeRegistry.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+const FCropTypeDefinition* UCropTypeRegistry::FindDefinition(FName CropTypeId) const
+{
+	BuildCacheIfNeeded();
+
+	const int32* Found = TypeLookupCache.Find(CropTypeId);
+	return Found && CropTypes.IsValidIndex(*Found) ? &CropTypes[*Found] : nullptr;
+}
+
+TSubclassOf<AGridPlaceableCrop> UCropTypeRegistry::GetCropClass(FName CropTypeId) const
+{
+	const FCropTypeDefinition* Definition = FindDefinition(CropTypeId);
+	if (!Definition || Definition->CropClass.IsNull())
+	{
+		return nullptr;
+	}
+	if (UClass* Loaded = Definition->CropClass.Get())
+	{
+		return Loaded;
+	}
+	return Definition->CropClass.LoadSynchronous();
+}
+
+void UCropTypeRegistry::GetUnloadedAssetPaths(const TArray<FName>& CropTypeIds, TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const FName& CropTypeId : CropTypeIds)
+	{
+		const FCropTypeDefinition* Definition = FindDefinition(CropTypeId);
+		if (!Definition)
+		{
+			continue;
+		}
+
+		if (!Definition->CropClass.IsNull() && !Definition->CropClass.IsValid())
+		{
+			OutPaths.AddUnique(Definition->CropClass.ToSoftObjectPath());
+		}
+		for (const TPair<ECropGrowthStage, TSoftObjectPtr<UStaticMesh>>& StageMesh : Definition->StageMeshes)
+		{
+			if (!StageMesh.Value.IsNull() && !StageMesh.Value.IsValid())
+			{
+				OutPaths.AddUnique(StageMesh.Value.ToSoftObjectPath());
+			}
+		}
+	}
+}
+
+void UCropTypeRegistry::ApplyDefinition(const FCropTypeDefinition& Definition, AGridPlaceableCrop& Crop)
+{
+	Crop.CropTypeId = Definition.CropTypeId;
+	if (!Definition.DisplayName.IsEmpty())
+	{
+		Crop.DisplayName = Definition.DisplayName;
+	}
+
+	for (const TPair<ECropGrowthStage, TSoftObjectPtr<UStaticMesh>>& StageMesh : Definition.StageMeshes)
+	{
+		// GetMeshComponentForStage falls back to the mature mesh for an empty harvestable one
+		UStaticMeshComponent* Component = StageMesh.Key == ECropGrowthStage::Harvestable
+			? Crop.HarvestableMeshComponent
+			: Crop.GetMeshComponentForStage(StageMesh.Key);
+		if (!Component || StageMesh.Value.IsNull())
+		{
+			continue;
+		}
+
+		UStaticMesh* Mesh = StageMesh.Value.Get();
+		Component->SetStaticMesh(Mesh ? Mesh : StageMesh.Value.LoadSynchronous());
+	}
+
+	if (Definition.bOverrideGrowth)
+	{
+		Crop.DaysToMature = Definition.DaysToMature;
+		Crop.bDiesWithoutWater = Definition.bDiesWithoutWater;
+		Crop.ValidSeasons = Definition.ValidSeasons;
+		Crop.HarvestItemId = Definition.HarvestItemId;
+		Crop.MinHarvestAmount = Definition.MinHarvestAmount;
+		Crop.MaxHarvestAmount = Definition.MaxHarvestAmount;
+		Crop.bRegrowsAfterHarvest = Definition.bRegrowsAfterHarvest;
+		Crop.DaysToRegrow = Definition.DaysToRegrow;
+	}
+}
+
+#if WITH_EDITOR
+EDataValidationResult UCropTypeRegistry::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+
+	TSet<FName> SeenIds;
+
+	for (int32 i = 0; i < CropTypes.Num(); ++i)
+	{
+		const FCropTypeDefinition& Definition = CropTypes[i];
+
+		if (Definition.CropTypeId.IsNone())
+		{
+			Context.AddError(FText::FromString(FString::Printf(TEXT("Entry %d has no CropTypeId"), i)));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		if (Definition.CropClass.IsNull())
+		{
+			Context.AddWarning(FText::FromString(FString::Printf(TEXT("Crop type '%s' has no CropClass assigned"), *Definition.CropTypeId.ToString())));
+		}
+
+		if (Definition.bOverrideGrowth && Definition.MinHarvestAmount > Definition.MaxHarvestAmount)
+		{
+			Context.AddWarning(FText::FromString(FString::Printf(TEXT("Crop type '%s' has MinHarvestAmount above MaxHarvestAmount"), *Definition.CropTypeId.ToString())));
+		}
+
+		if (SeenIds.Contains(Definition.CropTypeId))
+		{
+			Context.AddError(FText::FromString(FString::Printf(TEXT("Duplicate CropTypeId '%s'"), *Definition.CropTypeId.ToString())));
+			Result = EDataValidationResult::Invalid;
+		}
+		SeenIds.Add(Definition.CropTypeId);
+	}
+
+	return Result;
+}
+
+void UCropTypeRegistry::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	bCacheBuilt = false;
+}
+#endif
+
+void UCropTypeRegistry::BuildCacheIfNeeded() const
+{
+	if (bCacheBuilt)
+	{
+		return;
+	}
+
+	TypeLookupCache.Empty(CropTypes.Num());
+
+	for (int32 Index = 0; Index < CropTypes.Num(); ++Index)
+	{
+		const FName CropTypeId = CropTypes[Index].CropTypeId;
+		if (!CropTypeId.IsNone())
+		{
+			TypeLookupCache.Add(CropTypeId, Index);
+		}
+	}
+
+	bCacheBuilt = true;
+}
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GridPlaceableCrop.h"
+#include "CropTypeRegistry.generated.h"
+
+class UStaticMesh;
+
+/**
+ * Everything needed to spawn a crop of one type: its actor class, plus optional stage meshes
+ * and growth parameters that override the class defaults. Lets one generic crop Blueprint
+ * serve many crop types.
+ */
+USTRUCT(BlueprintType)
+struct HOBUNJIHOLLOW_API FCropTypeDefinition
+{
+	GENERATED_BODY()
+
+	/** Matches AGridPlaceableCrop::CropTypeId and FPlacedCropSave::CropTypeId */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type")
+	FName CropTypeId;
+
+	/** Crop actor class to spawn (loaded on demand; preloaded before a restore spawns it) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type")
+	TSoftClassPtr<AGridPlaceableCrop> CropClass;
+
+	/** Replaces the class's display name when not empty */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type")
+	FText DisplayName;
+
+	/** Replaces the class's mesh for these stages; stages left out keep the class mesh */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Meshes")
+	TMap<ECropGrowthStage, TSoftObjectPtr<UStaticMesh>> StageMeshes;
+
+	/** Use the growth and harvest parameters below instead of the class defaults */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth")
+	bool bOverrideGrowth = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth", meta = (EditCondition = "bOverrideGrowth", ClampMin = "1"))
+	int32 DaysToMature = 4;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth", meta = (EditCondition = "bOverrideGrowth"))
+	bool bDiesWithoutWater = false;
+
+	/** Seasons this crop can grow in (empty = all seasons) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth", meta = (EditCondition = "bOverrideGrowth"))
+	TArray<int32> ValidSeasons;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth", meta = (EditCondition = "bOverrideGrowth"))
+	FName HarvestItemId;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth", meta = (EditCondition = "bOverrideGrowth", ClampMin = "1"))
+	int32 MinHarvestAmount = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth", meta = (EditCondition = "bOverrideGrowth", ClampMin = "1"))
+	int32 MaxHarvestAmount = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth", meta = (EditCondition = "bOverrideGrowth"))
+	bool bRegrowsAfterHarvest = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Type|Growth", meta = (EditCondition = "bOverrideGrowth && bRegrowsAfterHarvest", ClampMin = "1"))
+	int32 DaysToRegrow = 3;
+};
+
+/**
+ * Data asset mapping crop type IDs to crop definitions.
+ * Assign one to the grid manager (UFarmGridManager::SetCropTypeRegistry) so restored crops
+ * spawn as their saved type rather than a single default class.
+ */
+UCLASS(BlueprintType)
+class HOBUNJIHOLLOW_API UCropTypeRegistry : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop Types", meta = (TitleProperty = "CropTypeId"))
+	TArray<FCropTypeDefinition> CropTypes;
+
+	/** Definition for a crop type, or nullptr if it isn't registered */
+	const FCropTypeDefinition* FindDefinition(FName CropTypeId) const;
+
+	UFUNCTION(BlueprintPure, Category = "Crop Types")
+	bool HasCropType(FName CropTypeId) const { return FindDefinition(CropTypeId) != nullptr; }
+
+	/**
+	 * Crop class for a type, or null if the type isn't registered or has no class.
+	 * Loads the class synchronously if nothing preloaded it.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Crop Types")
+	TSubclassOf<AGridPlaceableCrop> GetCropClass(FName CropTypeId) const;
+
+	/**
+	 * Classes and stage meshes for the given types that still need loading. Feed these to an
+	 * async load ahead of spawning so neither has to load synchronously.
+	 */
+	void GetUnloadedAssetPaths(const TArray<FName>& CropTypeIds, TArray<FSoftObjectPath>& OutPaths) const;
+
+	/**
+	 * Apply a definition's type ID, display name, stage meshes and growth overrides to a crop.
+	 * Call before the crop's BeginPlay (e.g. on a deferred spawn) so it registers with the
+	 * crop simulation using the overridden rules.
+	 */
+	static void ApplyDefinition(const FCropTypeDefinition& Definition, AGridPlaceableCrop& Crop);
+
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	/** Cached lookup from type ID to index in CropTypes, built on first query */
+	mutable TMap<FName, int32> TypeLookupCache;
+	mutable bool bCacheBuilt = false;
+
+	void BuildCacheIfNeeded() const;
+};
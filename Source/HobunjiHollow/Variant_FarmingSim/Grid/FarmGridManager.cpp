@@ -3,19 +3,30 @@
 #include "FarmGridManager.h"
 #include "GridFootprintComponent.h"
 #include "GridPlaceableCrop.h"
+#include "GridTileRenderer.h"
+#include "CropTypeRegistry.h"
+#include "GridActorPool.h"
 #include "Save/FarmingWorldSaveGame.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "DrawDebugHelpers.h"
 #include "Kismet/GameplayStatics.h"
-#include "EngineUtils.h"
+#include "HAL/PlatformTime.h"
 
 void UFarmGridManager::Initialize(FSubsystemCollectionBase& Collection)
 {
 	Super::Initialize(Collection);
+
+	// Levels without map data still use the default config
+	Cells.Initialize(GridConfig.Width, GridConfig.Height, DefaultTerrainType);
 }
 
 void UFarmGridManager::Deinitialize()
 {
+	CancelCropRestore();
+	CropPreloadHandles.Empty();
 	ClearGrid();
+	CropSimulation.Reset();
 	Super::Deinitialize();
 }
 
@@ -29,6 +40,8 @@ void UFarmGridManager::InitializeGrid(const FGridConfig& Config)
 {
 	ClearGrid();
 	GridConfig = Config;
+	Cells.Initialize(GridConfig.Width, GridConfig.Height, DefaultTerrainType);
+	HeightCache.Initialize(GridConfig.Width, GridConfig.Height, bCacheTerrainNormals);
 }
 
 void UFarmGridManager::InitializeFromMapData(const FMapData& MapData)
@@ -42,9 +55,10 @@ void UFarmGridManager::InitializeFromMapData(const FMapData& MapData)
 	GridConfig.OriginOffset = MapData.Grid.OriginOffset;
 
 	// Parse default terrain
-	FMapTerrainTile DefaultTile;
-	DefaultTile.Type = MapData.DefaultTerrain;
-	DefaultTerrainType = DefaultTile.GetTerrainType();
+	DefaultTerrainType = FMapTerrainTile::ParseTerrainType(MapData.DefaultTerrain);
+
+	Cells.Initialize(GridConfig.Width, GridConfig.Height, DefaultTerrainType);
+	HeightCache.Initialize(GridConfig.Width, GridConfig.Height, bCacheTerrainNormals);
 
 	// Load terrain data
 	for (const FMapTerrainTile& Tile : MapData.Terrain)
@@ -52,27 +66,33 @@ void UFarmGridManager::InitializeFromMapData(const FMapData& MapData)
 		FGridCoordinate Coord = Tile.GetGridCoordinate();
 		if (IsValidCoordinate(Coord))
 		{
-			FGridCell& Cell = GetOrCreateCell(Coord);
-			Cell.TerrainType = Tile.GetTerrainType();
+			Cells.SetTerrain(Coord.X, Coord.Y, Tile.GetTerrainType());
+
+			const TMap<FString, FString>* Properties = MapData.GetTerrainProperties(Tile);
+			if (!Properties)
+			{
+				continue;
+			}
 
 			// Check for tilled property
-			const FString* TilledValue = Tile.Properties.Find(TEXT("tilled"));
+			const FString* TilledValue = Properties->Find(TEXT("tilled"));
 			if (TilledValue && (*TilledValue == TEXT("true") || *TilledValue == TEXT("1")))
 			{
-				Cell.bIsTilled = true;
+				Cells.SetTilled(Coord.X, Coord.Y, true);
 			}
 
 			// Check for watered property
-			const FString* WateredValue = Tile.Properties.Find(TEXT("watered"));
+			const FString* WateredValue = Properties->Find(TEXT("watered"));
 			if (WateredValue && (*WateredValue == TEXT("true") || *WateredValue == TEXT("1")))
 			{
-				Cell.bIsWatered = true;
+				Cells.SetWatered(Coord.X, Coord.Y, true);
 			}
 		}
 	}
 
-	// Store zones
+	// Store zones and bake them into the per-tile lookup
 	Zones = MapData.Zones;
+	ZoneIndex.Build(Zones, GridConfig.Width, GridConfig.Height);
 
 	// Store connections
 	Connections = MapData.Connections;
@@ -80,18 +100,149 @@ void UFarmGridManager::InitializeFromMapData(const FMapData& MapData)
 	// Store paths
 	Paths = MapData.Paths;
 
-	// Store roads
+	// Store roads and compile the routing graph
 	Roads = MapData.Roads;
+	RoadGraph.Build(Roads);
 
 	// Store spawners
 	Spawners = MapData.Spawners;
 }
 
+namespace FarmGridManagerPrivate
+{
+	static constexpr uint8 TilledBit = 1 << 6;
+	static constexpr uint8 WateredBit = 1 << 7;
+
+	static bool IsPropertyTrue(const TMap<FString, FString>& Properties, const TCHAR* Key)
+	{
+		const FString* Value = Properties.Find(Key);
+		return Value && (*Value == TEXT("true") || *Value == TEXT("1"));
+	}
+
+	/** One byte per tile: terrain type in the low bits plus tilled/watered flags, as InitializeFromMapData would apply them */
+	static void BakeTileDefinitions(const FMapData& MapData, TArray<uint8>& OutTiles)
+	{
+		const int32 Width = FMath::Max(0, MapData.Grid.Width);
+		const int32 Height = FMath::Max(0, MapData.Grid.Height);
+		OutTiles.Init(static_cast<uint8>(FMapTerrainTile::ParseTerrainType(MapData.DefaultTerrain)), Width * Height);
+
+		for (const FMapTerrainTile& Tile : MapData.Terrain)
+		{
+			if (Tile.X < 0 || Tile.Y < 0 || Tile.X >= Width || Tile.Y >= Height)
+			{
+				continue;
+			}
+
+			uint8& Definition = OutTiles[Tile.Y * Width + Tile.X];
+			Definition = static_cast<uint8>((Definition & (TilledBit | WateredBit)) | static_cast<uint8>(Tile.Type));
+			if (const TMap<FString, FString>* Properties = MapData.GetTerrainProperties(Tile))
+			{
+				if (IsPropertyTrue(*Properties, TEXT("tilled")))
+				{
+					Definition |= TilledBit;
+				}
+				if (IsPropertyTrue(*Properties, TEXT("watered")))
+				{
+					Definition |= WateredBit;
+				}
+			}
+		}
+	}
+}
+
+bool UFarmGridManager::ApplyMapDataChanges(const FMapData& OldData, const FMapData& NewData, TArray<FIntPoint>& OutChangedTiles)
+{
+	using namespace FarmGridManagerPrivate;
+
+	OutChangedTiles.Reset();
+
+	const bool bSameLayout = OldData.Grid.Width == NewData.Grid.Width
+		&& OldData.Grid.Height == NewData.Grid.Height
+		&& OldData.Grid.CellSize == NewData.Grid.CellSize
+		&& OldData.Grid.OriginOffset.Equals(NewData.Grid.OriginOffset)
+		&& OldData.DefaultTerrain == NewData.DefaultTerrain
+		&& OldData.Grid.Width == GridConfig.Width
+		&& OldData.Grid.Height == GridConfig.Height;
+	if (!bSameLayout)
+	{
+		return false;
+	}
+
+	// Terrain: compare what each tile resolves to, not the tile lists, so reordering is free
+	TArray<uint8> OldTiles;
+	TArray<uint8> NewTiles;
+	BakeTileDefinitions(OldData, OldTiles);
+	BakeTileDefinitions(NewData, NewTiles);
+
+	const int32 Width = GridConfig.Width;
+	for (int32 Index = 0; Index < NewTiles.Num(); ++Index)
+	{
+		const uint8 OldDefinition = OldTiles[Index];
+		const uint8 NewDefinition = NewTiles[Index];
+		if (OldDefinition == NewDefinition)
+		{
+			continue;
+		}
+
+		const int32 X = Index % Width;
+		const int32 Y = Index / Width;
+		const uint8 TypeMask = static_cast<uint8>(~(TilledBit | WateredBit));
+		if ((OldDefinition & TypeMask) != (NewDefinition & TypeMask))
+		{
+			Cells.SetTerrain(X, Y, static_cast<ETerrainType>(NewDefinition & TypeMask));
+			Pathfinder.MarkTileDirty(X, Y);
+		}
+		if ((OldDefinition & TilledBit) != (NewDefinition & TilledBit))
+		{
+			Cells.SetTilled(X, Y, (NewDefinition & TilledBit) != 0);
+		}
+		if ((OldDefinition & WateredBit) != (NewDefinition & WateredBit))
+		{
+			Cells.SetWatered(X, Y, (NewDefinition & WateredBit) != 0);
+		}
+		OutChangedTiles.Emplace(X, Y);
+	}
+
+	// Zones feed the per-tile lookup and the pathfinder's zone costs
+	if (!AreMapStructArraysEqual(Zones, NewData.Zones))
+	{
+		Zones = NewData.Zones;
+		ZoneIndex.Build(Zones, GridConfig.Width, GridConfig.Height);
+		Pathfinder.Reset();
+	}
+
+	if (!AreMapStructArraysEqual(Roads, NewData.Roads))
+	{
+		Roads = NewData.Roads;
+		RoadGraph.Build(Roads);
+	}
+
+	if (!AreMapStructArraysEqual(Connections, NewData.Connections))
+	{
+		Connections = NewData.Connections;
+	}
+
+	if (!AreMapStructArraysEqual(Paths, NewData.Paths))
+	{
+		Paths = NewData.Paths;
+	}
+
+	if (!AreMapStructArraysEqual(Spawners, NewData.Spawners))
+	{
+		Spawners = NewData.Spawners;
+	}
+
+	return true;
+}
+
 void UFarmGridManager::SetGridTransform(const FVector& Offset, float Scale, float RotationDegrees)
 {
 	GridWorldOffset = Offset;
 	GridScaleFactor = FMath::Max(0.1f, Scale);
 	GridRotationDegrees = RotationDegrees;
+
+	// Tile centres moved, so every cached height is stale
+	HeightCache.InvalidateAll();
 }
 
 void UFarmGridManager::GetGridTransform(FVector& OutOffset, float& OutScale, float& OutRotation) const
@@ -103,13 +254,21 @@ void UFarmGridManager::GetGridTransform(FVector& OutOffset, float& OutScale, flo
 
 void UFarmGridManager::ClearGrid()
 {
-	GridCells.Empty();
+	HeightCache.Reset();
+	OccupantIndex.Empty();
+	InteractableOccupants.Empty();
 	Zones.Empty();
+	ZoneIndex.Reset();
+	Pathfinder.Reset();
 	Connections.Empty();
 	Paths.Empty();
 	Roads.Empty();
+	RoadGraph.Reset();
 	Spawners.Empty();
 	DefaultTerrainType = ETerrainType::Default;
+
+	// Keep the store sized to the config so cells can still be written before the next initialize
+	Cells.Initialize(GridConfig.Width, GridConfig.Height, DefaultTerrainType);
 }
 
 FGridCoordinate UFarmGridManager::WorldToGrid(const FVector& WorldPosition) const
@@ -191,10 +350,42 @@ FVector2D UFarmGridManager::ReverseGridTransform(float X, float Y) const
 FVector UFarmGridManager::GridToWorldWithHeight(const FGridCoordinate& GridPos) const
 {
 	FVector WorldPos = GridToWorld(GridPos);
+
+	// Tile centres are exactly the cached samples
+	if (bUseHeightCache && HeightCache.IsInBounds(GridPos.X, GridPos.Y))
+	{
+		EnsureHeightSampled(GridPos.X, GridPos.Y);
+		WorldPos.Z = HeightCache.GetHeight(GridPos.X, GridPos.Y);
+		return WorldPos;
+	}
+
 	WorldPos.Z = SampleHeightAtWorldPosition(WorldPos.X, WorldPos.Y);
 	return WorldPos;
 }
 
+bool UFarmGridManager::WorldToGridContinuous(float WorldX, float WorldY, float& OutGridX, float& OutGridY) const
+{
+	const float ScaledCellSize = GridConfig.CellSize * GridScaleFactor;
+	if (ScaledCellSize <= KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	// Undo GridToWorld: world offset, then rotation about the origin offset, then scale
+	float LocalX = WorldX - GridWorldOffset.X - GridConfig.OriginOffset.X;
+	float LocalY = WorldY - GridWorldOffset.Y - GridConfig.OriginOffset.Y;
+	if (!FMath::IsNearlyZero(GridRotationDegrees))
+	{
+		const FVector2D Reversed = ReverseGridTransform(LocalX, LocalY);
+		LocalX = Reversed.X;
+		LocalY = Reversed.Y;
+	}
+
+	OutGridX = LocalX / ScaledCellSize - 0.5f;
+	OutGridY = LocalY / ScaledCellSize - 0.5f;
+	return true;
+}
+
 bool UFarmGridManager::IsValidCoordinate(const FGridCoordinate& Coord) const
 {
 	return UGridFunctionLibrary::IsInBounds(Coord, GridConfig.Width, GridConfig.Height);
@@ -202,8 +393,7 @@ bool UFarmGridManager::IsValidCoordinate(const FGridCoordinate& Coord) const
 
 bool UFarmGridManager::IsTileOccupied(const FGridCoordinate& Coord) const
 {
-	const FGridCell* Cell = GridCells.Find(Coord);
-	return Cell && Cell->IsOccupied();
+	return Cells.GetOccupant(Coord.X, Coord.Y) != nullptr;
 }
 
 bool UFarmGridManager::IsTileWalkable(const FGridCoordinate& Coord) const
@@ -213,14 +403,13 @@ bool UFarmGridManager::IsTileWalkable(const FGridCoordinate& Coord) const
 		return false;
 	}
 
-	const FGridCell* Cell = GridCells.Find(Coord);
-	if (Cell)
+	const ETerrainType Terrain = Cells.GetTerrain(Coord.X, Coord.Y);
+	if (Terrain == ETerrainType::Blocked || Terrain == ETerrainType::Water)
 	{
-		return Cell->IsWalkable();
+		return false;
 	}
 
-	// Use default terrain type
-	return DefaultTerrainType != ETerrainType::Blocked && DefaultTerrainType != ETerrainType::Water;
+	return Cells.GetOccupant(Coord.X, Coord.Y) == nullptr;
 }
 
 bool UFarmGridManager::IsTileFarmable(const FGridCoordinate& Coord) const
@@ -230,71 +419,43 @@ bool UFarmGridManager::IsTileFarmable(const FGridCoordinate& Coord) const
 		return false;
 	}
 
-	const FGridCell* Cell = GridCells.Find(Coord);
-	if (Cell)
-	{
-		return Cell->IsFarmable();
-	}
-
-	return DefaultTerrainType == ETerrainType::Tillable;
+	return Cells.GetTerrain(Coord.X, Coord.Y) == ETerrainType::Tillable || Cells.IsTilled(Coord.X, Coord.Y);
 }
 
 ETerrainType UFarmGridManager::GetTerrainType(const FGridCoordinate& Coord) const
 {
-	const FGridCell* Cell = GridCells.Find(Coord);
-	return Cell ? Cell->TerrainType : DefaultTerrainType;
+	return Cells.GetTerrain(Coord.X, Coord.Y);
 }
 
 AActor* UFarmGridManager::GetObjectAtTile(const FGridCoordinate& Coord) const
 {
-	const FGridCell* Cell = GridCells.Find(Coord);
-	return Cell ? Cell->OccupyingActor.Get() : nullptr;
+	return Cells.GetOccupant(Coord.X, Coord.Y);
 }
 
 FGridCell UFarmGridManager::GetCellData(const FGridCoordinate& Coord) const
 {
-	const FGridCell* Cell = GridCells.Find(Coord);
-	if (Cell)
-	{
-		return *Cell;
-	}
-
-	// Return default cell
-	FGridCell DefaultCell;
-	DefaultCell.TerrainType = DefaultTerrainType;
-	return DefaultCell;
+	return Cells.GetCell(Coord.X, Coord.Y);
 }
 
 void UFarmGridManager::SetTerrainType(const FGridCoordinate& Coord, ETerrainType TerrainType)
 {
-	if (IsValidCoordinate(Coord))
-	{
-		GetOrCreateCell(Coord).TerrainType = TerrainType;
-	}
+	Cells.SetTerrain(Coord.X, Coord.Y, TerrainType);
+	Pathfinder.MarkTileDirty(Coord.X, Coord.Y);
 }
 
 void UFarmGridManager::SetTileTilled(const FGridCoordinate& Coord, bool bTilled)
 {
-	if (IsValidCoordinate(Coord))
-	{
-		GetOrCreateCell(Coord).bIsTilled = bTilled;
-	}
+	Cells.SetTilled(Coord.X, Coord.Y, bTilled);
 }
 
 void UFarmGridManager::SetTileWatered(const FGridCoordinate& Coord, bool bWatered)
 {
-	if (IsValidCoordinate(Coord))
-	{
-		GetOrCreateCell(Coord).bIsWatered = bWatered;
-	}
+	Cells.SetWatered(Coord.X, Coord.Y, bWatered);
 }
 
 void UFarmGridManager::ClearAllWateredTiles()
 {
-	for (auto& Pair : GridCells)
-	{
-		Pair.Value.bIsWatered = false;
-	}
+	Cells.ClearAllWatered();
 }
 
 EPlacementResult UFarmGridManager::CanPlaceObject(const FGridCoordinate& Coord, int32 Width, int32 Height, bool bRequiresFarmland) const
@@ -349,13 +510,29 @@ bool UFarmGridManager::PlaceObject(AActor* Object, const FGridCoordinate& Coord,
 		return false;
 	}
 
+	// Placing an actor that is already on the grid moves it: release its old cells first
+	RemoveObjectByActor(Object);
+
+	const TObjectKey<AActor> Key(Object);
+	FGridOccupantRecord& Record = OccupantIndex.Add(Key);
+	Record.Actor = Object;
+	Record.Anchor = Coord;
+	Record.Cells.Reserve(Width * Height);
+
+	const UGridFootprintComponent* Footprint = Object->FindComponentByClass<UGridFootprintComponent>();
+	if (Footprint && Footprint->InteractionPoints.Num() > 0)
+	{
+		InteractableOccupants.Add(Key);
+	}
+
 	// Mark all cells as occupied
 	for (int32 DX = 0; DX < Width; ++DX)
 	{
 		for (int32 DY = 0; DY < Height; ++DY)
 		{
-			FGridCoordinate CellCoord(Coord.X + DX, Coord.Y + DY, Coord.Z);
-			GetOrCreateCell(CellCoord).OccupyingActor = Object;
+			Cells.SetOccupant(Coord.X + DX, Coord.Y + DY, Object);
+			Record.Cells.Add(FIntPoint(Coord.X + DX, Coord.Y + DY));
+			Pathfinder.MarkTileDirty(Coord.X + DX, Coord.Y + DY);
 		}
 	}
 
@@ -364,13 +541,22 @@ bool UFarmGridManager::PlaceObject(AActor* Object, const FGridCoordinate& Coord,
 
 bool UFarmGridManager::RemoveObject(const FGridCoordinate& Coord)
 {
-	FGridCell* Cell = GridCells.Find(Coord);
-	if (Cell && Cell->OccupyingActor.IsValid())
+	if (AActor* Occupant = Cells.GetOccupant(Coord.X, Coord.Y))
 	{
-		Cell->OccupyingActor.Reset();
-		return true;
+		const TObjectKey<AActor> Key(Occupant);
+		if (FGridOccupantRecord* Record = OccupantIndex.Find(Key))
+		{
+			Record->Cells.RemoveSingleSwap(FIntPoint(Coord.X, Coord.Y));
+			if (Record->Cells.Num() == 0)
+			{
+				OccupantIndex.Remove(Key);
+				InteractableOccupants.Remove(Key);
+			}
+		}
 	}
-	return false;
+
+	Pathfinder.MarkTileDirty(Coord.X, Coord.Y);
+	return Cells.ClearOccupant(Coord.X, Coord.Y);
 }
 
 bool UFarmGridManager::RemoveObjectByActor(AActor* Object)
@@ -380,18 +566,47 @@ bool UFarmGridManager::RemoveObjectByActor(AActor* Object)
 		return false;
 	}
 
+	const TObjectKey<AActor> Key(Object);
+	FGridOccupantRecord Record;
+	if (!OccupantIndex.RemoveAndCopyValue(Key, Record))
+	{
+		return false;
+	}
+	InteractableOccupants.Remove(Key);
+
 	bool bRemoved = false;
-	for (auto& Pair : GridCells)
+	for (const FIntPoint& Cell : Record.Cells)
 	{
-		if (Pair.Value.OccupyingActor.Get() == Object)
+		// Only clear cells still held by this actor
+		if (Cells.GetOccupant(Cell.X, Cell.Y) == Object)
 		{
-			Pair.Value.OccupyingActor.Reset();
+			Cells.ClearOccupant(Cell.X, Cell.Y);
+			Pathfinder.MarkTileDirty(Cell.X, Cell.Y);
 			bRemoved = true;
 		}
 	}
 	return bRemoved;
 }
 
+bool UFarmGridManager::GetObjectCells(AActor* Object, FGridCoordinate& OutAnchor, TArray<FGridCoordinate>& OutCells) const
+{
+	OutCells.Reset();
+
+	const FGridOccupantRecord* Record = Object ? OccupantIndex.Find(TObjectKey<AActor>(Object)) : nullptr;
+	if (!Record)
+	{
+		return false;
+	}
+
+	OutAnchor = Record->Anchor;
+	OutCells.Reserve(Record->Cells.Num());
+	for (const FIntPoint& Cell : Record->Cells)
+	{
+		OutCells.Add(FGridCoordinate(Cell.X, Cell.Y, Record->Anchor.Z));
+	}
+	return true;
+}
+
 UGridFootprintComponent* UFarmGridManager::GetFootprintAtTile(const FGridCoordinate& Coord) const
 {
 	AActor* OccupyingActor = GetObjectAtTile(Coord);
@@ -423,21 +638,22 @@ bool UFarmGridManager::HasInteractionAtTile(const FGridCoordinate& Coord) const
 TArray<AActor*> UFarmGridManager::GetAllInteractableActors() const
 {
 	TArray<AActor*> Result;
-	TSet<AActor*> ProcessedActors;
+	Result.Reserve(InteractableOccupants.Num());
 
-	for (const auto& Pair : GridCells)
+	for (const TObjectKey<AActor>& Key : InteractableOccupants)
 	{
-		AActor* Actor = Pair.Value.OccupyingActor.Get();
-		if (Actor && !ProcessedActors.Contains(Actor))
+		const FGridOccupantRecord* Record = OccupantIndex.Find(Key);
+		AActor* Actor = Record ? Record->Actor.Get() : nullptr;
+		if (!Actor)
 		{
-			ProcessedActors.Add(Actor);
+			continue;
+		}
 
-			if (UGridFootprintComponent* Footprint = Actor->FindComponentByClass<UGridFootprintComponent>())
+		if (UGridFootprintComponent* Footprint = Actor->FindComponentByClass<UGridFootprintComponent>())
+		{
+			if (Footprint->InteractionPoints.Num() > 0)
 			{
-				if (Footprint->InteractionPoints.Num() > 0)
-				{
-					Result.Add(Actor);
-				}
+				Result.Add(Actor);
 			}
 		}
 	}
@@ -448,45 +664,26 @@ TArray<AActor*> UFarmGridManager::GetAllInteractableActors() const
 bool UFarmGridManager::IsInPlayableBounds(const FGridCoordinate& Coord) const
 {
 	// If no bounds zone defined, entire grid is playable
-	bool bHasBoundsZone = false;
-
-	for (const FMapZoneData& Zone : Zones)
+	if (!ZoneIndex.HasZoneType(EZoneType::Bounds))
 	{
-		if (Zone.GetZoneType() == EZoneType::Bounds)
-		{
-			bHasBoundsZone = true;
-			if (Zone.ContainsPoint(Coord.X, Coord.Y))
-			{
-				return true;
-			}
-		}
+		return true;
 	}
 
-	return !bHasBoundsZone; // If no bounds defined, all is playable
+	return ZoneIndex.IsInZoneType(Coord.X, Coord.Y, EZoneType::Bounds);
 }
 
 bool UFarmGridManager::IsIndoor(const FGridCoordinate& Coord) const
 {
-	for (const FMapZoneData& Zone : Zones)
-	{
-		if (Zone.GetZoneType() == EZoneType::Indoor && Zone.ContainsPoint(Coord.X, Coord.Y))
-		{
-			return true;
-		}
-	}
-	return false;
+	return ZoneIndex.IsInZoneType(Coord.X, Coord.Y, EZoneType::Indoor);
 }
 
 TArray<FMapZoneData> UFarmGridManager::GetZonesAtCoordinate(const FGridCoordinate& Coord) const
 {
 	TArray<FMapZoneData> Result;
-	for (const FMapZoneData& Zone : Zones)
+	ZoneIndex.ForEachZoneAt(Coord.X, Coord.Y, [this, &Result](int32 Index)
 	{
-		if (Zone.ContainsPoint(Coord.X, Coord.Y))
-		{
-			Result.Add(Zone);
-		}
-	}
+		Result.Add(Zones[Index]);
+	});
 	return Result;
 }
 
@@ -518,23 +715,29 @@ bool UFarmGridManager::FindNearestWalkableTile(const FGridCoordinate& Target, FG
 		return true;
 	}
 
-	// Spiral outward
+	// Spiral outward. Inner rings were already empty, so only the ring at this radius
+	// is scanned (same order as GetWalkableTilesInRadius, first closest tile wins)
 	for (int32 Radius = 1; Radius <= MaxSearchRadius; ++Radius)
 	{
-		TArray<FGridCoordinate> Adjacent = GetWalkableTilesInRadius(Target, Radius);
-		if (Adjacent.Num() > 0)
+		int32 BestDist = INT_MAX;
+		for (int32 DX = -Radius; DX <= Radius; ++DX)
 		{
-			// Find closest by Manhattan distance
-			int32 BestDist = INT_MAX;
-			for (const FGridCoordinate& Coord : Adjacent)
+			const bool bEdgeColumn = FMath::Abs(DX) == Radius;
+			const int32 StepY = bEdgeColumn ? 1 : Radius * 2;
+			for (int32 DY = -Radius; DY <= Radius; DY += StepY)
 			{
-				int32 Dist = UGridFunctionLibrary::GetManhattanDistance(Target, Coord);
-				if (Dist < BestDist)
+				const FGridCoordinate Coord(Target.X + DX, Target.Y + DY, Target.Z);
+				const int32 Dist = FMath::Abs(DX) + FMath::Abs(DY);
+				if (Dist < BestDist && IsTileWalkable(Coord))
 				{
 					BestDist = Dist;
 					OutResult = Coord;
 				}
 			}
+		}
+
+		if (BestDist != INT_MAX)
+		{
 			return true;
 		}
 	}
@@ -542,6 +745,30 @@ bool UFarmGridManager::FindNearestWalkableTile(const FGridCoordinate& Target, FG
 	return false;
 }
 
+bool UFarmGridManager::FindGridPath(const FGridCoordinate& Start, const FGridCoordinate& Goal, const FGridPathQuery& Query, TArray<FGridCoordinate>& OutPath)
+{
+	OutPath.Reset();
+
+	bool bHierarchical = Query.SearchMode == EGridPathSearchMode::Hierarchical;
+	if (Query.SearchMode == EGridPathSearchMode::Auto)
+	{
+		bHierarchical = GridConfig.Width > HierarchicalPathfindingThreshold || GridConfig.Height > HierarchicalPathfindingThreshold;
+	}
+
+	TArray<FIntPoint> TilePath;
+	if (!Pathfinder.FindPath(FIntPoint(Start.X, Start.Y), FIntPoint(Goal.X, Goal.Y), Query, bHierarchical, TilePath))
+	{
+		return false;
+	}
+
+	OutPath.Reserve(TilePath.Num());
+	for (const FIntPoint& Tile : TilePath)
+	{
+		OutPath.Add(FGridCoordinate(Tile.X, Tile.Y, Start.Z));
+	}
+	return true;
+}
+
 bool UFarmGridManager::GetSpawnPointLocation(const FString& SpawnId, FVector& OutLocation, FRotator& OutRotation) const
 {
 	for (const FMapConnectionData& Connection : Connections)
@@ -631,6 +858,57 @@ TArray<FMapPathData> UFarmGridManager::GetAllNPCSchedules() const
 
 float UFarmGridManager::SampleHeightAtWorldPosition(float WorldX, float WorldY) const
 {
+	const int32 CacheWidth = HeightCache.GetWidth();
+	const int32 CacheHeight = HeightCache.GetHeight();
+
+	float GridX, GridY;
+	if (!bUseHeightCache || CacheWidth == 0 || CacheHeight == 0 || !WorldToGridContinuous(WorldX, WorldY, GridX, GridY))
+	{
+		return TraceHeightAtWorldPosition(WorldX, WorldY);
+	}
+
+	// Outside the grid's tiles there is nothing to interpolate
+	if (GridX < -0.5f || GridY < -0.5f || GridX > CacheWidth - 0.5f || GridY > CacheHeight - 0.5f)
+	{
+		return TraceHeightAtWorldPosition(WorldX, WorldY);
+	}
+
+	// Bilinear between the four surrounding tile centres (clamped at the grid edge).
+	// Near-zero weights are snapped so a query at a tile centre reads just that tile.
+	const int32 X0 = FMath::Clamp(FMath::FloorToInt(GridX), 0, CacheWidth - 1);
+	const int32 Y0 = FMath::Clamp(FMath::FloorToInt(GridY), 0, CacheHeight - 1);
+	const int32 X1 = FMath::Min(X0 + 1, CacheWidth - 1);
+	const int32 Y1 = FMath::Min(Y0 + 1, CacheHeight - 1);
+
+	float FracX = FMath::Clamp(GridX - X0, 0.0f, 1.0f);
+	float FracY = FMath::Clamp(GridY - Y0, 0.0f, 1.0f);
+	const float SnapEpsilon = 1e-3f;
+	FracX = FracX < SnapEpsilon ? 0.0f : (FracX > 1.0f - SnapEpsilon ? 1.0f : FracX);
+	FracY = FracY < SnapEpsilon ? 0.0f : (FracY > 1.0f - SnapEpsilon ? 1.0f : FracY);
+
+	auto SampleCorner = [this](int32 X, int32 Y, float Weight) -> float
+	{
+		if (Weight <= 0.0f)
+		{
+			return 0.0f;
+		}
+		EnsureHeightSampled(X, Y);
+		return HeightCache.GetHeight(X, Y) * Weight;
+	};
+
+	return SampleCorner(X0, Y0, (1.0f - FracX) * (1.0f - FracY))
+		+ SampleCorner(X1, Y0, FracX * (1.0f - FracY))
+		+ SampleCorner(X0, Y1, (1.0f - FracX) * FracY)
+		+ SampleCorner(X1, Y1, FracX * FracY);
+}
+
+float UFarmGridManager::TraceHeightAtWorldPosition(float WorldX, float WorldY, FVector* OutNormal) const
+{
+	if (OutNormal)
+	{
+		*OutNormal = FVector::UpVector;
+	}
+
 	UWorld* World = GetWorld();
 	if (!World)
 	{
@@ -646,98 +924,170 @@ float UFarmGridManager::SampleHeightAtWorldPosition(float WorldX, float WorldY)
 
 	if (World->LineTraceSingleByChannel(HitResult, Start, End, ECC_WorldStatic, QueryParams))
 	{
+		if (OutNormal)
+		{
+			*OutNormal = HitResult.ImpactNormal;
+		}
 		return HitResult.Location.Z;
 	}
 
 	return DefaultHeight;
 }
 
-FGridCell& UFarmGridManager::GetOrCreateCell(const FGridCoordinate& Coord)
+void UFarmGridManager::EnsureHeightSampled(int32 X, int32 Y) const
 {
-	FGridCell* Existing = GridCells.Find(Coord);
-	if (Existing)
+	if (HeightCache.IsSampled(X, Y))
 	{
-		return *Existing;
+		return;
 	}
 
-	FGridCell NewCell;
-	NewCell.TerrainType = DefaultTerrainType;
-	return GridCells.Add(Coord, NewCell);
+	const FVector TileCentre = GridToWorld(FGridCoordinate(X, Y));
+	FVector Normal;
+	const float Height = TraceHeightAtWorldPosition(TileCentre.X, TileCentre.Y, HeightCache.StoresNormals() ? &Normal : nullptr);
+	HeightCache.SetSample(X, Y, Height, HeightCache.StoresNormals() ? Normal : FVector::UpVector);
 }
 
-// ---- Road Network ----
-
-bool UFarmGridManager::GetRoad(const FString& RoadId, FMapRoadData& OutRoad) const
+void UFarmGridManager::BakeHeightCache()
 {
-	for (const FMapRoadData& Road : Roads)
+	const int32 NumTiles = HeightCache.GetWidth() * HeightCache.GetHeight();
+	if (!bUseHeightCache || NumTiles == 0)
 	{
-		if (Road.Id == RoadId)
+		return;
+	}
+
+	if (NumTiles > MaxEagerHeightBakeTiles)
+	{
+		UE_LOG(LogTemp, Log, TEXT("FarmGridManager: %d tiles exceeds eager height bake limit (%d), tiles will be sampled on first use"),
+			NumTiles, MaxEagerHeightBakeTiles);
+		return;
+	}
+
+	const int32 AlreadySampled = HeightCache.GetNumSampled();
+	const double StartTime = FPlatformTime::Seconds();
+	for (int32 Y = 0; Y < HeightCache.GetHeight(); ++Y)
+	{
+		for (int32 X = 0; X < HeightCache.GetWidth(); ++X)
 		{
-			OutRoad = Road;
-			return true;
+			EnsureHeightSampled(X, Y);
 		}
 	}
-	return false;
+
+	UE_LOG(LogTemp, Log, TEXT("FarmGridManager: Baked %d tile heights in %.1f ms (%.1f KB)"),
+		NumTiles - AlreadySampled, (FPlatformTime::Seconds() - StartTime) * 1000.0, HeightCache.GetAllocatedSize() / 1024.0);
 }
 
-bool UFarmGridManager::FindNearestRoadEntry(const FGridCoordinate& Position, FString& OutRoadId, int32& OutWaypointIndex, float MaxDistance) const
+void UFarmGridManager::InvalidateHeightCacheRegion(const FVector& WorldMin, const FVector& WorldMax)
 {
-	if (Roads.Num() == 0)
+	if (HeightCache.GetWidth() == 0)
 	{
-		return false;
+		return;
 	}
 
-	float BestDistSq = MaxDistance * MaxDistance;
-	const FMapRoadData* BestRoad = nullptr;
-	int32 BestWaypointIndex = -1;
+	// The grid may be rotated, so bound all four corners of the box in grid space
+	const FVector2D Corners[4] =
+	{
+		FVector2D(WorldMin.X, WorldMin.Y), FVector2D(WorldMax.X, WorldMin.Y),
+		FVector2D(WorldMin.X, WorldMax.Y), FVector2D(WorldMax.X, WorldMax.Y)
+	};
 
-	for (const FMapRoadData& Road : Roads)
+	float MinX = TNumericLimits<float>::Max();
+	float MinY = TNumericLimits<float>::Max();
+	float MaxX = TNumericLimits<float>::Lowest();
+	float MaxY = TNumericLimits<float>::Lowest();
+	for (const FVector2D& Corner : Corners)
 	{
-		int32 NearestIdx = Road.FindNearestWaypointIndex(Position);
-		if (NearestIdx >= 0)
+		float GridX, GridY;
+		if (!WorldToGridContinuous(Corner.X, Corner.Y, GridX, GridY))
 		{
-			float DistSq = Road.Waypoints[NearestIdx].DistanceSquaredTo(Position);
-			if (DistSq < BestDistSq)
-			{
-				BestDistSq = DistSq;
-				BestRoad = &Road;
-				BestWaypointIndex = NearestIdx;
-			}
+			InvalidateHeightCache();
+			return;
 		}
+		MinX = FMath::Min(MinX, GridX);
+		MinY = FMath::Min(MinY, GridY);
+		MaxX = FMath::Max(MaxX, GridX);
+		MaxY = FMath::Max(MaxY, GridY);
 	}
 
-	if (BestRoad)
+	// Tile N spans [N - 0.5, N + 0.5] in continuous grid space
+	HeightCache.Invalidate(
+		FIntPoint(FMath::FloorToInt(MinX + 0.5f), FMath::FloorToInt(MinY + 0.5f)),
+		FIntPoint(FMath::FloorToInt(MaxX + 0.5f), FMath::FloorToInt(MaxY + 0.5f)));
+}
+
+void UFarmGridManager::InvalidateHeightCache()
+{
+	HeightCache.InvalidateAll();
+}
+
+FVector UFarmGridManager::GetTerrainNormalAtTile(const FGridCoordinate& Coord) const
+{
+	if (bUseHeightCache && HeightCache.StoresNormals() && HeightCache.IsInBounds(Coord.X, Coord.Y))
 	{
-		OutRoadId = BestRoad->Id;
-		OutWaypointIndex = BestWaypointIndex;
-		return true;
+		EnsureHeightSampled(Coord.X, Coord.Y);
+		return HeightCache.GetNormal(Coord.X, Coord.Y);
 	}
 
+	const FVector TileCentre = GridToWorld(Coord);
+	FVector Normal;
+	TraceHeightAtWorldPosition(TileCentre.X, TileCentre.Y, &Normal);
+	return Normal;
+}
+
+// ---- Road Network ----
+
+bool UFarmGridManager::GetRoad(const FString& RoadId, FMapRoadData& OutRoad) const
+{
+	if (const FMapRoadData* Road = FindRoad(RoadId))
+	{
+		OutRoad = *Road;
+		return true;
+	}
 	return false;
 }
 
+const FMapRoadData* UFarmGridManager::FindRoad(const FString& RoadId) const
+{
+	const int32 RoadIndex = RoadGraph.FindRoadIndex(RoadId);
+	return Roads.IsValidIndex(RoadIndex) ? &Roads[RoadIndex] : nullptr;
+}
+
+bool UFarmGridManager::FindNearestRoadEntry(const FGridCoordinate& Position, FString& OutRoadId, int32& OutWaypointIndex, float MaxDistance) const
+{
+	int32 RoadIndex;
+	int32 WaypointIndex;
+	if (!RoadGraph.FindNearestWaypoint(Position, MaxDistance, RoadIndex, WaypointIndex))
+	{
+		return false;
+	}
+
+	OutRoadId = Roads[RoadIndex].Id;
+	OutWaypointIndex = WaypointIndex;
+	return true;
+}
+
 TArray<FVector> UFarmGridManager::GetRoadSegmentWorldPositions(const FString& RoadId, int32 StartIndex, int32 EndIndex) const
 {
 	TArray<FVector> Result;
 
-	FMapRoadData Road;
-	if (!GetRoad(RoadId, Road))
+	const FMapRoadData* Road = FindRoad(RoadId);
+	if (!Road)
 	{
 		return Result;
 	}
 
 	if (StartIndex < 0 || EndIndex < 0 ||
-		StartIndex >= Road.Waypoints.Num() || EndIndex >= Road.Waypoints.Num())
+		StartIndex >= Road->Waypoints.Num() || EndIndex >= Road->Waypoints.Num())
 	{
 		return Result;
 	}
 
 	// Determine direction
 	int32 Step = (EndIndex >= StartIndex) ? 1 : -1;
+	Result.Reserve(FMath::Abs(EndIndex - StartIndex) + 1);
 
 	for (int32 i = StartIndex; ; i += Step)
 	{
-		const FRoadWaypoint& Waypoint = Road.Waypoints[i];
+		const FRoadWaypoint& Waypoint = Road->Waypoints[i];
 		FVector WorldPos = GridToWorldWithHeight(Waypoint.GetGridCoordinate());
 		Result.Add(WorldPos);
 
@@ -754,107 +1104,45 @@ bool UFarmGridManager::FindRoadPath(const FGridCoordinate& Start, const FGridCoo
 {
 	OutPath.Empty();
 
-	if (Roads.Num() == 0)
+	if (RoadGraph.IsEmpty())
 	{
 		return false;
 	}
 
-	// Find nearest road entry from start position
-	FString StartRoadId;
-	int32 StartWaypointIdx;
-	if (!FindNearestRoadEntry(Start, StartRoadId, StartWaypointIdx))
+	// Find nearest road entries for both ends (same reach as FindNearestRoadEntry's default)
+	const float EntrySearchDistance = 1000.0f;
+	int32 StartRoad, StartWaypoint;
+	int32 EndRoad, EndWaypoint;
+	if (!RoadGraph.FindNearestWaypoint(Start, EntrySearchDistance, StartRoad, StartWaypoint) ||
+		!RoadGraph.FindNearestWaypoint(Destination, EntrySearchDistance, EndRoad, EndWaypoint))
 	{
 		return false;
 	}
 
-	// Find nearest road entry to destination
-	FString EndRoadId;
-	int32 EndWaypointIdx;
-	if (!FindNearestRoadEntry(Destination, EndRoadId, EndWaypointIdx))
+	// Shortest route over the road graph (junctions, one-way roads and speed all accounted for)
+	TArray<int32> RouteNodes;
+	if (!RoadGraph.FindRoute(RoadGraph.GetWaypointNode(StartRoad, StartWaypoint), RoadGraph.GetWaypointNode(EndRoad, EndWaypoint), RouteNodes))
 	{
 		return false;
 	}
 
-	// For simple case: both on same road
-	if (StartRoadId == EndRoadId)
-	{
-		FMapRoadData Road;
-		if (GetRoad(StartRoadId, Road))
-		{
-			// Check if we can travel in the needed direction
-			bool bForward = EndWaypointIdx >= StartWaypointIdx;
-			if (!bForward && !Road.bBidirectional)
-			{
-				// Need to go backwards but road is one-way - go to start then to end
-				// Add path: start -> waypoint 0 -> end waypoint
-				TArray<FVector> ToStart = GetRoadSegmentWorldPositions(StartRoadId, StartWaypointIdx, 0);
-				TArray<FVector> ToEnd = GetRoadSegmentWorldPositions(StartRoadId, 0, EndWaypointIdx);
-
-				// Add walk-to-road segment
-				OutPath.Add(GridToWorldWithHeight(Start));
-				OutPath.Append(ToStart);
-				OutPath.Append(ToEnd);
-				OutPath.Add(GridToWorldWithHeight(Destination));
-				return true;
-			}
-
-			// Direct path along road
-			OutPath.Add(GridToWorldWithHeight(Start));
-			OutPath.Append(GetRoadSegmentWorldPositions(StartRoadId, StartWaypointIdx, EndWaypointIdx));
-			OutPath.Add(GridToWorldWithHeight(Destination));
-			return true;
-		}
-	}
-
-	// Different roads - for now just use direct path to start road, along road, off road to destination
-	// A more complex implementation would search connected roads
+	// Walk onto the road, follow it, walk off to the destination
+	OutPath.Reserve(RouteNodes.Num() + 2);
 	OutPath.Add(GridToWorldWithHeight(Start));
-
-	FMapRoadData StartRoad;
-	if (GetRoad(StartRoadId, StartRoad))
+	for (const int32 Node : RouteNodes)
 	{
-		// Walk along start road toward destination
-		FVector DestWorld = GridToWorld(Destination);
-
-		// Find which end of the road is closer to destination
-		if (StartRoad.Waypoints.Num() > 0)
-		{
-			FVector FirstWaypointWorld = GridToWorld(StartRoad.Waypoints[0].GetGridCoordinate());
-			FVector LastWaypointWorld = GridToWorld(StartRoad.Waypoints.Last().GetGridCoordinate());
-
-			float DistToFirst = FVector::DistSquared2D(DestWorld, FirstWaypointWorld);
-			float DistToLast = FVector::DistSquared2D(DestWorld, LastWaypointWorld);
-
-			int32 TargetIdx = (DistToFirst < DistToLast) ? 0 : StartRoad.Waypoints.Num() - 1;
-
-			if (StartRoad.bBidirectional || TargetIdx >= StartWaypointIdx)
-			{
-				TArray<FVector> RoadPath = GetRoadSegmentWorldPositions(StartRoadId, StartWaypointIdx, TargetIdx);
-				OutPath.Append(RoadPath);
-			}
-		}
+		OutPath.Add(GridToWorldWithHeight(RoadGraph.GetNodePosition(Node)));
 	}
-
 	OutPath.Add(GridToWorldWithHeight(Destination));
-	return OutPath.Num() > 2;
+	return true;
 }
 
 bool UFarmGridManager::IsOnRoad(const FGridCoordinate& Position, float Tolerance) const
 {
-	float ToleranceSq = Tolerance * Tolerance;
-
-	for (const FMapRoadData& Road : Roads)
-	{
-		for (const FRoadWaypoint& Waypoint : Road.Waypoints)
-		{
-			if (Waypoint.DistanceSquaredTo(Position) <= ToleranceSq)
-			{
-				return true;
-			}
-		}
-	}
-
-	return false;
+	// Nearest-waypoint search only accepts strictly closer hits; widen by a hair to keep "<= Tolerance"
+	int32 RoadIndex;
+	int32 WaypointIndex;
+	return RoadGraph.FindNearestWaypoint(Position, Tolerance + KINDA_SMALL_NUMBER, RoadIndex, WaypointIndex);
 }
 
 // ---- Debug Visualization ----
@@ -945,12 +1233,13 @@ void UFarmGridManager::DrawDebugRoad(const FString& RoadId, FLinearColor Color,
 		return;
 	}
 
-	FMapRoadData Road;
-	if (!GetRoad(RoadId, Road))
+	const FMapRoadData* RoadPtr = FindRoad(RoadId);
+	if (!RoadPtr)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("DrawDebugRoad: Road '%s' not found"), *RoadId);
 		return;
 	}
+	const FMapRoadData& Road = *RoadPtr;
 
 	FColor DrawColor = Color.ToFColor(true);
 
@@ -1055,7 +1344,8 @@ void UFarmGridManager::DrawDebugZones(float Duration) const
 		default: ZoneColor = FColor::White; break;
 		}
 
-		if (Zone.Shape == TEXT("rect"))
+		const EZoneShape ZoneShape = Zone.GetZoneShape();
+		if (ZoneShape == EZoneShape::Rect)
 		{
 			// Draw rectangle zone
 			FVector Corner1 = GridToWorldWithHeight(FGridCoordinate(Zone.X, Zone.Y));
@@ -1078,7 +1368,7 @@ void UFarmGridManager::DrawDebugZones(float Duration) const
 			FVector LabelPos = (Corner1 + Corner3) * 0.5f + FVector(0, 0, 50);
 			DrawDebugString(World, LabelPos, FString::Printf(TEXT("%s (%s)"), *Zone.Id, *Zone.Type), nullptr, ZoneColor, Duration, true);
 		}
-		else if (Zone.Shape == TEXT("polygon") && Zone.Points.Num() >= 3)
+		else if (ZoneShape == EZoneShape::Polygon && Zone.Points.Num() >= 3)
 		{
 			// Draw polygon zone
 			for (int32 i = 0; i < Zone.Points.Num(); ++i)
@@ -1099,7 +1389,7 @@ void UFarmGridManager::DrawDebugZones(float Duration) const
 
 // ---- Crop Management ----
 
-AGridPlaceableCrop* UFarmGridManager::PlantCrop(TSubclassOf<AGridPlaceableCrop> CropClass, const FGridCoordinate& Coord)
+AGridPlaceableCrop* UFarmGridManager::PlantCrop(TSubclassOf<AGridPlaceableCrop> CropClass, const FGridCoordinate& Coord, FName CropTypeId)
 {
 	UWorld* World = GetWorld();
 	if (!World || !CropClass)
@@ -1123,12 +1413,16 @@ AGridPlaceableCrop* UFarmGridManager::PlantCrop(TSubclassOf<AGridPlaceableCrop>
 		return nullptr;
 	}
 
-	// Spawn the crop
-	FVector SpawnLocation = GridToWorldWithHeight(Coord);
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-
-	AGridPlaceableCrop* Crop = World->SpawnActor<AGridPlaceableCrop>(CropClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
+	// Reuse a harvested crop if the pool has one; the type is set before it registers with the simulation
+	const FTransform SpawnTransform(GridToWorldWithHeight(Coord));
+	AGridPlaceableCrop* Crop = Cast<AGridPlaceableCrop>(UGridActorPool::AcquireOrSpawn(World, CropClass, SpawnTransform,
+		[CropTypeId](AActor& Actor)
+		{
+			if (!CropTypeId.IsNone())
+			{
+				CastChecked<AGridPlaceableCrop>(&Actor)->CropTypeId = CropTypeId;
+			}
+		}));
 	if (Crop)
 	{
 		Crop->SetGridPosition(Coord);
@@ -1142,16 +1436,11 @@ AGridPlaceableCrop* UFarmGridManager::PlantCrop(TSubclassOf<AGridPlaceableCrop>
 TArray<AGridPlaceableCrop*> UFarmGridManager::GetAllCrops() const
 {
 	TArray<AGridPlaceableCrop*> Crops;
+	Crops.Reserve(CropSimulation.Num());
 
-	UWorld* World = GetWorld();
-	if (!World)
-	{
-		return Crops;
-	}
-
-	for (TActorIterator<AGridPlaceableCrop> It(World); It; ++It)
+	for (int32 Index = 0; Index < CropSimulation.Num(); ++Index)
 	{
-		AGridPlaceableCrop* Crop = *It;
+		AGridPlaceableCrop* Crop = CropSimulation.GetView(Index);
 		if (Crop && !Crop->IsPendingKillPending())
 		{
 			Crops.Add(Crop);
@@ -1169,23 +1458,26 @@ void UFarmGridManager::SaveCropsToWorldSave(UFarmingWorldSaveGame* WorldSave)
 	}
 
 	WorldSave->PlacedCrops.Empty();
+	WorldSave->PlacedCrops.Reserve(CropSimulation.Num());
 
-	TArray<AGridPlaceableCrop*> Crops = GetAllCrops();
-	for (AGridPlaceableCrop* Crop : Crops)
+	// Read straight from the simulation, which is authoritative over the actors' properties
+	for (int32 Index = 0; Index < CropSimulation.Num(); ++Index)
 	{
-		if (!Crop)
+		const AGridPlaceableCrop* Crop = CropSimulation.GetView(Index);
+		if (Crop && Crop->IsPendingKillPending())
 		{
 			continue;
 		}
 
+		const FCropDayState State = CropSimulation.GetState(Index);
 		FPlacedCropSave CropSave;
-		CropSave.GridX = Crop->GridPosition.X;
-		CropSave.GridY = Crop->GridPosition.Y;
-		CropSave.CropTypeId = Crop->CropTypeId;
-		CropSave.GrowthStage = static_cast<int32>(Crop->GrowthStage);
-		CropSave.DaysGrown = Crop->DaysGrown;
-		CropSave.bWateredToday = Crop->bWateredToday;
-		CropSave.TotalDaysWatered = Crop->TotalDaysWatered;
+		CropSave.GridX = CropSimulation.GetTile(Index).X;
+		CropSave.GridY = CropSimulation.GetTile(Index).Y;
+		CropSave.CropTypeId = CropSimulation.GetCropTypeId(Index);
+		CropSave.GrowthStage = static_cast<int32>(State.Stage);
+		CropSave.DaysGrown = State.DaysGrown;
+		CropSave.bWateredToday = State.bWateredToday;
+		CropSave.TotalDaysWatered = State.TotalDaysWatered;
 
 		WorldSave->PlacedCrops.Add(CropSave);
 	}
@@ -1201,55 +1493,200 @@ void UFarmGridManager::RestoreCropsFromWorldSave(UFarmingWorldSaveGame* WorldSav
 		return;
 	}
 
-	// Destroy existing crops first
+	// A restore still waiting on its assets is superseded
+	CancelCropRestore();
+
+	// Clear existing crops first; pooled, they are reused by the respawn below
 	TArray<AGridPlaceableCrop*> ExistingCrops = GetAllCrops();
 	for (AGridPlaceableCrop* Crop : ExistingCrops)
 	{
 		if (Crop)
 		{
 			RemoveObjectByActor(Crop);
-			Crop->Destroy();
+			UGridActorPool::ReleaseOrDestroy(Crop);
 		}
 	}
 
-	// Spawn crops from save data
-	for (const FPlacedCropSave& CropSave : WorldSave->PlacedCrops)
+	PendingCropRestore = WorldSave->PlacedCrops;
+	PendingDefaultCropClass = DefaultCropClass;
+
+	// One load request for every type in the save, rather than a synchronous load per crop
+	TArray<FSoftObjectPath> AssetPaths;
+	if (CropTypeRegistry)
 	{
-		FGridCoordinate Coord(CropSave.GridX, CropSave.GridY);
+		TSet<FName> CropTypeIds;
+		for (const FPlacedCropSave& CropSave : PendingCropRestore)
+		{
+			CropTypeIds.Add(CropSave.CropTypeId);
+		}
+		CropTypeRegistry->GetUnloadedAssetPaths(CropTypeIds.Array(), AssetPaths);
+	}
 
-		// Spawn crop - for now using default class, could be extended to use registry
-		FVector SpawnLocation = GridToWorldWithHeight(Coord);
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	if (AssetPaths.Num() > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("RestoreCropsFromWorldSave: Loading %d crop assets before spawning %d crops"), AssetPaths.Num(), PendingCropRestore.Num());
+		CropRestoreLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths,
+			FStreamableDelegate::CreateUObject(this, &UFarmGridManager::SpawnRestoredCrops));
+	}
+	else
+	{
+		SpawnRestoredCrops();
+	}
+}
 
-		AGridPlaceableCrop* Crop = World->SpawnActor<AGridPlaceableCrop>(DefaultCropClass, SpawnLocation, FRotator::ZeroRotator, SpawnParams);
-		if (Crop)
+void UFarmGridManager::SpawnRestoredCrops()
+{
+	const TArray<FPlacedCropSave> CropSaves = MoveTemp(PendingCropRestore);
+	const TSubclassOf<AGridPlaceableCrop> DefaultCropClass = PendingDefaultCropClass;
+	PendingCropRestore.Reset();
+	PendingDefaultCropClass = nullptr;
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		CropRestoreLoadHandle.Reset();
+		return;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	// Group by type so each type's definition and class are resolved once
+	TMap<FName, TArray<int32>> SavesByType;
+	for (int32 Index = 0; Index < CropSaves.Num(); ++Index)
+	{
+		SavesByType.FindOrAdd(CropSaves[Index].CropTypeId).Add(Index);
+	}
+
+	int32 NumRestored = 0;
+	for (const TPair<FName, TArray<int32>>& TypeSaves : SavesByType)
+	{
+		const FCropTypeDefinition* Definition = CropTypeRegistry ? CropTypeRegistry->FindDefinition(TypeSaves.Key) : nullptr;
+		TSubclassOf<AGridPlaceableCrop> CropClass = Definition ? CropTypeRegistry->GetCropClass(TypeSaves.Key) : nullptr;
+		if (!CropClass)
+		{
+			CropClass = DefaultCropClass;
+		}
+		if (!CropClass)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("RestoreCropsFromWorldSave: No class for crop type '%s', skipping %d crops"),
+				*TypeSaves.Key.ToString(), TypeSaves.Value.Num());
+			continue;
+		}
+
+		for (int32 SaveIndex : TypeSaves.Value)
 		{
+			const FPlacedCropSave& CropSave = CropSaves[SaveIndex];
+			const FGridCoordinate Coord(CropSave.GridX, CropSave.GridY);
+			const FTransform SpawnTransform(GridToWorldWithHeight(Coord));
+
+			// Set up before the crop activates, so it joins the simulation and renderer in its restored state
+			AGridPlaceableCrop* Crop = Cast<AGridPlaceableCrop>(UGridActorPool::AcquireOrSpawn(World, CropClass, SpawnTransform,
+				[Definition, &CropSave, &Coord](AActor& Actor)
+				{
+					AGridPlaceableCrop& NewCrop = static_cast<AGridPlaceableCrop&>(Actor);
+					if (Definition)
+					{
+						UCropTypeRegistry::ApplyDefinition(*Definition, NewCrop);
+					}
+					NewCrop.GridPosition = Coord;
+					NewCrop.InitializeFromSaveData(
+						CropSave.CropTypeId,
+						CropSave.GrowthStage,
+						CropSave.DaysGrown,
+						CropSave.bWateredToday,
+						CropSave.TotalDaysWatered
+					);
+				}));
+			if (!Crop)
+			{
+				continue;
+			}
+
+			// Registers the footprint with the grid
 			Crop->SetGridPosition(Coord);
-			Crop->InitializeFromSaveData(
-				CropSave.CropTypeId,
-				CropSave.GrowthStage,
-				CropSave.DaysGrown,
-				CropSave.bWateredToday,
-				CropSave.TotalDaysWatered
-			);
-			PlaceObject(Crop, Coord, 1, 1);
+			++NumRestored;
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("RestoreCropsFromWorldSave: Restored %d crops"), WorldSave->PlacedCrops.Num());
+	CropRestoreLoadHandle.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("RestoreCropsFromWorldSave: Restored %d crops of %d types in %.2f ms"),
+		NumRestored, SavesByType.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	OnCropsRestored.Broadcast(NumRestored);
+}
+
+void UFarmGridManager::CancelCropRestore()
+{
+	if (CropRestoreLoadHandle.IsValid())
+	{
+		CropRestoreLoadHandle->CancelHandle();
+		CropRestoreLoadHandle.Reset();
+	}
+	PendingCropRestore.Reset();
+	PendingDefaultCropClass = nullptr;
+}
+
+void UFarmGridManager::PreloadCropTypes(const TArray<FName>& CropTypeIds)
+{
+	if (!CropTypeRegistry)
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+	CropTypeRegistry->GetUnloadedAssetPaths(CropTypeIds, AssetPaths);
+	if (AssetPaths.Num() > 0)
+	{
+		CropPreloadHandles.Add(UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths));
+	}
 }
 
 void UFarmGridManager::OnDayAdvanceForCrops(int32 CurrentSeason)
 {
-	TArray<AGridPlaceableCrop*> Crops = GetAllCrops();
-	for (AGridPlaceableCrop* Crop : Crops)
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<FCropStageChange> Changes;
+	CropSimulation.AdvanceDay(CurrentSeason, Changes);
+
+	const double SimulatedTime = FPlatformTime::Seconds();
+
+	// Only crops whose stage changed need their actor touched. Resolve the actors first:
+	// a Blueprint event that destroys its crop reshuffles simulation indices.
+	TArray<TPair<TWeakObjectPtr<AGridPlaceableCrop>, ECropGrowthStage>> ChangedCrops;
+	ChangedCrops.Reserve(Changes.Num());
+	for (const FCropStageChange& Change : Changes)
 	{
-		if (Crop)
+		ChangedCrops.Emplace(CropSimulation.GetView(Change.Index), Change.OldStage);
+	}
+
+	for (const TPair<TWeakObjectPtr<AGridPlaceableCrop>, ECropGrowthStage>& Changed : ChangedCrops)
+	{
+		if (AGridPlaceableCrop* Crop = Changed.Key.Get())
 		{
-			Crop->OnDayAdvance(CurrentSeason);
+			Crop->OnSimulatedStageChange(Changed.Value);
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("OnDayAdvanceForCrops: Updated %d crops for new day"), Crops.Num());
+	UE_LOG(LogTemp, Log, TEXT("OnDayAdvanceForCrops: Advanced %d crops in %.1f us, %d changed stage (%.1f us to update)"),
+		CropSimulation.Num(), (SimulatedTime - StartTime) * 1e6, Changes.Num(), (FPlatformTime::Seconds() - SimulatedTime) * 1e6);
+}
+
+// ---- Tile Rendering ----
+
+AGridTileRenderer* UFarmGridManager::GetTileRenderer()
+{
+	UWorld* World = GetWorld();
+	if (!bUseInstancedTileRendering || !World || !World->IsGameWorld())
+	{
+		return nullptr;
+	}
+
+	if (!IsValid(TileRenderer))
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags |= RF_Transient;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		TileRenderer = World->SpawnActor<AGridTileRenderer>(AGridTileRenderer::StaticClass(), FTransform::Identity, SpawnParams);
+	}
+	return TileRenderer;
 }
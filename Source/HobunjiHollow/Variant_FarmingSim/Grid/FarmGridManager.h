@@ -5,13 +5,26 @@
 #include "CoreMinimal.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "GridTypes.h"
+#include "GridCellStore.h"
+#include "GridZoneIndex.h"
+#include "GridPathfinder.h"
+#include "RoadGraph.h"
+#include "GridHeightCache.h"
+#include "CropSimulation.h"
 #include "MapDataTypes.h"
+#include "Save/FarmingWorldSaveGame.h"
+#include "UObject/ObjectKey.h"
 #include "FarmGridManager.generated.h"
 
 class UGridFootprintComponent;
 class AGridPlaceableCrop;
+class AGridTileRenderer;
+class UCropTypeRegistry;
 class UFarmingWorldSaveGame;
 struct FGridInteractionPoint;
+struct FStreamableHandle;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnCropsRestored, int32, NumRestored);
 
 /**
  * World subsystem that manages the grid state for a level.
@@ -36,6 +49,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Grid")
 	void InitializeFromMapData(const FMapData& MapData);
 
+	/**
+	 * Apply a re-import in place. Only tiles whose map definition (terrain, tilled, watered) changed
+	 * are rewritten; zones, roads, paths, connections and spawners are replaced only if they differ.
+	 * Occupants are kept. Returns false without touching the grid if the layout (size, cell size,
+	 * origin, default terrain) changed, or the grid wasn't built from OldData; callers then need InitializeFromMapData.
+	 */
+	bool ApplyMapDataChanges(const FMapData& OldData, const FMapData& NewData, TArray<FIntPoint>& OutChangedTiles);
+
 	/** Set the grid transform (offset, scale, rotation) for coordinate conversions */
 	UFUNCTION(BlueprintCallable, Category = "Grid")
 	void SetGridTransform(const FVector& Offset, float Scale, float RotationDegrees);
@@ -133,6 +154,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Grid")
 	bool RemoveObjectByActor(AActor* Object);
 
+	/** Get the anchor and cells an actor occupies. Returns false if the actor is not placed. */
+	UFUNCTION(BlueprintCallable, Category = "Grid")
+	bool GetObjectCells(AActor* Object, FGridCoordinate& OutAnchor, TArray<FGridCoordinate>& OutCells) const;
+
 	// ---- Interaction Queries ----
 
 	/** Get the GridFootprintComponent for the object at a coordinate (if any) */
@@ -171,6 +196,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Grid")
 	bool FindNearestWalkableTile(const FGridCoordinate& Target, FGridCoordinate& OutResult, int32 MaxSearchRadius = 5) const;
 
+	/**
+	 * Find a tile path on the grid with A*. The path includes Start and Goal.
+	 * Honours terrain, occupancy, the agent footprint and (optionally) zones.
+	 * In Auto mode, maps larger than HierarchicalPathfindingThreshold use the cluster layer.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Pathfinding")
+	bool FindGridPath(const FGridCoordinate& Start, const FGridCoordinate& Goal, const FGridPathQuery& Query, TArray<FGridCoordinate>& OutPath);
+
+	/** Tiles expanded by the last FindGridPath call */
+	UFUNCTION(BlueprintPure, Category = "Grid|Pathfinding")
+	int32 GetLastPathExpandedTiles() const { return Pathfinder.GetLastExpandedCount(); }
+
+	/** Maps wider or taller than this use hierarchical search in Auto mode */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pathfinding")
+	int32 HierarchicalPathfindingThreshold = 256;
+
 	// ---- Spawn Points ----
 
 	UFUNCTION(BlueprintPure, Category = "Grid")
@@ -205,6 +246,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Grid|Roads")
 	bool GetRoad(const FString& RoadId, FMapRoadData& OutRoad) const;
 
+	/** Find a road by ID without copying it (nullptr if not found) */
+	const FMapRoadData* FindRoad(const FString& RoadId) const;
+
 	/** Find the nearest road entry point to a grid position */
 	UFUNCTION(BlueprintCallable, Category = "Grid|Roads")
 	bool FindNearestRoadEntry(const FGridCoordinate& Position, FString& OutRoadId, int32& OutWaypointIndex, float MaxDistance = 1000.0f) const;
@@ -213,7 +257,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Grid|Roads")
 	TArray<FVector> GetRoadSegmentWorldPositions(const FString& RoadId, int32 StartIndex, int32 EndIndex) const;
 
-	/** Find the best path along roads from start to destination */
+	/** Find the shortest path along the road network (junctions, one-way roads and speed multipliers included) */
 	UFUNCTION(BlueprintCallable, Category = "Grid|Roads")
 	bool FindRoadPath(const FGridCoordinate& Start, const FGridCoordinate& Destination, TArray<FVector>& OutPath) const;
 
@@ -258,17 +302,48 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Height")
 	float DefaultHeight = 0.0f;
 
+	/** Serve heights from a per-tile cache (bilinear between tile centres) instead of tracing every call */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Height")
+	bool bUseHeightCache = true;
+
+	/** Also cache the terrain normal of each tile (takes effect on the next grid initialisation) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Height")
+	bool bCacheTerrainNormals = false;
+
+	/** BakeHeightCache samples every tile up to this map size; larger maps sample tiles on first use */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Height", meta = (ClampMin = "0"))
+	int32 MaxEagerHeightBakeTiles = 65536;
+
 	/** Sample terrain height at a world XY position */
 	UFUNCTION(BlueprintCallable, Category = "Grid")
 	float SampleHeightAtWorldPosition(float WorldX, float WorldY) const;
 
+	/** Trace every tile into the height cache (call once the level geometry is loaded) */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Height")
+	void BakeHeightCache();
+
+	/** Re-sample cached heights for tiles overlapping a world-space box, e.g. after static geometry there changed */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Height")
+	void InvalidateHeightCacheRegion(const FVector& WorldMin, const FVector& WorldMax);
+
+	/** Re-sample all cached heights on next use */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Height")
+	void InvalidateHeightCache();
+
+	/** Terrain normal at a tile centre (up vector if nothing was hit) */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Height")
+	FVector GetTerrainNormalAtTile(const FGridCoordinate& Coord) const;
+
 	// ---- Crop Management ----
 
-	/** Plant a crop at the given grid location */
+	/**
+	 * Plant a crop at the given grid location.
+	 * CropTypeId (if set) replaces the class default before the crop joins the simulation.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Grid|Crops")
-	AGridPlaceableCrop* PlantCrop(TSubclassOf<AGridPlaceableCrop> CropClass, const FGridCoordinate& Coord);
+	AGridPlaceableCrop* PlantCrop(TSubclassOf<AGridPlaceableCrop> CropClass, const FGridCoordinate& Coord, FName CropTypeId = NAME_None);
 
-	/** Get all placed crops in the world */
+	/** Get all placed crops in the world (the registered crop actors) */
 	UFUNCTION(BlueprintCallable, Category = "Grid|Crops")
 	TArray<AGridPlaceableCrop*> GetAllCrops() const;
 
@@ -276,14 +351,51 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Grid|Crops")
 	void SaveCropsToWorldSave(UFarmingWorldSaveGame* WorldSave);
 
-	/** Restore all crops from world save */
+	/**
+	 * Restore all crops from world save. Crops are spawned a type at a time, as the class the crop
+	 * type registry gives their CropTypeId (DefaultCropClass for unregistered types). Registered
+	 * classes and meshes that aren't loaded yet are loaded asynchronously first, so the crops may
+	 * only appear later: OnCropsRestored fires once they have spawned.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Grid|Crops")
 	void RestoreCropsFromWorldSave(UFarmingWorldSaveGame* WorldSave, TSubclassOf<AGridPlaceableCrop> DefaultCropClass);
 
-	/** Called when day advances - updates all crops */
+	/** Broadcast when crops from RestoreCropsFromWorldSave have spawned */
+	UPROPERTY(BlueprintAssignable, Category = "Grid|Crops")
+	FOnCropsRestored OnCropsRestored;
+
+	/** Crop definitions used to resolve saved crop types (null = always the restore's default class) */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Crops")
+	void SetCropTypeRegistry(UCropTypeRegistry* Registry) { CropTypeRegistry = Registry; }
+
+	UFUNCTION(BlueprintPure, Category = "Grid|Crops")
+	UCropTypeRegistry* GetCropTypeRegistry() const { return CropTypeRegistry; }
+
+	/** Load the classes and meshes of these crop types in the background and keep them loaded */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Crops")
+	void PreloadCropTypes(const TArray<FName>& CropTypeIds);
+
+	/** Called when day advances - advances the crop simulation and notifies crops whose stage changed */
 	UFUNCTION(BlueprintCallable, Category = "Grid|Crops")
 	void OnDayAdvanceForCrops(int32 CurrentSeason);
 
+	/** State store for every planted crop; crop actors register themselves as views */
+	FCropSimulation& GetCropSimulation() { return CropSimulation; }
+	const FCropSimulation& GetCropSimulation() const { return CropSimulation; }
+
+	// ---- Tile Rendering ----
+
+	/** Soil and crop actors draw through the shared instanced tile renderer instead of their own mesh components */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Rendering")
+	bool bUseInstancedTileRendering = true;
+
+	/** Instanced renderer for tile visuals, spawned on first use (null outside game worlds or when disabled) */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Rendering")
+	AGridTileRenderer* GetTileRenderer();
+
+	/** The tile renderer if one was spawned, without spawning it (safe during teardown) */
+	AGridTileRenderer* FindTileRenderer() const { return IsValid(TileRenderer) ? TileRenderer : nullptr; }
+
 protected:
 	UPROPERTY()
 	FGridConfig GridConfig;
@@ -300,11 +412,10 @@ protected:
 	UPROPERTY()
 	float GridRotationDegrees = 0.0f;
 
-	/** Sparse storage of modified grid cells */
-	UPROPERTY()
-	TMap<FGridCoordinate, FGridCell> GridCells;
+	/** Dense chunked storage of per-tile state (terrain, tilled, watered, occupancy) */
+	FGridCellStore Cells;
 
-	/** Default terrain type for cells not in GridCells */
+	/** Default terrain type for cells that were never written */
 	UPROPERTY()
 	ETerrainType DefaultTerrainType = ETerrainType::Default;
 
@@ -312,6 +423,26 @@ protected:
 	UPROPERTY()
 	TArray<FMapZoneData> Zones;
 
+	/** Per-tile zone lookup, rebuilt whenever Zones changes */
+	FGridZoneIndex ZoneIndex;
+
+	/** Grid path search over Cells/ZoneIndex; told about passability changes as they happen */
+	FGridPathfinder Pathfinder{ Cells, ZoneIndex };
+
+	/** Cells claimed by one placed actor */
+	struct FGridOccupantRecord
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FGridCoordinate Anchor;
+		TArray<FIntPoint, TInlineAllocator<4>> Cells;
+	};
+
+	/** Reverse index from occupying actor to its cells, maintained by PlaceObject/RemoveObject */
+	TMap<TObjectKey<AActor>, FGridOccupantRecord> OccupantIndex;
+
+	/** Occupants whose footprint had interaction points when placed */
+	TSet<TObjectKey<AActor>> InteractableOccupants;
+
 	/** Map connections (spawn points and exits) */
 	UPROPERTY()
 	TArray<FMapConnectionData> Connections;
@@ -324,12 +455,50 @@ protected:
 	UPROPERTY()
 	TArray<FMapRoadData> Roads;
 
+	/** Compiled road graph and waypoint lookup, rebuilt whenever Roads changes */
+	FRoadGraph RoadGraph;
+
 	/** Resource spawner data */
 	UPROPERTY()
 	TArray<FMapSpawnerData> Spawners;
 
-	/** Get or create a cell at coordinate */
-	FGridCell& GetOrCreateCell(const FGridCoordinate& Coord);
+	UPROPERTY()
+	AGridTileRenderer* TileRenderer = nullptr;
+
+	FCropSimulation CropSimulation;
+
+	UPROPERTY()
+	UCropTypeRegistry* CropTypeRegistry = nullptr;
+
+	/** Keeps assets requested by PreloadCropTypes loaded */
+	TArray<TSharedPtr<FStreamableHandle>> CropPreloadHandles;
+
+	/** Assets a pending crop restore is waiting on */
+	TSharedPtr<FStreamableHandle> CropRestoreLoadHandle;
+
+	/** Saved crops of a restore waiting on CropRestoreLoadHandle */
+	TArray<FPlacedCropSave> PendingCropRestore;
+
+	UPROPERTY()
+	TSubclassOf<AGridPlaceableCrop> PendingDefaultCropClass;
+
+	/** Spawn PendingCropRestore, grouped by crop type */
+	void SpawnRestoredCrops();
+
+	/** Cancel a restore still waiting on its assets */
+	void CancelCropRestore();
+
+	/** Per-tile terrain heights; tiles are sampled lazily from const height queries */
+	mutable FGridHeightCache HeightCache;
+
+	/** Line trace for terrain height (and normal) at a world XY position */
+	float TraceHeightAtWorldPosition(float WorldX, float WorldY, FVector* OutNormal = nullptr) const;
+
+	/** Trace a tile into the height cache if it has no valid sample */
+	void EnsureHeightSampled(int32 X, int32 Y) const;
+
+	/** Inverse of GridToWorld without rounding: tile centres map to integer coordinates */
+	bool WorldToGridContinuous(float WorldX, float WorldY, float& OutGridX, float& OutGridY) const;
 
 	/** Apply grid transform (scale and rotation) to a position relative to grid origin */
 	FVector2D ApplyGridTransform(float GridX, float GridY) const;
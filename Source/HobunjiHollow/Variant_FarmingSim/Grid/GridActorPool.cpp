@@ -0,0 +1,240 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GridActorPool.h"
+#include "GridPoolable.h"
+#include "GridFootprintComponent.h"
+#include "FarmGridManager.h"
+#include "MapDataTypes.h"
+#include "Engine/World.h"
+
+bool UGridActorPool::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+AActor* UGridActorPool::AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform)
+{
+	return AcquireActorDeferred(ActorClass, Transform, [](AActor&) {});
+}
+
+AActor* UGridActorPool::AcquireActorDeferred(TSubclassOf<AActor> ActorClass, const FTransform& Transform, TFunctionRef<void(AActor&)> Initialize,
+	ESpawnActorCollisionHandlingMethod CollisionHandling)
+{
+	UWorld* World = GetWorld();
+	if (!World || !ActorClass)
+	{
+		return nullptr;
+	}
+
+	if (FGridActorFreeList* FreeList = FreeLists.Find(ActorClass))
+	{
+		while (FreeList->Actors.Num() > 0)
+		{
+			AActor* Actor = FreeList->Actors.Pop(EAllowShrinking::No);
+			PooledActors.Remove(Actor);
+
+			// Destroyed while idle (e.g. by a level unload)
+			if (!IsValid(Actor))
+			{
+				continue;
+			}
+
+			Actor->SetActorTransform(Transform, /*bSweep*/ false, nullptr, ETeleportType::TeleportPhysics);
+			Initialize(*Actor);
+			Actor->SetActorHiddenInGame(false);
+			Actor->SetActorEnableCollision(true);
+			IGridPoolable::Execute_OnAcquiredFromPool(Actor);
+
+			++NumReused;
+			return Actor;
+		}
+	}
+
+	AActor* Actor = SpawnInitialized(World, ActorClass, Transform, Initialize, CollisionHandling);
+	if (Actor)
+	{
+		++NumSpawned;
+	}
+	return Actor;
+}
+
+void UGridActorPool::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || PooledActors.Contains(Actor))
+	{
+		return;
+	}
+
+	OnActorReleased.Broadcast(Actor);
+
+	UClass* ActorClass = Actor->GetClass();
+	const FGridActorFreeList* FreeList = FreeLists.Find(ActorClass);
+	if (!IsPoolableClass(ActorClass) || Actor->GetWorld() != GetWorld() || (FreeList && FreeList->Actors.Num() >= MaxPooledPerClass))
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	IGridPoolable::Execute_OnReleasedToPool(Actor);
+	AddToFreeList(Actor);
+}
+
+void UGridActorPool::AddToFreeList(AActor* Actor)
+{
+	// Anything the actor's own hook left on the grid
+	if (UGridFootprintComponent* Footprint = Actor->FindComponentByClass<UGridFootprintComponent>())
+	{
+		Footprint->UnregisterFromGrid(nullptr);
+	}
+	if (UFarmGridManager* GridManager = GetWorld()->GetSubsystem<UFarmGridManager>())
+	{
+		GridManager->RemoveObjectByActor(Actor);
+	}
+
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+
+	FreeLists.FindOrAdd(Actor->GetClass()).Actors.Add(Actor);
+	PooledActors.Add(Actor);
+}
+
+void UGridActorPool::PrewarmClass(TSubclassOf<AActor> ActorClass, int32 Count)
+{
+	UWorld* World = GetWorld();
+	if (!World || !IsPoolableClass(ActorClass))
+	{
+		return;
+	}
+
+	const int32 Target = FMath::Min(Count, MaxPooledPerClass);
+	int32 NumAdded = 0;
+	while (FreeLists.FindOrAdd(ActorClass).Actors.Num() < Target)
+	{
+		// Marked as pooled before BeginPlay, so the actor skips its setup
+		AActor* Actor = SpawnInitialized(World, ActorClass, FTransform::Identity,
+			[this](AActor& Spawned) { PooledActors.Add(&Spawned); },
+			ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+		if (!Actor)
+		{
+			break;
+		}
+
+		AddToFreeList(Actor);
+		++NumAdded;
+	}
+
+	if (NumAdded > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("GridActorPool: Prewarmed %d %s"), NumAdded, *ActorClass->GetName());
+	}
+}
+
+void UGridActorPool::PrewarmFromMapData(const FMapData& MapData, const TArray<TSubclassOf<AActor>>& PerTillableTileClasses)
+{
+	// Explicit tillable tiles, plus the unlisted ones if tillable is the default
+	int32 NumTillable = 0;
+	for (const FMapTerrainTile& Tile : MapData.Terrain)
+	{
+		if (Tile.Type == ETerrainType::Tillable)
+		{
+			++NumTillable;
+		}
+	}
+	if (FMapTerrainTile::ParseTerrainType(MapData.DefaultTerrain) == ETerrainType::Tillable)
+	{
+		NumTillable += FMath::Max(0, MapData.Grid.Width * MapData.Grid.Height - MapData.Terrain.Num());
+	}
+
+	const int32 Count = FMath::Min(NumTillable, MaxPrewarmPerClass);
+	for (const TSubclassOf<AActor>& ActorClass : PerTillableTileClasses)
+	{
+		PrewarmClass(ActorClass, Count);
+	}
+}
+
+void UGridActorPool::EmptyPool()
+{
+	for (TPair<UClass*, FGridActorFreeList>& Pair : FreeLists)
+	{
+		for (AActor* Actor : Pair.Value.Actors)
+		{
+			if (IsValid(Actor))
+			{
+				Actor->Destroy();
+			}
+		}
+	}
+	FreeLists.Empty();
+	PooledActors.Empty();
+}
+
+bool UGridActorPool::IsActorPooled(const AActor* Actor)
+{
+	const UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+	const UGridActorPool* Pool = World ? World->GetSubsystem<UGridActorPool>() : nullptr;
+	return Pool && Pool->PooledActors.Contains(Actor);
+}
+
+bool UGridActorPool::IsPoolableClass(const UClass* ActorClass)
+{
+	return ActorClass && ActorClass->ImplementsInterface(UGridPoolable::StaticClass());
+}
+
+AActor* UGridActorPool::AcquireOrSpawn(UWorld* World, TSubclassOf<AActor> ActorClass, const FTransform& Transform, TFunctionRef<void(AActor&)> Initialize,
+	ESpawnActorCollisionHandlingMethod CollisionHandling)
+{
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (UGridActorPool* Pool = World->GetSubsystem<UGridActorPool>())
+	{
+		return Pool->AcquireActorDeferred(ActorClass, Transform, Initialize, CollisionHandling);
+	}
+	return SpawnInitialized(World, ActorClass, Transform, Initialize, CollisionHandling);
+}
+
+void UGridActorPool::ReleaseOrDestroy(AActor* Actor)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	if (UGridActorPool* Pool = Actor->GetWorld() ? Actor->GetWorld()->GetSubsystem<UGridActorPool>() : nullptr)
+	{
+		Pool->ReleaseActor(Actor);
+	}
+	else
+	{
+		Actor->Destroy();
+	}
+}
+
+AActor* UGridActorPool::SpawnInitialized(UWorld* World, TSubclassOf<AActor> ActorClass, const FTransform& Transform, TFunctionRef<void(AActor&)> Initialize,
+	ESpawnActorCollisionHandlingMethod CollisionHandling)
+{
+	if (!ActorClass)
+	{
+		return nullptr;
+	}
+
+	AActor* Actor = World->SpawnActorDeferred<AActor>(ActorClass, Transform, nullptr, nullptr, CollisionHandling);
+	if (Actor)
+	{
+		Initialize(*Actor);
+		Actor->FinishSpawning(Transform);
+	}
+	return Actor;
+}
+
+void UGridActorPool::LogStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("GridActorPool: %d idle actors, %d acquires reused an actor, %d spawned one"),
+		PooledActors.Num(), NumReused, NumSpawned);
+	for (const TPair<UClass*, FGridActorFreeList>& Pair : FreeLists)
+	{
+		UE_LOG(LogTemp, Log, TEXT("  %s: %d idle"), Pair.Key ? *Pair.Key->GetName() : TEXT("<none>"), Pair.Value.Actors.Num());
+	}
+}
@@ -0,0 +1,121 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "UObject/ObjectKey.h"
+#include "GridActorPool.generated.h"
+
+struct FMapData;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnGridActorReleased, AActor* /*Actor*/);
+
+/** Actors of one class waiting in the pool */
+USTRUCT()
+struct FGridActorFreeList
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<AActor*> Actors;
+};
+
+/**
+ * World subsystem recycling grid placeables (crops, tilled soil, trees, ...) through per-class
+ * free lists, so planting, harvesting, chopping and save reloads don't spawn and destroy actors.
+ *
+ * Only classes implementing IGridPoolable are pooled; anything else released is destroyed and
+ * anything else acquired is spawned, so callers can route every placeable through here. Pooled
+ * actors stay alive (no EndPlay/BeginPlay), hidden, without collision and off the grid.
+ * Game worlds only: in editor worlds use AcquireOrSpawn / ReleaseOrDestroy, which fall back to
+ * plain spawning and destruction.
+ */
+UCLASS()
+class HOBUNJIHOLLOW_API UGridActorPool : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Most actors kept per class; releases beyond this destroy the actor */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pooling", meta = (ClampMin = "0"))
+	int32 MaxPooledPerClass = 512;
+
+	/** Most actors PrewarmFromMapData spawns per class */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pooling", meta = (ClampMin = "0"))
+	int32 MaxPrewarmPerClass = 64;
+
+	/** Take an actor of ActorClass from the pool (spawning one if the pool is empty) and place it at Transform */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Pooling", meta = (DeterminesOutputType = "ActorClass"))
+	AActor* AcquireActor(TSubclassOf<AActor> ActorClass, const FTransform& Transform);
+
+	/**
+	 * As AcquireActor, but Initialize runs before the actor becomes active: before BeginPlay for
+	 * a new actor, before OnAcquiredFromPool for a recycled one. Set state there that
+	 * registration should see. CollisionHandling only applies when a new actor is spawned.
+	 */
+	AActor* AcquireActorDeferred(TSubclassOf<AActor> ActorClass, const FTransform& Transform, TFunctionRef<void(AActor&)> Initialize,
+		ESpawnActorCollisionHandlingMethod CollisionHandling = ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+
+	/** Return an actor to the pool (destroyed if its class isn't poolable or its free list is full) */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Pooling")
+	void ReleaseActor(AActor* Actor);
+
+	/** Broadcast as ReleaseActor takes an actor out of play, so owners can drop their references before it is reused */
+	FOnGridActorReleased OnActorReleased;
+
+	/** Fill the pool for ActorClass up to Count idle actors */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Pooling")
+	void PrewarmClass(TSubclassOf<AActor> ActorClass, int32 Count);
+
+	/**
+	 * Prewarm each of PerTillableTileClasses (e.g. tilled soil and crops) with one actor per tillable
+	 * tile in MapData, capped at MaxPrewarmPerClass.
+	 */
+	void PrewarmFromMapData(const FMapData& MapData, const TArray<TSubclassOf<AActor>>& PerTillableTileClasses);
+
+	/** Destroy every idle actor */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Pooling")
+	void EmptyPool();
+
+	/** True while Actor is idle in a pool */
+	UFUNCTION(BlueprintPure, Category = "Grid|Pooling")
+	static bool IsActorPooled(const AActor* Actor);
+
+	static bool IsPoolableClass(const UClass* ActorClass);
+
+	/** Acquire from World's pool, or spawn if it has none */
+	static AActor* AcquireOrSpawn(UWorld* World, TSubclassOf<AActor> ActorClass, const FTransform& Transform, TFunctionRef<void(AActor&)> Initialize,
+		ESpawnActorCollisionHandlingMethod CollisionHandling = ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+
+	/** Release to the actor's world pool, or destroy if it has none */
+	static void ReleaseOrDestroy(AActor* Actor);
+
+	/** Idle actor counts per class to the log */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Pooling")
+	void LogStats() const;
+
+	UFUNCTION(BlueprintPure, Category = "Grid|Pooling")
+	int32 GetNumPooled() const { return PooledActors.Num(); }
+
+protected:
+	UPROPERTY()
+	TMap<UClass*, FGridActorFreeList> FreeLists;
+
+	/** Every idle actor, for IsActorPooled */
+	TSet<TObjectKey<AActor>> PooledActors;
+
+	/** Actors reused / newly spawned by AcquireActor, for LogStats */
+	int32 NumReused = 0;
+	int32 NumSpawned = 0;
+
+	/** Hide the actor, take it off the grid and add it to its free list */
+	void AddToFreeList(AActor* Actor);
+
+	/** Deferred spawn with Initialize run before BeginPlay */
+	static AActor* SpawnInitialized(UWorld* World, TSubclassOf<AActor> ActorClass, const FTransform& Transform, TFunctionRef<void(AActor&)> Initialize,
+		ESpawnActorCollisionHandlingMethod CollisionHandling);
+};
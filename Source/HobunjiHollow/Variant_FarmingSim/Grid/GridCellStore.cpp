@@ -0,0 +1,268 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GridCellStore.h"
+
+FGridCellStore::FChunk::FChunk(ETerrainType InDefaultTerrain)
+{
+	FMemory::Memset(Terrain, static_cast<uint8>(InDefaultTerrain), sizeof(Terrain));
+}
+
+void FGridCellStore::Initialize(int32 InWidth, int32 InHeight, ETerrainType InDefaultTerrain)
+{
+	Reset();
+
+	Width = FMath::Max(0, InWidth);
+	Height = FMath::Max(0, InHeight);
+	DefaultTerrain = InDefaultTerrain;
+	ChunksX = (Width + ChunkMask) >> ChunkShift;
+	ChunksY = (Height + ChunkMask) >> ChunkShift;
+
+	Chunks.SetNum(ChunksX * ChunksY);
+}
+
+void FGridCellStore::Reset()
+{
+	Chunks.Empty();
+	Width = 0;
+	Height = 0;
+	ChunksX = 0;
+	ChunksY = 0;
+	DefaultTerrain = ETerrainType::Default;
+}
+
+const FGridCellStore::FChunk* FGridCellStore::FindChunk(int32 X, int32 Y) const
+{
+	return IsInBounds(X, Y) ? Chunks[GetChunkIndex(X, Y)].Get() : nullptr;
+}
+
+FGridCellStore::FChunk& FGridCellStore::FindOrAddChunk(int32 X, int32 Y)
+{
+	TUniquePtr<FChunk>& Chunk = Chunks[GetChunkIndex(X, Y)];
+	if (!Chunk)
+	{
+		Chunk = MakeUnique<FChunk>(DefaultTerrain);
+	}
+	return *Chunk;
+}
+
+// ---- Reads ----
+
+ETerrainType FGridCellStore::GetTerrain(int32 X, int32 Y) const
+{
+	const FChunk* Chunk = FindChunk(X, Y);
+	return Chunk ? Chunk->Terrain[GetLocalIndex(X, Y)] : DefaultTerrain;
+}
+
+bool FGridCellStore::IsTilled(int32 X, int32 Y) const
+{
+	const FChunk* Chunk = FindChunk(X, Y);
+	return Chunk && TestBit(Chunk->TilledBits, GetLocalIndex(X, Y));
+}
+
+bool FGridCellStore::IsWatered(int32 X, int32 Y) const
+{
+	const FChunk* Chunk = FindChunk(X, Y);
+	return Chunk && TestBit(Chunk->WateredBits, GetLocalIndex(X, Y));
+}
+
+AActor* FGridCellStore::GetOccupant(int32 X, int32 Y) const
+{
+	const FChunk* Chunk = FindChunk(X, Y);
+	if (!Chunk || Chunk->NumOccupied == 0)
+	{
+		return nullptr;
+	}
+
+	const int32 Local = GetLocalIndex(X, Y);
+	return TestBit(Chunk->OccupiedBits, Local) ? Chunk->Occupants[Local].Get() : nullptr;
+}
+
+FGridCell FGridCellStore::GetCell(int32 X, int32 Y) const
+{
+	FGridCell Cell;
+	Cell.TerrainType = DefaultTerrain;
+
+	const FChunk* Chunk = FindChunk(X, Y);
+	if (Chunk)
+	{
+		const int32 Local = GetLocalIndex(X, Y);
+		Cell.TerrainType = Chunk->Terrain[Local];
+		Cell.bIsTilled = TestBit(Chunk->TilledBits, Local);
+		Cell.bIsWatered = TestBit(Chunk->WateredBits, Local);
+		if (TestBit(Chunk->OccupiedBits, Local))
+		{
+			Cell.OccupyingActor = Chunk->Occupants[Local];
+		}
+	}
+
+	return Cell;
+}
+
+// ---- Writes ----
+
+void FGridCellStore::SetTerrain(int32 X, int32 Y, ETerrainType Terrain)
+{
+	if (!IsInBounds(X, Y))
+	{
+		return;
+	}
+
+	// Writing the default into an untouched chunk is a no-op
+	if (!Chunks[GetChunkIndex(X, Y)] && Terrain == DefaultTerrain)
+	{
+		return;
+	}
+
+	FindOrAddChunk(X, Y).Terrain[GetLocalIndex(X, Y)] = Terrain;
+}
+
+void FGridCellStore::SetTilled(int32 X, int32 Y, bool bTilled)
+{
+	if (!IsInBounds(X, Y) || (!bTilled && !Chunks[GetChunkIndex(X, Y)]))
+	{
+		return;
+	}
+
+	WriteBit(FindOrAddChunk(X, Y).TilledBits, GetLocalIndex(X, Y), bTilled);
+}
+
+void FGridCellStore::SetWatered(int32 X, int32 Y, bool bWatered)
+{
+	if (!IsInBounds(X, Y) || (!bWatered && !Chunks[GetChunkIndex(X, Y)]))
+	{
+		return;
+	}
+
+	FChunk& Chunk = FindOrAddChunk(X, Y);
+	if (WriteBit(Chunk.WateredBits, GetLocalIndex(X, Y), bWatered))
+	{
+		Chunk.NumWatered += bWatered ? 1 : -1;
+	}
+}
+
+void FGridCellStore::SetOccupant(int32 X, int32 Y, AActor* Actor)
+{
+	if (!Actor)
+	{
+		ClearOccupant(X, Y);
+		return;
+	}
+
+	if (!IsInBounds(X, Y))
+	{
+		return;
+	}
+
+	FChunk& Chunk = FindOrAddChunk(X, Y);
+	if (Chunk.Occupants.Num() == 0)
+	{
+		Chunk.Occupants.SetNum(CellsPerChunk);
+	}
+
+	const int32 Local = GetLocalIndex(X, Y);
+	if (WriteBit(Chunk.OccupiedBits, Local, true))
+	{
+		++Chunk.NumOccupied;
+	}
+	Chunk.Occupants[Local] = Actor;
+}
+
+void FGridCellStore::ClearOccupantSlot(FChunk& Chunk, int32 Local)
+{
+	if (WriteBit(Chunk.OccupiedBits, Local, false))
+	{
+		--Chunk.NumOccupied;
+	}
+	Chunk.Occupants[Local].Reset();
+}
+
+bool FGridCellStore::ClearOccupant(int32 X, int32 Y)
+{
+	if (!IsInBounds(X, Y))
+	{
+		return false;
+	}
+
+	FChunk* Chunk = Chunks[GetChunkIndex(X, Y)].Get();
+	const int32 Local = GetLocalIndex(X, Y);
+	if (!Chunk || !TestBit(Chunk->OccupiedBits, Local))
+	{
+		return false;
+	}
+
+	const bool bWasLive = Chunk->Occupants[Local].IsValid();
+	ClearOccupantSlot(*Chunk, Local);
+	return bWasLive;
+}
+
+void FGridCellStore::ClearAllWatered()
+{
+	for (const TUniquePtr<FChunk>& Chunk : Chunks)
+	{
+		if (Chunk && Chunk->NumWatered > 0)
+		{
+			FMemory::Memzero(Chunk->WateredBits, sizeof(Chunk->WateredBits));
+			Chunk->NumWatered = 0;
+		}
+	}
+}
+
+int32 FGridCellStore::ClearAllOccupiedBy(const AActor* Actor)
+{
+	if (!Actor)
+	{
+		return 0;
+	}
+
+	int32 NumCleared = 0;
+	for (const TUniquePtr<FChunk>& Chunk : Chunks)
+	{
+		if (!Chunk || Chunk->NumOccupied == 0)
+		{
+			continue;
+		}
+
+		for (int32 Word = 0; Word < WordsPerChunk; ++Word)
+		{
+			uint64 Bits = Chunk->OccupiedBits[Word];
+			while (Bits)
+			{
+				const int32 Local = Word * 64 + static_cast<int32>(FMath::CountTrailingZeros64(Bits));
+				Bits &= Bits - 1;
+
+				if (Chunk->Occupants[Local].Get() == Actor)
+				{
+					ClearOccupantSlot(*Chunk, Local);
+					++NumCleared;
+				}
+			}
+		}
+	}
+
+	return NumCleared;
+}
+
+// ---- Stats ----
+
+int32 FGridCellStore::GetNumAllocatedChunks() const
+{
+	int32 Count = 0;
+	for (const TUniquePtr<FChunk>& Chunk : Chunks)
+	{
+		Count += Chunk ? 1 : 0;
+	}
+	return Count;
+}
+
+SIZE_T FGridCellStore::GetAllocatedSize() const
+{
+	SIZE_T Size = Chunks.GetAllocatedSize();
+	for (const TUniquePtr<FChunk>& Chunk : Chunks)
+	{
+		if (Chunk)
+		{
+			Size += sizeof(FChunk) + Chunk->Occupants.GetAllocatedSize();
+		}
+	}
+	return Size;
+}
@@ -0,0 +1,169 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GridTypes.h"
+
+/**
+ * Dense, chunked storage for per-tile grid state.
+ *
+ * The grid is split into 16x16 chunks that are allocated on first write.
+ * Unallocated chunks read back as the default terrain, so sparse maps stay cheap.
+ * Inside a chunk, terrain is a flat byte array and the tilled/watered/occupied
+ * flags are packed bitmasks, which keeps whole-map sweeps on contiguous memory.
+ *
+ * The store is 2D - the Z layer of FGridCoordinate is ignored.
+ */
+class HOBUNJIHOLLOW_API FGridCellStore
+{
+public:
+	static constexpr int32 ChunkShift = 4;
+	static constexpr int32 ChunkSize = 1 << ChunkShift;
+	static constexpr int32 ChunkMask = ChunkSize - 1;
+	static constexpr int32 CellsPerChunk = ChunkSize * ChunkSize;
+	static constexpr int32 WordsPerChunk = CellsPerChunk / 64;
+
+	/** Size the store for a grid and drop all existing cells */
+	void Initialize(int32 InWidth, int32 InHeight, ETerrainType InDefaultTerrain);
+
+	/** Release all chunks */
+	void Reset();
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+	ETerrainType GetDefaultTerrain() const { return DefaultTerrain; }
+
+	FORCEINLINE bool IsInBounds(int32 X, int32 Y) const
+	{
+		return static_cast<uint32>(X) < static_cast<uint32>(Width) && static_cast<uint32>(Y) < static_cast<uint32>(Height);
+	}
+
+	// ---- Reads ----
+
+	ETerrainType GetTerrain(int32 X, int32 Y) const;
+	bool IsTilled(int32 X, int32 Y) const;
+	bool IsWatered(int32 X, int32 Y) const;
+
+	/** Occupying actor, or nullptr if empty or the actor has been destroyed */
+	AActor* GetOccupant(int32 X, int32 Y) const;
+
+	/** Assemble a full cell snapshot (default cell if never written) */
+	FGridCell GetCell(int32 X, int32 Y) const;
+
+	// ---- Writes (out-of-bounds writes are ignored) ----
+
+	void SetTerrain(int32 X, int32 Y, ETerrainType Terrain);
+	void SetTilled(int32 X, int32 Y, bool bTilled);
+	void SetWatered(int32 X, int32 Y, bool bWatered);
+	void SetOccupant(int32 X, int32 Y, AActor* Actor);
+
+	/** Clear the occupant at a cell. Returns true if a live occupant was cleared. */
+	bool ClearOccupant(int32 X, int32 Y);
+
+	/** Clear the watered flag on every cell */
+	void ClearAllWatered();
+
+	/** Clear every cell occupied by Actor. Returns the number of cells cleared. */
+	int32 ClearAllOccupiedBy(const AActor* Actor);
+
+	/** Visit every cell with a live occupant */
+	template <typename FuncType>
+	void ForEachOccupiedCell(FuncType&& Func) const
+	{
+		for (int32 ChunkIndex = 0; ChunkIndex < Chunks.Num(); ++ChunkIndex)
+		{
+			const FChunk* Chunk = Chunks[ChunkIndex].Get();
+			if (!Chunk || Chunk->NumOccupied == 0)
+			{
+				continue;
+			}
+
+			for (int32 Word = 0; Word < WordsPerChunk; ++Word)
+			{
+				uint64 Bits = Chunk->OccupiedBits[Word];
+				while (Bits)
+				{
+					const int32 Bit = static_cast<int32>(FMath::CountTrailingZeros64(Bits));
+					Bits &= Bits - 1;
+
+					const int32 Local = Word * 64 + Bit;
+					if (AActor* Actor = Chunk->Occupants[Local].Get())
+					{
+						int32 X, Y;
+						ToGrid(ChunkIndex, Local, X, Y);
+						Func(X, Y, Actor);
+					}
+				}
+			}
+		}
+	}
+
+	// ---- Stats ----
+
+	int32 GetNumAllocatedChunks() const;
+
+	/** Heap bytes owned by the store */
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	struct FChunk
+	{
+		ETerrainType Terrain[CellsPerChunk];
+		uint64 TilledBits[WordsPerChunk] = {};
+		uint64 WateredBits[WordsPerChunk] = {};
+		uint64 OccupiedBits[WordsPerChunk] = {};
+
+		/** Allocated on first placement in this chunk */
+		TArray<TWeakObjectPtr<AActor>> Occupants;
+
+		int32 NumWatered = 0;
+		int32 NumOccupied = 0;
+
+		explicit FChunk(ETerrainType InDefaultTerrain);
+	};
+
+	FORCEINLINE int32 GetChunkIndex(int32 X, int32 Y) const
+	{
+		return (Y >> ChunkShift) * ChunksX + (X >> ChunkShift);
+	}
+
+	FORCEINLINE static int32 GetLocalIndex(int32 X, int32 Y)
+	{
+		return ((Y & ChunkMask) << ChunkShift) | (X & ChunkMask);
+	}
+
+	FORCEINLINE static bool TestBit(const uint64* Bits, int32 Local)
+	{
+		return (Bits[Local >> 6] & (1ULL << (Local & 63))) != 0;
+	}
+
+	/** Set or clear a bit; returns true if the bit changed */
+	FORCEINLINE static bool WriteBit(uint64* Bits, int32 Local, bool bValue)
+	{
+		const uint64 Mask = 1ULL << (Local & 63);
+		uint64& Word = Bits[Local >> 6];
+		const bool bWasSet = (Word & Mask) != 0;
+		Word = bValue ? (Word | Mask) : (Word & ~Mask);
+		return bWasSet != bValue;
+	}
+
+	void ToGrid(int32 ChunkIndex, int32 Local, int32& OutX, int32& OutY) const
+	{
+		OutX = ((ChunkIndex % ChunksX) << ChunkShift) | (Local & ChunkMask);
+		OutY = ((ChunkIndex / ChunksX) << ChunkShift) | (Local >> ChunkShift);
+	}
+
+	const FChunk* FindChunk(int32 X, int32 Y) const;
+	FChunk& FindOrAddChunk(int32 X, int32 Y);
+
+	/** Clear a single occupied slot, keeping counts in sync */
+	static void ClearOccupantSlot(FChunk& Chunk, int32 Local);
+
+	TArray<TUniquePtr<FChunk>> Chunks;
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 ChunksX = 0;
+	int32 ChunksY = 0;
+	ETerrainType DefaultTerrain = ETerrainType::Default;
+};
@@ -0,0 +1,303 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GridDebugCommands.h"
+#include "GridCellStore.h"
+#include "FarmGridManager.h"
+#include "GridTileRenderer.h"
+#include "GridActorPool.h"
+#include "CropSimulation.h"
+#include "Engine/World.h"
+#include "GridTypes.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+void UGridDebugCommands::BenchmarkCellStorage(int32 GridSize, int32 NumQueries)
+{
+	GridSize = FMath::Max(1, GridSize);
+	NumQueries = FMath::Max(1, NumQueries);
+
+	const int32 NumCells = GridSize * GridSize;
+
+	// Fully tilled farm: every cell written, a quarter watered, every eighth occupied
+	// (the occupant is never dereferenced, so the CDO stands in for a real actor)
+	AActor* Occupant = GetMutableDefault<AActor>();
+
+	TMap<FGridCoordinate, FGridCell> MapCells;
+	MapCells.Reserve(NumCells);
+
+	FGridCellStore StoreCells;
+	StoreCells.Initialize(GridSize, GridSize, ETerrainType::Default);
+
+	for (int32 Y = 0; Y < GridSize; ++Y)
+	{
+		for (int32 X = 0; X < GridSize; ++X)
+		{
+			const int32 Index = Y * GridSize + X;
+
+			FGridCell Cell;
+			Cell.TerrainType = ETerrainType::Tillable;
+			Cell.bIsTilled = true;
+			Cell.bIsWatered = (Index % 4) == 0;
+			if ((Index % 8) == 0)
+			{
+				Cell.OccupyingActor = Occupant;
+			}
+			MapCells.Add(FGridCoordinate(X, Y), Cell);
+
+			StoreCells.SetTerrain(X, Y, ETerrainType::Tillable);
+			StoreCells.SetTilled(X, Y, true);
+			StoreCells.SetWatered(X, Y, Cell.bIsWatered);
+			if ((Index % 8) == 0)
+			{
+				StoreCells.SetOccupant(X, Y, Occupant);
+			}
+		}
+	}
+
+	FRandomStream Random(GridSize);
+	TArray<FIntPoint> Queries;
+	Queries.SetNumUninitialized(NumQueries);
+	for (FIntPoint& Query : Queries)
+	{
+		Query.X = Random.RandRange(0, GridSize - 1);
+		Query.Y = Random.RandRange(0, GridSize - 1);
+	}
+
+	// Walkability query: terrain + occupancy, as IsTileWalkable does
+	int32 MapWalkable = 0;
+	double StartTime = FPlatformTime::Seconds();
+	for (const FIntPoint& Query : Queries)
+	{
+		const FGridCell* Cell = MapCells.Find(FGridCoordinate(Query.X, Query.Y));
+		MapWalkable += (Cell && Cell->IsWalkable()) ? 1 : 0;
+	}
+	const double MapQuerySeconds = FPlatformTime::Seconds() - StartTime;
+
+	int32 StoreWalkable = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (const FIntPoint& Query : Queries)
+	{
+		const ETerrainType Terrain = StoreCells.GetTerrain(Query.X, Query.Y);
+		const bool bWalkable = Terrain != ETerrainType::Blocked && Terrain != ETerrainType::Water
+			&& StoreCells.GetOccupant(Query.X, Query.Y) == nullptr;
+		StoreWalkable += bWalkable ? 1 : 0;
+	}
+	const double StoreQuerySeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Whole-map sweeps
+	StartTime = FPlatformTime::Seconds();
+	for (auto& Pair : MapCells)
+	{
+		Pair.Value.bIsWatered = false;
+	}
+	const double MapSweepSeconds = FPlatformTime::Seconds() - StartTime;
+
+	StartTime = FPlatformTime::Seconds();
+	StoreCells.ClearAllWatered();
+	const double StoreSweepSeconds = FPlatformTime::Seconds() - StartTime;
+
+	const double MapBytes = static_cast<double>(MapCells.GetAllocatedSize());
+	const double StoreBytes = static_cast<double>(StoreCells.GetAllocatedSize());
+
+	UE_LOG(LogTemp, Log, TEXT("========== CELL STORAGE BENCHMARK %dx%d =========="), GridSize, GridSize);
+	UE_LOG(LogTemp, Log, TEXT("Queries: %d (walkable: map=%d store=%d)"), NumQueries, MapWalkable, StoreWalkable);
+	UE_LOG(LogTemp, Log, TEXT("TMap:  %.2f ns/query, ClearAllWatered %.3f ms, %.1f KB"),
+		MapQuerySeconds * 1e9 / NumQueries, MapSweepSeconds * 1000.0, MapBytes / 1024.0);
+	UE_LOG(LogTemp, Log, TEXT("Dense: %.2f ns/query, ClearAllWatered %.3f ms, %.1f KB (%d chunks)"),
+		StoreQuerySeconds * 1e9 / NumQueries, StoreSweepSeconds * 1000.0, StoreBytes / 1024.0, StoreCells.GetNumAllocatedChunks());
+	UE_LOG(LogTemp, Log, TEXT("Speedup: query x%.2f, sweep x%.2f, memory x%.2f smaller"),
+		MapQuerySeconds / FMath::Max(StoreQuerySeconds, 1e-9),
+		MapSweepSeconds / FMath::Max(StoreSweepSeconds, 1e-9),
+		MapBytes / FMath::Max(StoreBytes, 1.0));
+}
+
+void UGridDebugCommands::RunCellStorageBenchmarks()
+{
+	BenchmarkCellStorage(64);
+	BenchmarkCellStorage(256);
+	BenchmarkCellStorage(1024);
+}
+
+void UGridDebugCommands::BenchmarkGridPathfinding(UObject* WorldContextObject, int32 NumPaths)
+{
+	if (!WorldContextObject)
+	{
+		return;
+	}
+
+	UWorld* World = WorldContextObject->GetWorld();
+	UFarmGridManager* GridManager = World ? World->GetSubsystem<UFarmGridManager>() : nullptr;
+	if (!GridManager)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BenchmarkGridPathfinding: no grid manager in this world"));
+		return;
+	}
+
+	const int32 Width = GridManager->GetGridWidth();
+	const int32 Height = GridManager->GetGridHeight();
+	NumPaths = FMath::Max(1, NumPaths);
+
+	// Random walkable endpoints inside playable bounds
+	FRandomStream Random(Width * 31 + Height);
+	TArray<FGridCoordinate> Endpoints;
+	const int32 MaxAttempts = NumPaths * 2 * 50;
+	for (int32 Attempt = 0; Attempt < MaxAttempts && Endpoints.Num() < NumPaths * 2; ++Attempt)
+	{
+		const FGridCoordinate Coord(Random.RandRange(0, FMath::Max(0, Width - 1)), Random.RandRange(0, FMath::Max(0, Height - 1)));
+		if (GridManager->IsTileWalkable(Coord) && GridManager->IsInPlayableBounds(Coord))
+		{
+			Endpoints.Add(Coord);
+		}
+	}
+
+	const int32 NumPairs = Endpoints.Num() / 2;
+	if (NumPairs == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("BenchmarkGridPathfinding: no walkable tiles on a %dx%d grid"), Width, Height);
+		return;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("========== GRID PATHFINDING BENCHMARK %dx%d =========="), Width, Height);
+	UE_LOG(LogTemp, Log, TEXT("Pairs: %d"), NumPairs);
+
+	TArray<FGridCoordinate> Path;
+	auto RunPass = [&](EGridPathSearchMode Mode, const TCHAR* Label)
+	{
+		FGridPathQuery Query;
+		Query.SearchMode = Mode;
+
+		int32 Found = 0;
+		int64 TotalLength = 0;
+		int64 TotalExpanded = 0;
+
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Pair = 0; Pair < NumPairs; ++Pair)
+		{
+			if (GridManager->FindGridPath(Endpoints[Pair * 2], Endpoints[Pair * 2 + 1], Query, Path))
+			{
+				++Found;
+				TotalLength += Path.Num();
+			}
+			TotalExpanded += GridManager->GetLastPathExpandedTiles();
+		}
+		const double Seconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-9);
+
+		UE_LOG(LogTemp, Log, TEXT("%s: %.0f paths/sec (%.3f ms/path), found %d/%d, avg length %.1f, avg expanded %.0f"),
+			Label, NumPairs / Seconds, Seconds * 1000.0 / NumPairs, Found, NumPairs,
+			Found > 0 ? static_cast<double>(TotalLength) / Found : 0.0,
+			static_cast<double>(TotalExpanded) / NumPairs);
+	};
+
+	RunPass(EGridPathSearchMode::Flat, TEXT("Flat A*     "));
+
+	// First hierarchical query builds the cluster layer; time that on its own
+	{
+		FGridPathQuery Query;
+		Query.SearchMode = EGridPathSearchMode::Hierarchical;
+		const double StartTime = FPlatformTime::Seconds();
+		GridManager->FindGridPath(Endpoints[0], Endpoints[1], Query, Path);
+		UE_LOG(LogTemp, Log, TEXT("Cluster layer build + first query: %.3f ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+	}
+
+	RunPass(EGridPathSearchMode::Hierarchical, TEXT("Hierarchical"));
+}
+
+void UGridDebugCommands::LogTileRendererStats(UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UFarmGridManager* GridManager = World ? World->GetSubsystem<UFarmGridManager>() : nullptr;
+	AGridTileRenderer* Renderer = GridManager ? GridManager->FindTileRenderer() : nullptr;
+	if (!Renderer)
+	{
+		UE_LOG(LogTemp, Log, TEXT("LogTileRendererStats: no tile renderer in this world"));
+		return;
+	}
+
+	Renderer->LogStats();
+}
+
+void UGridDebugCommands::LogActorPoolStats(UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGridActorPool* Pool = World ? World->GetSubsystem<UGridActorPool>() : nullptr;
+	if (!Pool)
+	{
+		UE_LOG(LogTemp, Log, TEXT("LogActorPoolStats: no actor pool in this world"));
+		return;
+	}
+
+	Pool->LogStats();
+}
+
+void UGridDebugCommands::BenchmarkCropSimulation(int32 NumCrops, int32 NumDays)
+{
+	NumCrops = FMath::Max(1, NumCrops);
+	NumDays = FMath::Max(1, NumDays);
+
+	// Mixed farm: varied maturity, a third die without water, a quarter are single-season
+	FRandomStream Random(NumCrops);
+	FCropSimulation Simulation;
+	TArray<FCropGrowthRules> ScalarRules;
+	TArray<FCropDayState> ScalarStates;
+	ScalarRules.Reserve(NumCrops);
+	ScalarStates.Reserve(NumCrops);
+	for (int32 Index = 0; Index < NumCrops; ++Index)
+	{
+		FCropGrowthRules Rules;
+		Rules.DaysToMature = Random.RandRange(4, 13);
+		Rules.bDiesWithoutWater = (Index % 3) == 0;
+		Rules.ValidSeasonMask = (Index % 4) == 0 ? 1u : 0u;
+
+		FCropDayState State;
+		Simulation.Add(NAME_None, FIntPoint(Index % 1024, Index / 1024), Rules, State);
+		ScalarRules.Add(Rules);
+		ScalarStates.Add(State);
+	}
+
+	TArray<FCropStageChange> Changes;
+	double SimulationSeconds = 0.0;
+	double ScalarSeconds = 0.0;
+	int32 TotalChanges = 0;
+	for (int32 Day = 0; Day < NumDays; ++Day)
+	{
+		// Water most crops each day (both copies identically)
+		for (int32 Index = 0; Index < NumCrops; ++Index)
+		{
+			if (((Index + Day) % 5) != 0)
+			{
+				FCropDayState State = Simulation.GetState(Index);
+				State.bWateredToday = true;
+				Simulation.SetState(Index, State);
+				ScalarStates[Index].bWateredToday = true;
+			}
+		}
+
+		const int32 Season = Day / 7;
+
+		Changes.Reset();
+		double StartTime = FPlatformTime::Seconds();
+		Simulation.AdvanceDay(Season, Changes);
+		SimulationSeconds += FPlatformTime::Seconds() - StartTime;
+		TotalChanges += Changes.Num();
+
+		StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < NumCrops; ++Index)
+		{
+			FCropSimulation::AdvanceCropDay(ScalarStates[Index], ScalarRules[Index], Season);
+		}
+		ScalarSeconds += FPlatformTime::Seconds() - StartTime;
+	}
+
+	int32 Mismatches = 0;
+	for (int32 Index = 0; Index < NumCrops; ++Index)
+	{
+		const FCropDayState State = Simulation.GetState(Index);
+		Mismatches += (State.Stage != ScalarStates[Index].Stage || State.DaysGrown != ScalarStates[Index].DaysGrown) ? 1 : 0;
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("========== CROP SIMULATION BENCHMARK %d crops x %d days =========="), NumCrops, NumDays);
+	UE_LOG(LogTemp, Log, TEXT("AdvanceDay:  %.1f us/day (%d stage changes total)"), SimulationSeconds * 1e6 / NumDays, TotalChanges);
+	UE_LOG(LogTemp, Log, TEXT("Scalar loop: %.1f us/day"), ScalarSeconds * 1e6 / NumDays);
+	UE_LOG(LogTemp, Log, TEXT("Store: %.1f KB, %d mismatches against the scalar loop"),
+		static_cast<double>(Simulation.GetAllocatedSize()) / 1024.0, Mismatches);
+}
@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "GridDebugCommands.generated.h"
+
+/**
+ * Blueprint function library providing debug and benchmark commands for the grid system.
+ * Results are written to the log.
+ */
+UCLASS()
+class HOBUNJIHOLLOW_API UGridDebugCommands : public UBlueprintFunctionLibrary
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Compare per-query latency and memory of the dense cell store against a
+	 * TMap<FGridCoordinate, FGridCell> on a fully tilled square grid.
+	 * @param GridSize Width and height of the grid in cells
+	 * @param NumQueries Number of random tile queries to time
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grid Debug")
+	static void BenchmarkCellStorage(int32 GridSize = 256, int32 NumQueries = 1000000);
+
+	/** Run BenchmarkCellStorage on 64x64, 256x256 and 1024x1024 grids */
+	UFUNCTION(BlueprintCallable, Category = "Grid Debug")
+	static void RunCellStorageBenchmarks();
+
+	/**
+	 * Time FindGridPath between random walkable tile pairs on the map loaded in the
+	 * current world, once with flat A* and once with the hierarchical layer.
+	 * @param NumPaths Number of random start/goal pairs
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grid Debug", meta = (WorldContext = "WorldContextObject"))
+	static void BenchmarkGridPathfinding(UObject* WorldContextObject, int32 NumPaths = 1000);
+
+	/**
+	 * Time FCropSimulation::AdvanceDay on synthetic crops (no actors), comparing the
+	 * ParallelFor kernel with a single-threaded loop over the same rules.
+	 * @param NumCrops Number of crops to simulate
+	 * @param NumDays Number of days to advance
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Grid Debug")
+	static void BenchmarkCropSimulation(int32 NumCrops = 100000, int32 NumDays = 28);
+
+	/** Log how many soil/crop instances the tile renderer draws, per mesh batch */
+	UFUNCTION(BlueprintCallable, Category = "Grid Debug", meta = (WorldContext = "WorldContextObject"))
+	static void LogTileRendererStats(UObject* WorldContextObject);
+
+	/** Log idle actors per class in the grid actor pool, and how often acquires reused one */
+	UFUNCTION(BlueprintCallable, Category = "Grid Debug", meta = (WorldContext = "WorldContextObject"))
+	static void LogActorPoolStats(UObject* WorldContextObject);
+};
@@ -0,0 +1,79 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GridHeightCache.h"
+
+void FGridHeightCache::Initialize(int32 InWidth, int32 InHeight, bool bInStoreNormals)
+{
+	Reset();
+
+	Width = FMath::Max(0, InWidth);
+	Height = FMath::Max(0, InHeight);
+	bStoreNormals = bInStoreNormals;
+
+	const int32 NumTiles = Width * Height;
+	Heights.SetNumZeroed(NumTiles);
+	if (bStoreNormals)
+	{
+		Normals.Init(FVector3f::UpVector, NumTiles);
+	}
+	Sampled.Init(false, NumTiles);
+}
+
+void FGridHeightCache::Reset()
+{
+	Width = 0;
+	Height = 0;
+	NumSampled = 0;
+	bStoreNormals = false;
+	Heights.Empty();
+	Normals.Empty();
+	Sampled.Empty();
+}
+
+void FGridHeightCache::SetSample(int32 X, int32 Y, float InHeight, const FVector& InNormal)
+{
+	const int32 Index = Y * Width + X;
+	Heights[Index] = InHeight;
+	if (bStoreNormals)
+	{
+		Normals[Index] = FVector3f(InNormal);
+	}
+
+	if (!Sampled[Index])
+	{
+		Sampled[Index] = true;
+		++NumSampled;
+	}
+}
+
+void FGridHeightCache::Invalidate(const FIntPoint& Min, const FIntPoint& Max)
+{
+	const int32 MinX = FMath::Max(Min.X, 0);
+	const int32 MinY = FMath::Max(Min.Y, 0);
+	const int32 MaxX = FMath::Min(Max.X, Width - 1);
+	const int32 MaxY = FMath::Min(Max.Y, Height - 1);
+
+	for (int32 Y = MinY; Y <= MaxY; ++Y)
+	{
+		for (int32 X = MinX; X <= MaxX; ++X)
+		{
+			const int32 Index = Y * Width + X;
+			if (Sampled[Index])
+			{
+				Sampled[Index] = false;
+				--NumSampled;
+			}
+		}
+	}
+}
+
+void FGridHeightCache::InvalidateAll()
+{
+	Sampled.Init(false, Width * Height);
+	NumSampled = 0;
+}
+
+SIZE_T FGridHeightCache::GetAllocatedSize() const
+{
+	return Heights.GetAllocatedSize() + Normals.GetAllocatedSize() + Sampled.GetAllocatedSize();
+}
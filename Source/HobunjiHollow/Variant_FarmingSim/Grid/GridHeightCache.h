@@ -0,0 +1,56 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-tile terrain height (and optional normal) samples taken at tile centres.
+ *
+ * The cache only stores samples; UFarmGridManager fills them with line traces,
+ * either all at once (bake) or one tile at a time the first time a tile is read.
+ * Invalidated tiles are re-sampled on their next read.
+ */
+class HOBUNJIHOLLOW_API FGridHeightCache
+{
+public:
+	/** Size the cache for a grid; every tile starts unsampled */
+	void Initialize(int32 InWidth, int32 InHeight, bool bInStoreNormals);
+
+	void Reset();
+
+	int32 GetWidth() const { return Width; }
+	int32 GetHeight() const { return Height; }
+	bool StoresNormals() const { return bStoreNormals; }
+
+	FORCEINLINE bool IsInBounds(int32 X, int32 Y) const
+	{
+		return static_cast<uint32>(X) < static_cast<uint32>(Width) && static_cast<uint32>(Y) < static_cast<uint32>(Height);
+	}
+
+	bool IsSampled(int32 X, int32 Y) const { return Sampled[Y * Width + X]; }
+	int32 GetNumSampled() const { return NumSampled; }
+
+	float GetHeight(int32 X, int32 Y) const { return Heights[Y * Width + X]; }
+	FVector GetNormal(int32 X, int32 Y) const { return bStoreNormals ? FVector(Normals[Y * Width + X]) : FVector::UpVector; }
+
+	void SetSample(int32 X, int32 Y, float InHeight, const FVector& InNormal);
+
+	/** Mark tiles in [Min, Max] (inclusive, clamped to the grid) for re-sampling */
+	void Invalidate(const FIntPoint& Min, const FIntPoint& Max);
+
+	/** Mark every tile for re-sampling */
+	void InvalidateAll();
+
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 NumSampled = 0;
+	bool bStoreNormals = false;
+
+	TArray<float> Heights;
+	TArray<FVector3f> Normals;
+	TBitArray<> Sampled;
+};
@@ -0,0 +1,665 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GridPathfinder.h"
+#include "GridCellStore.h"
+#include "GridZoneIndex.h"
+#include "Algo/Reverse.h"
+
+namespace GridPathfinderPrivate
+{
+	static constexpr float DiagonalCost = UE_SQRT_2;
+
+	static const int32 NeighbourDX[8] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+	static const int32 NeighbourDY[8] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+	/** Runs shorter than this get one entrance in the middle, longer runs one at each end */
+	static constexpr int32 SplitEntranceRunLength = 6;
+
+	/** Passability the cluster layer is built for */
+	static const FGridPathQuery DefaultQuery;
+}
+
+FGridPathfinder::FGridPathfinder(const FGridCellStore& InCells, const FGridZoneIndex& InZones)
+	: Cells(InCells)
+	, Zones(InZones)
+{
+}
+
+void FGridPathfinder::Reset()
+{
+	Width = 0;
+	Height = 0;
+	Scratch.Empty();
+	OpenHeap.Empty();
+	Generation = 0;
+	LastExpandedCount = 0;
+	Clusters.Empty();
+	DirtyClusters.Empty();
+	ClustersX = 0;
+	ClustersY = 0;
+}
+
+void FGridPathfinder::MarkTileDirty(int32 X, int32 Y)
+{
+	if (Clusters.Num() == 0 || !Cells.IsInBounds(X, Y))
+	{
+		return;
+	}
+
+	const int32 ClusterIndex = (Y >> ClusterShift) * ClustersX + (X >> ClusterShift);
+	FCluster& Cluster = Clusters[ClusterIndex];
+	if (!Cluster.bDirty)
+	{
+		Cluster.bDirty = true;
+		DirtyClusters.Add(ClusterIndex);
+	}
+}
+
+int32 FGridPathfinder::GetNumAbstractNodes() const
+{
+	int32 Count = 0;
+	for (const FCluster& Cluster : Clusters)
+	{
+		Count += Cluster.Nodes.Num();
+	}
+	return Count;
+}
+
+// ---- Passability ----
+
+bool FGridPathfinder::IsTilePassable(int32 X, int32 Y, const FGridPathQuery& Query) const
+{
+	if (!Cells.IsInBounds(X, Y))
+	{
+		return false;
+	}
+
+	const ETerrainType Terrain = Cells.GetTerrain(X, Y);
+	if (Terrain == ETerrainType::Blocked || Terrain == ETerrainType::Water)
+	{
+		return false;
+	}
+
+	if (Cells.GetOccupant(X, Y) != nullptr)
+	{
+		return false;
+	}
+
+	if (Query.bStayInPlayableBounds && Zones.HasZoneType(EZoneType::Bounds) && !Zones.IsInZoneType(X, Y, EZoneType::Bounds))
+	{
+		return false;
+	}
+
+	if (Query.bAvoidRestrictedZones && Zones.IsInZoneType(X, Y, EZoneType::Restricted))
+	{
+		return false;
+	}
+
+	return true;
+}
+
+bool FGridPathfinder::IsAgentPassable(int32 X, int32 Y, const FGridPathQuery& Query) const
+{
+	const int32 AgentWidth = FMath::Max(1, Query.AgentWidth);
+	const int32 AgentHeight = FMath::Max(1, Query.AgentHeight);
+	for (int32 DY = 0; DY < AgentHeight; ++DY)
+	{
+		for (int32 DX = 0; DX < AgentWidth; ++DX)
+		{
+			if (!IsTilePassable(X + DX, Y + DY, Query))
+			{
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+float FGridPathfinder::Heuristic(int32 Cell, int32 GoalCell, bool bAllowDiagonal) const
+{
+	if (GoalCell == INDEX_NONE)
+	{
+		return 0.0f;
+	}
+
+	const FIntPoint From = ToPoint(Cell);
+	const FIntPoint To = ToPoint(GoalCell);
+	const int32 DX = FMath::Abs(From.X - To.X);
+	const int32 DY = FMath::Abs(From.Y - To.Y);
+
+	if (!bAllowDiagonal)
+	{
+		return static_cast<float>(DX + DY);
+	}
+
+	// Octile distance
+	return static_cast<float>(FMath::Max(DX, DY)) + (GridPathfinderPrivate::DiagonalCost - 1.0f) * static_cast<float>(FMath::Min(DX, DY));
+}
+
+// ---- Flat search ----
+
+void FGridPathfinder::EnsureScratch()
+{
+	if (Width != Cells.GetWidth() || Height != Cells.GetHeight())
+	{
+		Reset();
+		Width = Cells.GetWidth();
+		Height = Cells.GetHeight();
+	}
+
+	if (Scratch.Num() != Width * Height)
+	{
+		Scratch.SetNum(Width * Height);
+		Generation = 0;
+	}
+}
+
+void FGridPathfinder::BeginSearch()
+{
+	// Visit stamps use Generation and Generation + 1; wipe them before the counter wraps
+	if (Generation >= MAX_uint32 - 4)
+	{
+		for (FScratchNode& Node : Scratch)
+		{
+			Node.Visit = 0;
+		}
+		Generation = 0;
+	}
+	Generation += 2;
+	OpenHeap.Reset();
+}
+
+void FGridPathfinder::OpenCell(int32 Cell, float G, int32 Parent, float H)
+{
+	FScratchNode& Node = Scratch[Cell];
+	if (Node.Visit == Generation + 1)
+	{
+		return;
+	}
+
+	if (Node.Visit != Generation || G < Node.G)
+	{
+		Node.Visit = Generation;
+		Node.G = G;
+		Node.Parent = Parent;
+		OpenHeap.HeapPush(FOpenEntry{ G + H, G, Cell });
+	}
+}
+
+bool FGridPathfinder::SearchFlat(int32 StartCell, int32 GoalCell, const FIntRect& Bounds, const FGridPathQuery& Query)
+{
+	using namespace GridPathfinderPrivate;
+
+	BeginSearch();
+
+	const int32 NumDirections = Query.bAllowDiagonal ? 8 : 4;
+	int32 Expanded = 0;
+
+	OpenCell(StartCell, 0.0f, INDEX_NONE, Heuristic(StartCell, GoalCell, Query.bAllowDiagonal));
+
+	while (OpenHeap.Num() > 0)
+	{
+		FOpenEntry Top;
+		OpenHeap.HeapPop(Top, false);
+
+		FScratchNode& Node = Scratch[Top.Cell];
+		if (Node.Visit != Generation || Top.G > Node.G)
+		{
+			// Closed or superseded by a cheaper entry
+			continue;
+		}
+		Node.Visit = Generation + 1;
+		++Expanded;
+		++LastExpandedCount;
+
+		if (Top.Cell == GoalCell)
+		{
+			return true;
+		}
+
+		if (Query.MaxExpandedTiles > 0 && Expanded >= Query.MaxExpandedTiles)
+		{
+			return false;
+		}
+
+		const FIntPoint Point = ToPoint(Top.Cell);
+		for (int32 Dir = 0; Dir < NumDirections; ++Dir)
+		{
+			const int32 NX = Point.X + NeighbourDX[Dir];
+			const int32 NY = Point.Y + NeighbourDY[Dir];
+			if (NX < Bounds.Min.X || NX >= Bounds.Max.X || NY < Bounds.Min.Y || NY >= Bounds.Max.Y)
+			{
+				continue;
+			}
+
+			const int32 NeighbourCell = ToCell(NX, NY);
+			if (Scratch[NeighbourCell].Visit == Generation + 1 || !IsAgentPassable(NX, NY, Query))
+			{
+				continue;
+			}
+
+			const bool bDiagonal = Dir >= 4;
+			if (bDiagonal && (!IsAgentPassable(NX, Point.Y, Query) || !IsAgentPassable(Point.X, NY, Query)))
+			{
+				// No cutting past blocked corners
+				continue;
+			}
+
+			const float StepCost = bDiagonal ? DiagonalCost : 1.0f;
+			OpenCell(NeighbourCell, Node.G + StepCost, Top.Cell, Heuristic(NeighbourCell, GoalCell, Query.bAllowDiagonal));
+		}
+	}
+
+	// A flood with no goal always "succeeds"; costs are left in Scratch
+	return GoalCell == INDEX_NONE;
+}
+
+void FGridPathfinder::AppendParentChain(int32 Cell, TArray<FIntPoint>& OutPath, bool bSkipFirst) const
+{
+	const int32 Begin = OutPath.Num();
+	for (int32 Current = Cell; Current != INDEX_NONE; Current = Scratch[Current].Parent)
+	{
+		OutPath.Add(ToPoint(Current));
+	}
+
+	// Chain was collected goal-first
+	for (int32 Lo = Begin, Hi = OutPath.Num() - 1; Lo < Hi; ++Lo, --Hi)
+	{
+		OutPath.Swap(Lo, Hi);
+	}
+
+	if (bSkipFirst && OutPath.Num() > Begin)
+	{
+		OutPath.RemoveAt(Begin);
+	}
+}
+
+float FGridPathfinder::GetSearchCost(int32 Cell) const
+{
+	const FScratchNode& Node = Scratch[Cell];
+	return (Node.Visit == Generation + 1) ? Node.G : -1.0f;
+}
+
+bool FGridPathfinder::FindPath(const FIntPoint& Start, const FIntPoint& Goal, const FGridPathQuery& Query, bool bHierarchical, TArray<FIntPoint>& OutPath)
+{
+	OutPath.Reset();
+	LastExpandedCount = 0;
+
+	EnsureScratch();
+
+	// The start may be blocked (e.g. an agent standing in a doorway), the goal may not
+	if (!Cells.IsInBounds(Start.X, Start.Y) || !IsAgentPassable(Goal.X, Goal.Y, Query))
+	{
+		return false;
+	}
+
+	if (Start == Goal)
+	{
+		OutPath.Add(Start);
+		return true;
+	}
+
+	const int32 StartCell = ToCell(Start.X, Start.Y);
+	const int32 GoalCell = ToCell(Goal.X, Goal.Y);
+
+	if (bHierarchical && Query.UsesDefaultPassability())
+	{
+		return FindPathHierarchical(StartCell, GoalCell, Query, OutPath);
+	}
+
+	if (!SearchFlat(StartCell, GoalCell, FIntRect(0, 0, Width, Height), Query))
+	{
+		return false;
+	}
+
+	AppendParentChain(GoalCell, OutPath, false);
+	return true;
+}
+
+// ---- Hierarchical layer ----
+
+FIntRect FGridPathfinder::GetClusterRect(int32 ClusterIndex) const
+{
+	const int32 MinX = (ClusterIndex % ClustersX) << ClusterShift;
+	const int32 MinY = (ClusterIndex / ClustersX) << ClusterShift;
+	return FIntRect(MinX, MinY, FMath::Min(MinX + ClusterSize, Width), FMath::Min(MinY + ClusterSize, Height));
+}
+
+int32 FGridPathfinder::GetClusterOf(int32 Cell) const
+{
+	const FIntPoint Point = ToPoint(Cell);
+	return (Point.Y >> ClusterShift) * ClustersX + (Point.X >> ClusterShift);
+}
+
+void FGridPathfinder::EnsureClusterLayer()
+{
+	if (Clusters.Num() == 0)
+	{
+		ClustersX = (Width + ClusterSize - 1) >> ClusterShift;
+		ClustersY = (Height + ClusterSize - 1) >> ClusterShift;
+		Clusters.SetNum(ClustersX * ClustersY);
+
+		DirtyClusters.Reset(Clusters.Num());
+		for (int32 ClusterIndex = 0; ClusterIndex < Clusters.Num(); ++ClusterIndex)
+		{
+			DirtyClusters.Add(ClusterIndex);
+		}
+	}
+
+	if (DirtyClusters.Num() == 0)
+	{
+		return;
+	}
+
+	// A dirty cluster changes all four of its borders, which in turn changes the
+	// entrance nodes of the neighbours sharing them
+	TBitArray<> NeedsNodes(false, Clusters.Num());
+	for (const int32 ClusterIndex : DirtyClusters)
+	{
+		const int32 CX = ClusterIndex % ClustersX;
+		const int32 CY = ClusterIndex / ClustersX;
+
+		RebuildBorder(ClusterIndex, true);
+		RebuildBorder(ClusterIndex, false);
+		NeedsNodes[ClusterIndex] = true;
+
+		if (CX > 0)
+		{
+			RebuildBorder(ClusterIndex - 1, true);
+			NeedsNodes[ClusterIndex - 1] = true;
+		}
+		if (CY > 0)
+		{
+			RebuildBorder(ClusterIndex - ClustersX, false);
+			NeedsNodes[ClusterIndex - ClustersX] = true;
+		}
+		if (CX + 1 < ClustersX)
+		{
+			NeedsNodes[ClusterIndex + 1] = true;
+		}
+		if (CY + 1 < ClustersY)
+		{
+			NeedsNodes[ClusterIndex + ClustersX] = true;
+		}
+	}
+
+	for (TConstSetBitIterator<> It(NeedsNodes); It; ++It)
+	{
+		RebuildClusterNodes(It.GetIndex());
+	}
+
+	for (const int32 ClusterIndex : DirtyClusters)
+	{
+		Clusters[ClusterIndex].bDirty = false;
+	}
+	DirtyClusters.Reset();
+}
+
+void FGridPathfinder::RebuildBorder(int32 ClusterIndex, bool bEast)
+{
+	using namespace GridPathfinderPrivate;
+
+	FCluster& Cluster = Clusters[ClusterIndex];
+	TArray<FIntPoint>& Entrances = bEast ? Cluster.EastEntrances : Cluster.SouthEntrances;
+	Entrances.Reset();
+
+	const FIntRect Rect = GetClusterRect(ClusterIndex);
+
+	// Border tiles on our side; the neighbour side is one step east/south
+	const int32 StepX = bEast ? 1 : 0;
+	const int32 StepY = bEast ? 0 : 1;
+	const int32 BorderX = bEast ? Rect.Max.X - 1 : Rect.Min.X;
+	const int32 BorderY = bEast ? Rect.Min.Y : Rect.Max.Y - 1;
+	const int32 Length = bEast ? Rect.Height() : Rect.Width();
+
+	if (BorderX + StepX >= Width || BorderY + StepY >= Height)
+	{
+		// Edge of the map
+		return;
+	}
+
+	auto AddEntrance = [&](int32 Offset)
+	{
+		const int32 X = BorderX + (bEast ? 0 : Offset);
+		const int32 Y = BorderY + (bEast ? Offset : 0);
+		Entrances.Add(FIntPoint(ToCell(X, Y), ToCell(X + StepX, Y + StepY)));
+	};
+
+	int32 RunStart = INDEX_NONE;
+	for (int32 Offset = 0; Offset <= Length; ++Offset)
+	{
+		bool bOpen = false;
+		if (Offset < Length)
+		{
+			const int32 X = BorderX + (bEast ? 0 : Offset);
+			const int32 Y = BorderY + (bEast ? Offset : 0);
+			bOpen = IsTilePassable(X, Y, DefaultQuery) && IsTilePassable(X + StepX, Y + StepY, DefaultQuery);
+		}
+
+		if (bOpen && RunStart == INDEX_NONE)
+		{
+			RunStart = Offset;
+		}
+		else if (!bOpen && RunStart != INDEX_NONE)
+		{
+			const int32 RunLength = Offset - RunStart;
+			if (RunLength < SplitEntranceRunLength)
+			{
+				AddEntrance(RunStart + RunLength / 2);
+			}
+			else
+			{
+				AddEntrance(RunStart);
+				AddEntrance(Offset - 1);
+			}
+			RunStart = INDEX_NONE;
+		}
+	}
+}
+
+void FGridPathfinder::RebuildClusterNodes(int32 ClusterIndex)
+{
+	using namespace GridPathfinderPrivate;
+
+	FCluster& Cluster = Clusters[ClusterIndex];
+	Cluster.Nodes.Reset();
+
+	auto AddInterEdge = [&Cluster](int32 Cell, int32 Partner)
+	{
+		FAbstractNode* Node = Cluster.Nodes.FindByPredicate([Cell](const FAbstractNode& Existing) { return Existing.Cell == Cell; });
+		if (!Node)
+		{
+			Node = &Cluster.Nodes.AddDefaulted_GetRef();
+			Node->Cell = Cell;
+		}
+		Node->Edges.Add(FAbstractEdge{ Partner, 1.0f });
+	};
+
+	const int32 CX = ClusterIndex % ClustersX;
+	const int32 CY = ClusterIndex / ClustersX;
+
+	for (const FIntPoint& Entrance : Cluster.EastEntrances)
+	{
+		AddInterEdge(Entrance.X, Entrance.Y);
+	}
+	for (const FIntPoint& Entrance : Cluster.SouthEntrances)
+	{
+		AddInterEdge(Entrance.X, Entrance.Y);
+	}
+	if (CX > 0)
+	{
+		for (const FIntPoint& Entrance : Clusters[ClusterIndex - 1].EastEntrances)
+		{
+			AddInterEdge(Entrance.Y, Entrance.X);
+		}
+	}
+	if (CY > 0)
+	{
+		for (const FIntPoint& Entrance : Clusters[ClusterIndex - ClustersX].SouthEntrances)
+		{
+			AddInterEdge(Entrance.Y, Entrance.X);
+		}
+	}
+
+	// Intra-cluster edges: one bounded flood per entrance
+	const FIntRect Rect = GetClusterRect(ClusterIndex);
+	for (int32 From = 0; From < Cluster.Nodes.Num(); ++From)
+	{
+		SearchFlat(Cluster.Nodes[From].Cell, INDEX_NONE, Rect, DefaultQuery);
+		for (int32 To = 0; To < Cluster.Nodes.Num(); ++To)
+		{
+			if (To == From)
+			{
+				continue;
+			}
+
+			const float Cost = GetSearchCost(Cluster.Nodes[To].Cell);
+			if (Cost >= 0.0f)
+			{
+				Cluster.Nodes[From].Edges.Add(FAbstractEdge{ Cluster.Nodes[To].Cell, Cost });
+			}
+		}
+	}
+}
+
+const FGridPathfinder::FAbstractNode* FGridPathfinder::FindNode(int32 ClusterIndex, int32 Cell) const
+{
+	return Clusters[ClusterIndex].Nodes.FindByPredicate([Cell](const FAbstractNode& Node) { return Node.Cell == Cell; });
+}
+
+bool FGridPathfinder::FindPathHierarchical(int32 StartCell, int32 GoalCell, const FGridPathQuery& Query, TArray<FIntPoint>& OutPath)
+{
+	// Sub-searches use the layer's own query so an expansion cap never truncates a hop
+	using GridPathfinderPrivate::DefaultQuery;
+
+	EnsureClusterLayer();
+
+	const int32 StartCluster = GetClusterOf(StartCell);
+	const int32 GoalCluster = GetClusterOf(GoalCell);
+
+	// Same cluster: a bounded flat search is cheapest, and exact if it succeeds
+	if (StartCluster == GoalCluster && SearchFlat(StartCell, GoalCell, GetClusterRect(StartCluster), DefaultQuery))
+	{
+		AppendParentChain(GoalCell, OutPath, false);
+		return true;
+	}
+
+	// Link start and goal to the entrances of their clusters
+	TArray<FAbstractEdge, TInlineAllocator<16>> StartLinks;
+	SearchFlat(StartCell, INDEX_NONE, GetClusterRect(StartCluster), DefaultQuery);
+	for (const FAbstractNode& Node : Clusters[StartCluster].Nodes)
+	{
+		const float Cost = GetSearchCost(Node.Cell);
+		if (Cost >= 0.0f)
+		{
+			StartLinks.Add(FAbstractEdge{ Node.Cell, Cost });
+		}
+	}
+
+	TArray<FAbstractEdge, TInlineAllocator<16>> GoalLinks;
+	SearchFlat(GoalCell, INDEX_NONE, GetClusterRect(GoalCluster), DefaultQuery);
+	for (const FAbstractNode& Node : Clusters[GoalCluster].Nodes)
+	{
+		const float Cost = GetSearchCost(Node.Cell);
+		if (Cost >= 0.0f)
+		{
+			GoalLinks.Add(FAbstractEdge{ Node.Cell, Cost });
+		}
+	}
+
+	if (StartLinks.Num() == 0 || GoalLinks.Num() == 0)
+	{
+		return false;
+	}
+
+	// A* over the entrance graph, reusing the per-tile scratch keyed by entrance cell
+	BeginSearch();
+	OpenCell(StartCell, 0.0f, INDEX_NONE, Heuristic(StartCell, GoalCell, true));
+
+	bool bFound = false;
+	while (OpenHeap.Num() > 0)
+	{
+		FOpenEntry Top;
+		OpenHeap.HeapPop(Top, false);
+
+		FScratchNode& Current = Scratch[Top.Cell];
+		if (Current.Visit != Generation || Top.G > Current.G)
+		{
+			continue;
+		}
+		Current.Visit = Generation + 1;
+		++LastExpandedCount;
+
+		if (Top.Cell == GoalCell)
+		{
+			bFound = true;
+			break;
+		}
+
+		if (Top.Cell == StartCell)
+		{
+			for (const FAbstractEdge& Link : StartLinks)
+			{
+				OpenCell(Link.ToCell, Current.G + Link.Cost, Top.Cell, Heuristic(Link.ToCell, GoalCell, true));
+			}
+		}
+
+		const int32 CurrentCluster = GetClusterOf(Top.Cell);
+		if (const FAbstractNode* Node = FindNode(CurrentCluster, Top.Cell))
+		{
+			for (const FAbstractEdge& Edge : Node->Edges)
+			{
+				OpenCell(Edge.ToCell, Current.G + Edge.Cost, Top.Cell, Heuristic(Edge.ToCell, GoalCell, true));
+			}
+
+			if (CurrentCluster == GoalCluster)
+			{
+				for (const FAbstractEdge& Link : GoalLinks)
+				{
+					if (Link.ToCell == Top.Cell)
+					{
+						OpenCell(GoalCell, Current.G + Link.Cost, Top.Cell, 0.0f);
+						break;
+					}
+				}
+			}
+		}
+	}
+
+	if (!bFound)
+	{
+		return false;
+	}
+
+	// Collect the abstract route before the refinement searches reuse the scratch
+	TArray<int32, TInlineAllocator<64>> Waypoints;
+	for (int32 Cell = GoalCell; Cell != INDEX_NONE; Cell = Scratch[Cell].Parent)
+	{
+		Waypoints.Add(Cell);
+	}
+	Algo::Reverse(Waypoints);
+
+	// Refine each hop: inter-cluster hops are single orthogonal steps, the rest stay inside one cluster
+	OutPath.Add(ToPoint(StartCell));
+	for (int32 i = 1; i < Waypoints.Num(); ++i)
+	{
+		const int32 From = Waypoints[i - 1];
+		const int32 To = Waypoints[i];
+		const int32 FromCluster = GetClusterOf(From);
+
+		if (FromCluster != GetClusterOf(To))
+		{
+			OutPath.Add(ToPoint(To));
+			continue;
+		}
+
+		if (!SearchFlat(From, To, GetClusterRect(FromCluster), DefaultQuery))
+		{
+			OutPath.Reset();
+			return false;
+		}
+		AppendParentChain(To, OutPath, true);
+	}
+
+	return true;
+}
@@ -0,0 +1,151 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GridTypes.h"
+
+class FGridCellStore;
+class FGridZoneIndex;
+
+/**
+ * Grid-native path search used by UFarmGridManager.
+ *
+ * Flat searches are A* over the tile grid with a binary heap. Per-tile scratch
+ * (cost, parent, visit stamp) is allocated once and reused; a generation stamp
+ * replaces clearing between searches.
+ *
+ * The optional hierarchical layer (HPA*) splits the grid into 16x16 clusters.
+ * Entrances sit on walkable runs along cluster borders, and intra-cluster costs
+ * between entrances are precomputed. A query searches the small entrance graph
+ * and then refines each hop with a cluster-bounded flat search. Clusters are
+ * rebuilt lazily when tiles inside them change passability.
+ */
+class HOBUNJIHOLLOW_API FGridPathfinder
+{
+public:
+	static constexpr int32 ClusterShift = 4;
+	static constexpr int32 ClusterSize = 1 << ClusterShift;
+
+	FGridPathfinder(const FGridCellStore& InCells, const FGridZoneIndex& InZones);
+
+	/** Drop scratch buffers and the cluster layer (call after the grid or zones change size/content wholesale) */
+	void Reset();
+
+	/** A tile changed passability; dirties its cluster in the hierarchical layer */
+	void MarkTileDirty(int32 X, int32 Y);
+
+	/**
+	 * Find a path from Start to Goal. The path includes both ends.
+	 * Hierarchical search is only used if requested and the query uses default passability.
+	 */
+	bool FindPath(const FIntPoint& Start, const FIntPoint& Goal, const FGridPathQuery& Query, bool bHierarchical, TArray<FIntPoint>& OutPath);
+
+	/** Whether the tile can be stood on under the query's rules */
+	bool IsTilePassable(int32 X, int32 Y, const FGridPathQuery& Query) const;
+
+	/** Tiles expanded by the last FindPath call (all sub-searches included) */
+	int32 GetLastExpandedCount() const { return LastExpandedCount; }
+
+	/** Number of entrance nodes in the hierarchical layer (0 if not built) */
+	int32 GetNumAbstractNodes() const;
+
+private:
+	struct FScratchNode
+	{
+		float G = 0.0f;
+		int32 Parent = INDEX_NONE;
+
+		/** Generation == open/seen this search, Generation + 1 == closed */
+		uint32 Visit = 0;
+	};
+
+	struct FOpenEntry
+	{
+		float F;
+		float G;
+		int32 Cell;
+
+		bool operator<(const FOpenEntry& Other) const
+		{
+			// Prefer lower F, then deeper nodes to cut ties short
+			return F < Other.F || (F == Other.F && G > Other.G);
+		}
+	};
+
+	struct FAbstractEdge
+	{
+		int32 ToCell;
+		float Cost;
+	};
+
+	struct FAbstractNode
+	{
+		int32 Cell = INDEX_NONE;
+		TArray<FAbstractEdge, TInlineAllocator<8>> Edges;
+	};
+
+	struct FCluster
+	{
+		/** Entrance pairs (cell here, cell in neighbour) on the east and south borders */
+		TArray<FIntPoint> EastEntrances;
+		TArray<FIntPoint> SouthEntrances;
+
+		TArray<FAbstractNode> Nodes;
+		bool bDirty = true;
+	};
+
+	// ---- Grid helpers ----
+
+	FORCEINLINE int32 ToCell(int32 X, int32 Y) const { return Y * Width + X; }
+	FORCEINLINE FIntPoint ToPoint(int32 Cell) const { return FIntPoint(Cell % Width, Cell / Width); }
+
+	bool IsAgentPassable(int32 X, int32 Y, const FGridPathQuery& Query) const;
+	float Heuristic(int32 Cell, int32 GoalCell, bool bAllowDiagonal) const;
+
+	// ---- Flat search ----
+
+	void EnsureScratch();
+	void BeginSearch();
+
+	/** Relax a cell: record cost/parent and push to the heap if this is an improvement */
+	void OpenCell(int32 Cell, float G, int32 Parent, float H);
+
+	/**
+	 * A* from StartCell to GoalCell restricted to Bounds (max exclusive).
+	 * With GoalCell == INDEX_NONE this is a Dijkstra flood of Bounds and costs are left in Scratch.
+	 */
+	bool SearchFlat(int32 StartCell, int32 GoalCell, const FIntRect& Bounds, const FGridPathQuery& Query);
+
+	/** Append the parent chain ending at Cell, start first; optionally drop the start (already in the path) */
+	void AppendParentChain(int32 Cell, TArray<FIntPoint>& OutPath, bool bSkipFirst) const;
+
+	/** Cost reached for Cell by the last search, or -1 if not reached */
+	float GetSearchCost(int32 Cell) const;
+
+	// ---- Hierarchical layer ----
+
+	FIntRect GetClusterRect(int32 ClusterIndex) const;
+	int32 GetClusterOf(int32 Cell) const;
+	void EnsureClusterLayer();
+	void RebuildBorder(int32 ClusterIndex, bool bEast);
+	void RebuildClusterNodes(int32 ClusterIndex);
+	const FAbstractNode* FindNode(int32 ClusterIndex, int32 Cell) const;
+	bool FindPathHierarchical(int32 StartCell, int32 GoalCell, const FGridPathQuery& Query, TArray<FIntPoint>& OutPath);
+
+	const FGridCellStore& Cells;
+	const FGridZoneIndex& Zones;
+
+	int32 Width = 0;
+	int32 Height = 0;
+
+	TArray<FScratchNode> Scratch;
+	TArray<FOpenEntry> OpenHeap;
+	uint32 Generation = 0;
+	int32 LastExpandedCount = 0;
+
+	TArray<FCluster> Clusters;
+	TArray<int32> DirtyClusters;
+	int32 ClustersX = 0;
+	int32 ClustersY = 0;
+};
@@ -4,6 +4,9 @@
 #include "Components/StaticMeshComponent.h"
 #include "GridFootprintComponent.h"
 #include "FarmGridManager.h"
+#include "GridTileRenderer.h"
+#include "CropSimulation.h"
+#include "GridActorPool.h"
 
 AGridPlaceableCrop::AGridPlaceableCrop()
 {
@@ -56,11 +59,156 @@ AGridPlaceableCrop::AGridPlaceableCrop()
 void AGridPlaceableCrop::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Prewarmed into the actor pool: stay dormant until acquired
+	if (!UGridActorPool::IsActorPooled(this))
+	{
+		ActivateCrop();
+	}
+}
+
+void AGridPlaceableCrop::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DeactivateCrop();
+	Super::EndPlay(EndPlayReason);
+}
+
+void AGridPlaceableCrop::ActivateCrop()
+{
+	if (UFarmGridManager* GridManager = GetWorld() ? GetWorld()->GetSubsystem<UFarmGridManager>() : nullptr)
+	{
+		// The simulation owns growth state from here on
+		SimulationOwner = GridManager;
+		GridManager->GetCropSimulation().AddView(this);
+
+		if (bUseInstancedRendering)
+		{
+			TileRenderer = GridManager->GetTileRenderer();
+		}
+	}
+
+	if (TileRenderer.IsValid())
+	{
+		RootSceneComponent->TransformUpdated.AddUObject(this, &AGridPlaceableCrop::OnRootTransformUpdated);
+	}
+
+	UpdateVisuals();
+}
+
+void AGridPlaceableCrop::DeactivateCrop()
+{
+	if (AGridTileRenderer* Renderer = TileRenderer.Get())
+	{
+		Renderer->ClearVisuals(this);
+	}
+	TileRenderer.Reset();
+	RootSceneComponent->TransformUpdated.RemoveAll(this);
+
+	if (UFarmGridManager* GridManager = SimulationOwner.Get())
+	{
+		GridManager->GetCropSimulation().Remove(this);
+	}
+	SimulationOwner.Reset();
+}
+
+void AGridPlaceableCrop::OnAcquiredFromPool_Implementation()
+{
+	ActivateCrop();
+}
+
+void AGridPlaceableCrop::OnReleasedToPool_Implementation()
+{
+	DeactivateCrop();
+	ResetToClassDefaults();
+}
+
+void AGridPlaceableCrop::ResetToClassDefaults()
+{
+	const AGridPlaceableCrop* Defaults = GetClass()->GetDefaultObject<AGridPlaceableCrop>();
+
+	CropTypeId = Defaults->CropTypeId;
+	DisplayName = Defaults->DisplayName;
+	GrowthStage = Defaults->GrowthStage;
+	DaysToMature = Defaults->DaysToMature;
+	DaysGrown = Defaults->DaysGrown;
+	bWateredToday = Defaults->bWateredToday;
+	TotalDaysWatered = Defaults->TotalDaysWatered;
+	GridPosition = Defaults->GridPosition;
+	bDiesWithoutWater = Defaults->bDiesWithoutWater;
+	ValidSeasons = Defaults->ValidSeasons;
+	HarvestItemId = Defaults->HarvestItemId;
+	MinHarvestAmount = Defaults->MinHarvestAmount;
+	MaxHarvestAmount = Defaults->MaxHarvestAmount;
+	bRegrowsAfterHarvest = Defaults->bRegrowsAfterHarvest;
+	DaysToRegrow = Defaults->DaysToRegrow;
+
+	// A crop type definition may have swapped stage meshes
+	auto ResetMesh = [](UStaticMeshComponent* Component, const UStaticMeshComponent* DefaultComponent)
+	{
+		if (Component && DefaultComponent && Component->GetStaticMesh() != DefaultComponent->GetStaticMesh())
+		{
+			Component->SetStaticMesh(DefaultComponent->GetStaticMesh());
+		}
+	};
+	ResetMesh(SeedMeshComponent, Defaults->SeedMeshComponent);
+	ResetMesh(SproutMeshComponent, Defaults->SproutMeshComponent);
+	ResetMesh(GrowingMeshComponent, Defaults->GrowingMeshComponent);
+	ResetMesh(MatureMeshComponent, Defaults->MatureMeshComponent);
+	ResetMesh(HarvestableMeshComponent, Defaults->HarvestableMeshComponent);
+	ResetMesh(DeadMeshComponent, Defaults->DeadMeshComponent);
+}
+
+FCropSimulation* AGridPlaceableCrop::FindSimulation(int32& OutIndex) const
+{
+	OutIndex = INDEX_NONE;
+	UFarmGridManager* GridManager = SimulationOwner.Get();
+	if (!GridManager)
+	{
+		return nullptr;
+	}
+
+	FCropSimulation& Simulation = GridManager->GetCropSimulation();
+	OutIndex = Simulation.Find(this);
+	return OutIndex != INDEX_NONE ? &Simulation : nullptr;
+}
+
+void AGridPlaceableCrop::PullSimulationState()
+{
+	int32 Index;
+	if (const FCropSimulation* Simulation = FindSimulation(Index))
+	{
+		Simulation->PullView(Index, *this);
+	}
+}
+
+void AGridPlaceableCrop::PushSimulationState()
+{
+	int32 Index;
+	if (FCropSimulation* Simulation = FindSimulation(Index))
+	{
+		Simulation->PushView(Index, *this);
+	}
+}
+
+FCropDayState AGridPlaceableCrop::GetLiveState() const
+{
+	int32 Index;
+	if (const FCropSimulation* Simulation = FindSimulation(Index))
+	{
+		return Simulation->GetState(Index);
+	}
+	return FCropDayState::FromCrop(*this);
+}
+
+void AGridPlaceableCrop::OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
 	UpdateVisuals();
 }
 
 void AGridPlaceableCrop::Water()
 {
+	PullSimulationState();
+
 	if (GrowthStage == ECropGrowthStage::Dead)
 	{
 		return;
@@ -68,11 +216,14 @@ void AGridPlaceableCrop::Water()
 
 	bWateredToday = true;
 	TotalDaysWatered++;
+	PushSimulationState();
 	OnWatered();
 }
 
 bool AGridPlaceableCrop::Harvest()
 {
+	PullSimulationState();
+
 	if (!CanHarvest())
 	{
 		return false;
@@ -87,81 +238,59 @@ bool AGridPlaceableCrop::Harvest()
 		// Reset to growing stage, will take DaysToRegrow to become harvestable again
 		DaysGrown = DaysToMature - DaysToRegrow;
 		SetGrowthStage(ECropGrowthStage::Growing);
+		PushSimulationState();
 		return true;
 	}
 
-	// Crop is done, destroy it
-	Destroy();
+	// Crop is done, recycle it
+	UGridActorPool::ReleaseOrDestroy(this);
 	return true;
 }
 
 bool AGridPlaceableCrop::CanHarvest() const
 {
-	return GrowthStage == ECropGrowthStage::Harvestable;
+	return GetLiveState().Stage == ECropGrowthStage::Harvestable;
 }
 
 bool AGridPlaceableCrop::NeedsWater() const
 {
-	return !bWateredToday && GrowthStage != ECropGrowthStage::Dead && GrowthStage != ECropGrowthStage::Harvestable;
+	const FCropDayState State = GetLiveState();
+	return !State.bWateredToday && State.Stage != ECropGrowthStage::Dead && State.Stage != ECropGrowthStage::Harvestable;
 }
 
 void AGridPlaceableCrop::OnDayAdvance(int32 CurrentSeason)
 {
-	// Check if crop dies from lack of water
-	if (bDiesWithoutWater && !bWateredToday && GrowthStage != ECropGrowthStage::Dead && GrowthStage != ECropGrowthStage::Seed)
-	{
-		SetGrowthStage(ECropGrowthStage::Dead);
-		OnDied();
-		bWateredToday = false;
-		return;
-	}
+	PullSimulationState();
 
-	// Check if growing in wrong season
-	if (ValidSeasons.Num() > 0 && !ValidSeasons.Contains(CurrentSeason))
-	{
-		SetGrowthStage(ECropGrowthStage::Dead);
-		OnDied();
-		bWateredToday = false;
-		return;
-	}
+	// Same rules the grid's crop simulation applies to every crop
+	FCropDayState State = FCropDayState::FromCrop(*this);
+	FCropSimulation::AdvanceCropDay(State, FCropGrowthRules::FromCrop(*this), CurrentSeason);
+
+	const ECropGrowthStage OldStage = GrowthStage;
+	DaysGrown = State.DaysGrown;
+	bWateredToday = State.bWateredToday;
+	PushSimulationState();
 
-	// Only grow if watered (or seed stage doesn't require water)
-	if (bWateredToday || GrowthStage == ECropGrowthStage::Seed)
+	if (State.Stage != OldStage)
 	{
-		if (GrowthStage != ECropGrowthStage::Harvestable && GrowthStage != ECropGrowthStage::Dead)
+		SetGrowthStage(State.Stage);
+		if (State.Stage == ECropGrowthStage::Dead)
 		{
-			DaysGrown++;
-
-			// Calculate which stage we should be at
-			float GrowthProgress = static_cast<float>(DaysGrown) / static_cast<float>(DaysToMature);
-
-			ECropGrowthStage NewStage = GrowthStage;
-			if (GrowthProgress >= 1.0f)
-			{
-				NewStage = ECropGrowthStage::Harvestable;
-			}
-			else if (GrowthProgress >= 0.75f)
-			{
-				NewStage = ECropGrowthStage::Mature;
-			}
-			else if (GrowthProgress >= 0.5f)
-			{
-				NewStage = ECropGrowthStage::Growing;
-			}
-			else if (GrowthProgress > 0.0f)
-			{
-				NewStage = ECropGrowthStage::Sprout;
-			}
-
-			if (NewStage != GrowthStage)
-			{
-				SetGrowthStage(NewStage);
-			}
+			OnDied();
 		}
 	}
+}
+
+void AGridPlaceableCrop::OnSimulatedStageChange(ECropGrowthStage OldStage)
+{
+	PullSimulationState();
+	UpdateVisuals();
+	OnGrowthStageChanged(GrowthStage);
 
-	// Reset watered status for new day
-	bWateredToday = false;
+	if (GrowthStage == ECropGrowthStage::Dead && OldStage != ECropGrowthStage::Dead)
+	{
+		OnDied();
+	}
 }
 
 void AGridPlaceableCrop::HideAllStageMeshes()
@@ -205,6 +334,13 @@ void AGridPlaceableCrop::UpdateVisuals()
 
 	// Show only the current stage's mesh
 	UStaticMeshComponent* CurrentMesh = GetMeshComponentForStage(GrowthStage);
+	if (AGridTileRenderer* Renderer = TileRenderer.Get())
+	{
+		// Moves the instance to the new stage's batch; a stage without a mesh clears it
+		Renderer->SetVisual(this, EGridTileVisualSlot::Crop, CurrentMesh);
+		return;
+	}
+
 	if (CurrentMesh && CurrentMesh->GetStaticMesh())
 	{
 		CurrentMesh->SetVisibility(true);
@@ -214,6 +350,7 @@ void AGridPlaceableCrop::UpdateVisuals()
 void AGridPlaceableCrop::SetGridPosition(const FGridCoordinate& Position)
 {
 	GridPosition = Position;
+	PushSimulationState();
 
 	// Register with grid manager
 	if (UWorld* World = GetWorld())
@@ -225,6 +362,12 @@ void AGridPlaceableCrop::SetGridPosition(const FGridCoordinate& Position)
 	}
 }
 
+void AGridPlaceableCrop::SetCropTypeId(FName NewCropTypeId)
+{
+	CropTypeId = NewCropTypeId;
+	PushSimulationState();
+}
+
 void AGridPlaceableCrop::InitializeFromSaveData(FName InCropTypeId, int32 InGrowthStage, int32 InDaysGrown, bool InWateredToday, int32 InTotalDaysWatered)
 {
 	CropTypeId = InCropTypeId;
@@ -232,6 +375,7 @@ void AGridPlaceableCrop::InitializeFromSaveData(FName InCropTypeId, int32 InGrow
 	DaysGrown = InDaysGrown;
 	bWateredToday = InWateredToday;
 	TotalDaysWatered = InTotalDaysWatered;
+	PushSimulationState();
 	UpdateVisuals();
 }
 
@@ -240,6 +384,7 @@ void AGridPlaceableCrop::SetGrowthStage(ECropGrowthStage NewStage)
 	if (GrowthStage != NewStage)
 	{
 		GrowthStage = NewStage;
+		PushSimulationState();
 		UpdateVisuals();
 		OnGrowthStageChanged(NewStage);
 	}
@@ -5,10 +5,15 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GridTypes.h"
+#include "GridPoolable.h"
 #include "GridPlaceableCrop.generated.h"
 
 class UStaticMeshComponent;
 class UGridFootprintComponent;
+class AGridTileRenderer;
+class UFarmGridManager;
+class FCropSimulation;
+struct FCropDayState;
 
 /**
  * Growth stage of a crop
@@ -27,10 +32,18 @@ enum class ECropGrowthStage : uint8
 /**
  * A crop that can be planted, watered, grown, and harvested.
  * Uses separate mesh components for each growth stage that are shown/hidden,
- * allowing precise positioning in the viewport.
+ * allowing precise positioning in the viewport. In game worlds the current stage is drawn
+ * by the grid's instanced tile renderer instead, using the stage component as its template.
+ *
+ * Growth state is simulated by the grid manager's FCropSimulation. While registered there
+ * (from BeginPlay), the state properties below are a view: the functions on this class read
+ * the live state, and the properties themselves are refreshed whenever the stage changes or
+ * this crop is acted on.
+ *
+ * Harvested crops go back to the grid's actor pool and are reset to their class defaults.
  */
 UCLASS(BlueprintType, Blueprintable)
-class HOBUNJIHOLLOW_API AGridPlaceableCrop : public AActor
+class HOBUNJIHOLLOW_API AGridPlaceableCrop : public AActor, public IGridPoolable
 {
 	GENERATED_BODY()
 
@@ -39,16 +52,16 @@ public:
 
 	// ---- Configuration ----
 
-	/** Crop type identifier (matches CropTypeId in save data) */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop")
+	/** Crop type identifier (matches CropTypeId in save data); set at runtime through SetCropTypeId */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Crop")
 	FName CropTypeId;
 
 	/** Display name for this crop */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop")
 	FText DisplayName;
 
-	/** Current growth stage */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop", SaveGame)
+	/** Current growth stage; set at runtime through SetGrowthStage */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Crop", SaveGame)
 	ECropGrowthStage GrowthStage = ECropGrowthStage::Seed;
 
 #if WITH_EDITORONLY_DATA
@@ -89,6 +102,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop")
 	TArray<int32> ValidSeasons;
 
+	/** Draw through the grid's instanced tile renderer (if the grid manager has it enabled) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crop|Rendering")
+	bool bUseInstancedRendering = true;
+
 	// ---- Harvest Configuration ----
 
 	/** Item ID dropped when harvested */
@@ -160,10 +177,16 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Crop")
 	bool NeedsWater() const;
 
-	/** Called when a new day starts */
+	/** Advance this crop alone by a day (the grid manager's OnDayAdvanceForCrops advances every crop at once) */
 	UFUNCTION(BlueprintCallable, Category = "Crop")
 	void OnDayAdvance(int32 CurrentSeason);
 
+	/** Called by the grid's crop simulation after a day advance changed this crop's stage */
+	void OnSimulatedStageChange(ECropGrowthStage OldStage);
+
+	/** Mesh component shown (or used as the instance template) for a given stage */
+	UStaticMeshComponent* GetMeshComponentForStage(ECropGrowthStage Stage) const;
+
 	/** Update visual based on growth stage (shows/hides appropriate mesh) */
 	UFUNCTION(BlueprintCallable, Category = "Crop")
 	void UpdateVisuals();
@@ -172,6 +195,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Crop")
 	void SetGridPosition(const FGridCoordinate& Position);
 
+	/** Change the crop type, keeping the crop simulation (and so saves) in step */
+	UFUNCTION(BlueprintCallable, Category = "Crop")
+	void SetCropTypeId(FName NewCropTypeId);
+
+	/** Set growth stage and update visuals */
+	UFUNCTION(BlueprintCallable, Category = "Crop")
+	void SetGrowthStage(ECropGrowthStage NewStage);
+
 	/** Initialize from save data */
 	UFUNCTION(BlueprintCallable, Category = "Crop")
 	void InitializeFromSaveData(FName InCropTypeId, int32 InGrowthStage, int32 InDaysGrown, bool InWateredToday, int32 InTotalDaysWatered);
@@ -198,18 +229,48 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Crop")
 	void SpawnHarvestDrops();
 
+	// ---- Pooling ----
+
+	virtual void OnAcquiredFromPool_Implementation() override;
+	virtual void OnReleasedToPool_Implementation() override;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-	/** Set growth stage and update visuals */
-	void SetGrowthStage(ECropGrowthStage NewStage);
+	/** Join the crop simulation and tile renderer (BeginPlay, or leaving the actor pool) */
+	void ActivateCrop();
+
+	/** Leave the crop simulation and tile renderer (EndPlay, or entering the actor pool) */
+	void DeactivateCrop();
+
+	/** Restore configuration, state and stage meshes from the class default object */
+	void ResetToClassDefaults();
+
+	/** Renderer drawing this crop's instance, if instanced rendering is active */
+	TWeakObjectPtr<AGridTileRenderer> TileRenderer;
+
+	/** Keep the instance in place when the actor is moved */
+	void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/** Grid manager whose crop simulation holds this crop's state */
+	TWeakObjectPtr<UFarmGridManager> SimulationOwner;
+
+	/** The simulation and this crop's index in it, or null if not registered */
+	FCropSimulation* FindSimulation(int32& OutIndex) const;
+
+	/** Refresh the state properties from the simulation */
+	void PullSimulationState();
+
+	/** Write the properties back to the simulation after changing them */
+	void PushSimulationState();
+
+	/** Current state, from the simulation if registered */
+	FCropDayState GetLiveState() const;
 
 	/** Calculate quality based on watering consistency */
 	int32 CalculateHarvestQuality() const;
 
-	/** Helper to get mesh component for a given stage */
-	UStaticMeshComponent* GetMeshComponentForStage(ECropGrowthStage Stage) const;
-
 	/** Hide all stage meshes */
 	void HideAllStageMeshes();
 
@@ -4,6 +4,9 @@
 #include "Components/StaticMeshComponent.h"
 #include "GridFootprintComponent.h"
 #include "FarmGridManager.h"
+#include "GridTileRenderer.h"
+#include "GridActorPool.h"
+#include "GridPlaceableCrop.h"
 
 AGridPlaceableTilledSoil::AGridPlaceableTilledSoil()
 {
@@ -36,6 +39,15 @@ void AGridPlaceableTilledSoil::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Prewarmed into the actor pool: stay dormant until acquired
+	if (!UGridActorPool::IsActorPooled(this))
+	{
+		ActivateSoil();
+	}
+}
+
+void AGridPlaceableTilledSoil::ActivateSoil()
+{
 	// The map spawner calls FootprintComponent->RegisterWithGrid() before BeginPlay,
 	// so we can read the registered coord to mark the cell as tilled.
 	if (UWorld* World = GetWorld())
@@ -54,9 +66,55 @@ void AGridPlaceableTilledSoil::BeginPlay()
 			}
 
 			GridManager->SetTileTilled(GridPosition, true);
+
+			if (bUseInstancedRendering)
+			{
+				TileRenderer = GridManager->GetTileRenderer();
+			}
 		}
 	}
 
+	if (TileRenderer.IsValid())
+	{
+		RootSceneComponent->TransformUpdated.AddUObject(this, &AGridPlaceableTilledSoil::OnRootTransformUpdated);
+	}
+
+	UpdateVisuals();
+}
+
+void AGridPlaceableTilledSoil::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	DeactivateSoil();
+	Super::EndPlay(EndPlayReason);
+}
+
+void AGridPlaceableTilledSoil::DeactivateSoil()
+{
+	if (AGridTileRenderer* Renderer = TileRenderer.Get())
+	{
+		Renderer->ClearVisuals(this);
+	}
+	TileRenderer.Reset();
+	RootSceneComponent->TransformUpdated.RemoveAll(this);
+}
+
+void AGridPlaceableTilledSoil::OnAcquiredFromPool_Implementation()
+{
+	ActivateSoil();
+}
+
+void AGridPlaceableTilledSoil::OnReleasedToPool_Implementation()
+{
+	DeactivateSoil();
+
+	const AGridPlaceableTilledSoil* Defaults = GetClass()->GetDefaultObject<AGridPlaceableTilledSoil>();
+	GridPosition = Defaults->GridPosition;
+	bIsWatered = Defaults->bIsWatered;
+	PlantedCrop.Reset();
+}
+
+void AGridPlaceableTilledSoil::OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
 	UpdateVisuals();
 }
 
@@ -91,7 +149,16 @@ void AGridPlaceableTilledSoil::ClearWatered()
 
 bool AGridPlaceableTilledSoil::CanPlantCrop() const
 {
-	return !PlantedCrop.IsValid();
+	// A harvested crop may be sitting in the actor pool rather than destroyed
+	const AActor* Crop = PlantedCrop.Get();
+	if (!Crop || UGridActorPool::IsActorPooled(Crop))
+	{
+		return true;
+	}
+
+	// ...or already reacquired from the pool for another tile
+	const AGridPlaceableCrop* GridCrop = Cast<AGridPlaceableCrop>(Crop);
+	return GridCrop && (GridCrop->GridPosition.X != GridPosition.X || GridCrop->GridPosition.Y != GridPosition.Y);
 }
 
 void AGridPlaceableTilledSoil::SetPlantedCrop(AActor* Crop)
@@ -121,6 +188,16 @@ void AGridPlaceableTilledSoil::SetGridPosition(const FGridCoordinate& Position)
 
 void AGridPlaceableTilledSoil::UpdateVisuals()
 {
+	if (AGridTileRenderer* Renderer = TileRenderer.Get())
+	{
+		// Components only describe the instances
+		SoilMesh->SetVisibility(false);
+		WateredOverlayMesh->SetVisibility(false);
+		Renderer->SetVisual(this, EGridTileVisualSlot::Soil, SoilMesh);
+		Renderer->SetVisual(this, EGridTileVisualSlot::WateredOverlay, bIsWatered ? WateredOverlayMesh : nullptr);
+		return;
+	}
+
 	if (WateredOverlayMesh)
 	{
 		WateredOverlayMesh->SetVisibility(bIsWatered);
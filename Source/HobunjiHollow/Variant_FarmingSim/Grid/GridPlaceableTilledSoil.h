@@ -5,18 +5,23 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GridTypes.h"
+#include "GridPoolable.h"
 #include "GridPlaceableTilledSoil.generated.h"
 
 class UStaticMeshComponent;
 class UGridFootprintComponent;
+class AGridTileRenderer;
 
 /**
  * Represents a tile of tilled soil that crops can be planted on.
  * Can be placed via the raycast placement system and has a GridFootprintComponent
  * for viewport preview/scaling.
+ *
+ * In game worlds the soil and watered overlay are drawn by the grid's instanced tile renderer;
+ * the mesh components stay hidden and only provide mesh, materials and placement.
  */
 UCLASS(BlueprintType, Blueprintable)
-class HOBUNJIHOLLOW_API AGridPlaceableTilledSoil : public AActor
+class HOBUNJIHOLLOW_API AGridPlaceableTilledSoil : public AActor, public IGridPoolable
 {
 	GENERATED_BODY()
 
@@ -54,6 +59,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "Soil")
 	TWeakObjectPtr<AActor> PlantedCrop;
 
+	/** Draw through the grid's instanced tile renderer (if the grid manager has it enabled) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Soil|Rendering")
+	bool bUseInstancedRendering = true;
+
 	// ---- Interaction ----
 
 	/** Water this soil tile */
@@ -92,6 +101,24 @@ public:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Soil")
 	void OnDried();
 
+	// ---- Pooling ----
+
+	virtual void OnAcquiredFromPool_Implementation() override;
+	virtual void OnReleasedToPool_Implementation() override;
+
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Mark the tile tilled and join the tile renderer (BeginPlay, or leaving the actor pool) */
+	void ActivateSoil();
+
+	/** Leave the tile renderer (EndPlay, or entering the actor pool) */
+	void DeactivateSoil();
+
+	/** Renderer drawing this tile's instances, if instanced rendering is active */
+	TWeakObjectPtr<AGridTileRenderer> TileRenderer;
+
+	/** Keep instances in place when the actor is moved */
+	void OnRootTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
 };
@@ -5,6 +5,7 @@
 #include "Components/CapsuleComponent.h"
 #include "GridFootprintComponent.h"
 #include "FarmGridManager.h"
+#include "GridActorPool.h"
 
 AGridPlaceableTree::AGridPlaceableTree()
 {
@@ -67,6 +68,20 @@ void AGridPlaceableTree::BeginPlay()
 	UpdateCollision();
 }
 
+void AGridPlaceableTree::OnAcquiredFromPool_Implementation()
+{
+	UpdateVisuals();
+	UpdateCollision();
+}
+
+void AGridPlaceableTree::OnReleasedToPool_Implementation()
+{
+	const AGridPlaceableTree* Defaults = GetClass()->GetDefaultObject<AGridPlaceableTree>();
+	GrowthStage = Defaults->GrowthStage;
+	DaysUntilRespawn = Defaults->DaysUntilRespawn;
+	GridPosition = Defaults->GridPosition;
+}
+
 bool AGridPlaceableTree::CanBeChopped() const
 {
 	return GrowthStage == ETreeGrowthStage::Young ||
@@ -94,8 +109,8 @@ void AGridPlaceableTree::Chop()
 	}
 	else
 	{
-		// Destroy completely
-		Destroy();
+		// Gone for good: recycle the actor
+		UGridActorPool::ReleaseOrDestroy(this);
 	}
 }
 
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "GridTypes.h"
+#include "GridPoolable.h"
 #include "GridPlaceableTree.generated.h"
 
 class UStaticMeshComponent;
@@ -41,9 +42,10 @@ enum class ETreeGrowthStage : uint8
  * A tree that can be placed on the grid, chopped, and regenerates over time.
  * Uses separate mesh components for each growth stage that are shown/hidden,
  * allowing precise positioning in the viewport.
+ * Trees that don't regenerate go back to the grid's actor pool once chopped.
  */
 UCLASS(BlueprintType, Blueprintable)
-class HOBUNJIHOLLOW_API AGridPlaceableTree : public AActor
+class HOBUNJIHOLLOW_API AGridPlaceableTree : public AActor, public IGridPoolable
 {
 	GENERATED_BODY()
 
@@ -194,6 +196,11 @@ public:
 	UFUNCTION(BlueprintNativeEvent, Category = "Tree")
 	void SpawnDrops();
 
+	// ---- Pooling ----
+
+	virtual void OnAcquiredFromPool_Implementation() override;
+	virtual void OnReleasedToPool_Implementation() override;
+
 protected:
 	virtual void BeginPlay() override;
 
@@ -0,0 +1,5 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GridPoolable.h"
+
+// Interface implementations are provided by implementing classes
@@ -0,0 +1,35 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "GridPoolable.generated.h"
+
+UINTERFACE(MinimalAPI, Blueprintable)
+class UGridPoolable : public UInterface
+{
+	GENERATED_BODY()
+};
+
+/**
+ * Interface for grid placeables that UGridActorPool may recycle instead of destroying.
+ *
+ * A pooled actor never gets EndPlay/BeginPlay between uses: the pool hides it, turns off its
+ * collision and takes it off the grid, and these hooks do the rest of what BeginPlay and
+ * EndPlay would have done. Actors spawned straight into the pool (prewarming) should skip
+ * their BeginPlay setup while UGridActorPool::IsActorPooled is true.
+ */
+class HOBUNJIHOLLOW_API IGridPoolable
+{
+	GENERATED_BODY()
+
+public:
+	/** Called after the actor left the pool and was moved into place; re-register with whatever BeginPlay would */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Grid|Pooling")
+	void OnAcquiredFromPool();
+
+	/** Called as the actor goes back into the pool; unregister as EndPlay would and reset to class defaults */
+	UFUNCTION(BlueprintNativeEvent, BlueprintCallable, Category = "Grid|Pooling")
+	void OnReleasedToPool();
+};
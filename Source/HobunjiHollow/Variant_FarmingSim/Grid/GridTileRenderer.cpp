@@ -0,0 +1,140 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GridTileRenderer.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
+
+AGridTileRenderer::AGridTileRenderer()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+}
+
+void AGridTileRenderer::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	Instances.Empty();
+	BatchInstanceKeys.Empty();
+	BatchLookup.Empty();
+	BatchComponents.Empty();
+	Super::EndPlay(EndPlayReason);
+}
+
+void AGridTileRenderer::SetVisual(const UObject* Owner, EGridTileVisualSlot Slot, const UStaticMeshComponent* Template)
+{
+	if (!Owner)
+	{
+		return;
+	}
+
+	const FInstanceKey Key{ TObjectKey<UObject>(Owner), Slot };
+	if (!Template || !Template->GetStaticMesh())
+	{
+		RemoveInstance(Key);
+		return;
+	}
+
+	const int32 Batch = FindOrAddBatch(Template);
+	const FTransform Transform = Template->GetComponentTransform();
+
+	if (FInstanceLocation* Existing = Instances.Find(Key))
+	{
+		if (Existing->Batch == Batch)
+		{
+			BatchComponents[Batch]->UpdateInstanceTransform(Existing->Instance, Transform, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
+			return;
+		}
+
+		// Different mesh (e.g. next growth stage): move to the other batch
+		RemoveInstance(Key);
+	}
+
+	FInstanceLocation& Location = Instances.Add(Key);
+	Location.Batch = Batch;
+	Location.Instance = BatchComponents[Batch]->AddInstance(Transform, /*bWorldSpace*/ true);
+	BatchInstanceKeys[Batch].Add(Key);
+}
+
+void AGridTileRenderer::ClearVisual(const UObject* Owner, EGridTileVisualSlot Slot)
+{
+	RemoveInstance(FInstanceKey{ TObjectKey<UObject>(Owner), Slot });
+}
+
+void AGridTileRenderer::ClearVisuals(const UObject* Owner)
+{
+	for (const EGridTileVisualSlot Slot : { EGridTileVisualSlot::Soil, EGridTileVisualSlot::WateredOverlay, EGridTileVisualSlot::Crop })
+	{
+		ClearVisual(Owner, Slot);
+	}
+}
+
+int32 AGridTileRenderer::FindOrAddBatch(const UStaticMeshComponent* Template)
+{
+	FBatchKey BatchKey;
+	BatchKey.Mesh = Template->GetStaticMesh();
+	const int32 NumMaterials = Template->GetNumMaterials();
+	BatchKey.Materials.Reserve(NumMaterials);
+	for (int32 Index = 0; Index < NumMaterials; ++Index)
+	{
+		BatchKey.Materials.Add(Template->GetMaterial(Index));
+	}
+
+	if (const int32* Existing = BatchLookup.Find(BatchKey))
+	{
+		return *Existing;
+	}
+
+	UHierarchicalInstancedStaticMeshComponent* Component = NewObject<UHierarchicalInstancedStaticMeshComponent>(this);
+	Component->SetupAttachment(RootComponent);
+	Component->SetStaticMesh(Template->GetStaticMesh());
+	for (int32 Index = 0; Index < NumMaterials; ++Index)
+	{
+		Component->SetMaterial(Index, Template->GetMaterial(Index));
+	}
+	Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Component->SetCastShadow(Template->CastShadow);
+	Component->SetMobility(EComponentMobility::Movable);
+	Component->RegisterComponent();
+
+	const int32 Batch = BatchComponents.Add(Component);
+	BatchInstanceKeys.AddDefaulted();
+	BatchLookup.Add(MoveTemp(BatchKey), Batch);
+	return Batch;
+}
+
+void AGridTileRenderer::RemoveInstance(const FInstanceKey& Key)
+{
+	FInstanceLocation Location;
+	if (!Instances.RemoveAndCopyValue(Key, Location))
+	{
+		return;
+	}
+
+	UHierarchicalInstancedStaticMeshComponent* Component = BatchComponents[Location.Batch];
+	TArray<FInstanceKey>& Keys = BatchInstanceKeys[Location.Batch];
+	if (Component)
+	{
+		Component->RemoveInstance(Location.Instance);
+	}
+
+	// Mirror the HISM's remove-at-swap
+	Keys.RemoveAtSwap(Location.Instance);
+	if (Keys.IsValidIndex(Location.Instance))
+	{
+		Instances[Keys[Location.Instance]].Instance = Location.Instance;
+	}
+}
+
+void AGridTileRenderer::LogStats() const
+{
+	UE_LOG(LogTemp, Log, TEXT("GridTileRenderer: %d instances in %d batches"), Instances.Num(), BatchComponents.Num());
+	for (int32 Batch = 0; Batch < BatchComponents.Num(); ++Batch)
+	{
+		const UHierarchicalInstancedStaticMeshComponent* Component = BatchComponents[Batch];
+		UE_LOG(LogTemp, Log, TEXT("  %s: %d instances"),
+			Component && Component->GetStaticMesh() ? *Component->GetStaticMesh()->GetName() : TEXT("<none>"),
+			BatchInstanceKeys[Batch].Num());
+	}
+}
@@ -0,0 +1,116 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "UObject/ObjectKey.h"
+#include "GridTileRenderer.generated.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+class UStaticMeshComponent;
+class UStaticMesh;
+class UMaterialInterface;
+
+/**
+ * Which visual of a tile actor an instance stands for. Each actor has at most one instance per slot.
+ */
+UENUM(BlueprintType)
+enum class EGridTileVisualSlot : uint8
+{
+	Soil			UMETA(DisplayName = "Soil"),
+	WateredOverlay	UMETA(DisplayName = "Watered Overlay"),
+	Crop			UMETA(DisplayName = "Crop")
+};
+
+/**
+ * Draws tile visuals (tilled soil, watered overlay, crop growth stages) for the whole map through
+ * hierarchical instanced static mesh batches, one batch per mesh and material set.
+ *
+ * Tile actors keep their mesh components as hidden templates: the component's mesh, materials and
+ * world transform decide which batch an instance goes into and where it sits, so meshes can still
+ * be positioned per stage in the viewport. Spawned on demand by UFarmGridManager::GetTileRenderer.
+ */
+UCLASS(NotPlaceable, Transient)
+class HOBUNJIHOLLOW_API AGridTileRenderer : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AGridTileRenderer();
+
+	/**
+	 * Show Template's mesh for Owner's slot, replacing any instance the slot had. Moves the existing
+	 * instance in place if the batch is unchanged. A template without a mesh clears the slot.
+	 */
+	void SetVisual(const UObject* Owner, EGridTileVisualSlot Slot, const UStaticMeshComponent* Template);
+
+	/** Remove Owner's instance for one slot */
+	void ClearVisual(const UObject* Owner, EGridTileVisualSlot Slot);
+
+	/** Remove every instance belonging to Owner */
+	void ClearVisuals(const UObject* Owner);
+
+	/** Instance counts per batch to the log */
+	UFUNCTION(BlueprintCallable, Category = "Grid|Rendering")
+	void LogStats() const;
+
+	UFUNCTION(BlueprintPure, Category = "Grid|Rendering")
+	int32 GetNumInstances() const { return Instances.Num(); }
+
+	UFUNCTION(BlueprintPure, Category = "Grid|Rendering")
+	int32 GetNumBatches() const { return BatchComponents.Num(); }
+
+protected:
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** One HISM per distinct mesh + material set */
+	UPROPERTY()
+	TArray<UHierarchicalInstancedStaticMeshComponent*> BatchComponents;
+
+	struct FInstanceKey
+	{
+		TObjectKey<UObject> Owner;
+		EGridTileVisualSlot Slot = EGridTileVisualSlot::Soil;
+
+		bool operator==(const FInstanceKey& Other) const { return Owner == Other.Owner && Slot == Other.Slot; }
+		friend uint32 GetTypeHash(const FInstanceKey& Key) { return HashCombine(GetTypeHash(Key.Owner), static_cast<uint32>(Key.Slot)); }
+	};
+
+	struct FBatchKey
+	{
+		TObjectKey<UStaticMesh> Mesh;
+		TArray<TObjectKey<UMaterialInterface>> Materials;
+
+		bool operator==(const FBatchKey& Other) const { return Mesh == Other.Mesh && Materials == Other.Materials; }
+		friend uint32 GetTypeHash(const FBatchKey& Key)
+		{
+			uint32 Hash = GetTypeHash(Key.Mesh);
+			for (const TObjectKey<UMaterialInterface>& Material : Key.Materials)
+			{
+				Hash = HashCombine(Hash, GetTypeHash(Material));
+			}
+			return Hash;
+		}
+	};
+
+	struct FInstanceLocation
+	{
+		int32 Batch = INDEX_NONE;
+		int32 Instance = INDEX_NONE;
+	};
+
+	/** Where each owner/slot instance lives */
+	TMap<FInstanceKey, FInstanceLocation> Instances;
+
+	/** Owner/slot of every instance, per batch, in HISM instance order */
+	TArray<TArray<FInstanceKey>> BatchInstanceKeys;
+
+	TMap<FBatchKey, int32> BatchLookup;
+
+	/** Find or create the batch drawing Template's mesh and materials */
+	int32 FindOrAddBatch(const UStaticMeshComponent* Template);
+
+	/** Remove one instance; HISM fills the hole with its last instance, so that one's location is patched */
+	void RemoveInstance(const FInstanceKey& Key);
+};
@@ -91,6 +91,17 @@ enum class EZoneType : uint8
 	Trigger		UMETA(DisplayName = "Event Trigger")
 };
 
+/**
+ * Shape of a zone region
+ */
+UENUM(BlueprintType)
+enum class EZoneShape : uint8
+{
+	Rect		UMETA(DisplayName = "Rectangle"),
+	Polygon		UMETA(DisplayName = "Polygon"),
+	Unknown		UMETA(DisplayName = "Unknown")
+};
+
 /**
  * Cardinal directions for facing
  */
@@ -145,6 +156,60 @@ struct HOBUNJIHOLLOW_API FGridCell
 	bool IsFarmable() const { return TerrainType == ETerrainType::Tillable || bIsTilled; }
 };
 
+/**
+ * Search strategy for grid pathfinding
+ */
+UENUM(BlueprintType)
+enum class EGridPathSearchMode : uint8
+{
+	/** Hierarchical on maps above the manager's size threshold, flat otherwise */
+	Auto			UMETA(DisplayName = "Auto"),
+	Flat			UMETA(DisplayName = "Flat A*"),
+	Hierarchical	UMETA(DisplayName = "Hierarchical")
+};
+
+/**
+ * Parameters for a grid path search
+ */
+USTRUCT(BlueprintType)
+struct HOBUNJIHOLLOW_API FGridPathQuery
+{
+	GENERATED_BODY()
+
+	/** Allow diagonal steps (never cuts past a blocked corner) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pathfinding")
+	bool bAllowDiagonal = true;
+
+	/** Agent footprint width in tiles; the path tracks the footprint's min-corner tile */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pathfinding", meta = (ClampMin = "1"))
+	int32 AgentWidth = 1;
+
+	/** Agent footprint height in tiles */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pathfinding", meta = (ClampMin = "1"))
+	int32 AgentHeight = 1;
+
+	/** Keep the path inside playable bounds zones (if the map defines any) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pathfinding")
+	bool bStayInPlayableBounds = true;
+
+	/** Treat restricted (NPC-only) zones as impassable */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pathfinding")
+	bool bAvoidRestrictedZones = false;
+
+	/** Give up after expanding this many tiles (0 = no limit); flat searches only */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pathfinding", meta = (ClampMin = "0"))
+	int32 MaxExpandedTiles = 0;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Grid|Pathfinding")
+	EGridPathSearchMode SearchMode = EGridPathSearchMode::Auto;
+
+	/** True if passability matches the one the hierarchical layer is built for */
+	bool UsesDefaultPassability() const
+	{
+		return bAllowDiagonal && AgentWidth <= 1 && AgentHeight <= 1 && bStayInPlayableBounds && !bAvoidRestrictedZones;
+	}
+};
+
 /**
  * Grid configuration for a map
  */
@@ -0,0 +1,176 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "GridZoneIndex.h"
+
+FIntRect FGridZoneIndex::ComputeBounds(const FMapZoneData& Zone, EZoneShape Shape)
+{
+	if (Shape == EZoneShape::Rect)
+	{
+		return FIntRect(Zone.X, Zone.Y, Zone.X + FMath::Max(0, Zone.Width), Zone.Y + FMath::Max(0, Zone.Height));
+	}
+
+	if (Shape == EZoneShape::Polygon && Zone.Points.Num() >= 3)
+	{
+		// The ray-cast test never reports points on the max edges as inside, so max is exclusive
+		FIntRect Bounds(Zone.Points[0].X, Zone.Points[0].Y, Zone.Points[0].X, Zone.Points[0].Y);
+		for (const FMapPoint& Point : Zone.Points)
+		{
+			Bounds.Min.X = FMath::Min(Bounds.Min.X, Point.X);
+			Bounds.Min.Y = FMath::Min(Bounds.Min.Y, Point.Y);
+			Bounds.Max.X = FMath::Max(Bounds.Max.X, Point.X);
+			Bounds.Max.Y = FMath::Max(Bounds.Max.Y, Point.Y);
+		}
+		return Bounds;
+	}
+
+	return FIntRect();
+}
+
+void FGridZoneIndex::Build(const TArray<FMapZoneData>& Zones, int32 InWidth, int32 InHeight)
+{
+	Reset();
+
+	Width = FMath::Max(0, InWidth);
+	Height = FMath::Max(0, InHeight);
+	BucketsX = (Width + (1 << BucketShift) - 1) >> BucketShift;
+	BucketsY = (Height + (1 << BucketShift) - 1) >> BucketShift;
+
+	TypeMasks.SetNumZeroed(Width * Height);
+
+	// Compile and rasterise each zone over its in-grid bounding box
+	CompiledZones.Reserve(Zones.Num());
+	for (const FMapZoneData& Zone : Zones)
+	{
+		FCompiledZone& Compiled = CompiledZones.AddDefaulted_GetRef();
+		Compiled.Type = Zone.GetZoneType();
+		Compiled.Shape = Zone.GetZoneShape();
+		Compiled.Bounds = ComputeBounds(Zone, Compiled.Shape);
+		Compiled.Source = Zone;
+
+		PresentTypes |= GetTypeBit(Compiled.Type);
+
+		Compiled.BakedBounds = FIntRect(
+			FMath::Clamp(Compiled.Bounds.Min.X, 0, Width),
+			FMath::Clamp(Compiled.Bounds.Min.Y, 0, Height),
+			FMath::Clamp(Compiled.Bounds.Max.X, 0, Width),
+			FMath::Clamp(Compiled.Bounds.Max.Y, 0, Height));
+
+		const int32 BakedWidth = Compiled.BakedBounds.Width();
+		const int32 BakedHeight = Compiled.BakedBounds.Height();
+		if (BakedWidth <= 0 || BakedHeight <= 0)
+		{
+			Compiled.BakedBounds = FIntRect();
+			continue;
+		}
+
+		Compiled.Coverage.Init(false, BakedWidth * BakedHeight);
+
+		const uint8 TypeBit = GetTypeBit(Compiled.Type);
+		for (int32 Y = Compiled.BakedBounds.Min.Y; Y < Compiled.BakedBounds.Max.Y; ++Y)
+		{
+			for (int32 X = Compiled.BakedBounds.Min.X; X < Compiled.BakedBounds.Max.X; ++X)
+			{
+				const bool bInside = (Compiled.Shape == EZoneShape::Rect) || Zone.ContainsPoint(X, Y);
+				if (bInside)
+				{
+					Compiled.Coverage[(Y - Compiled.BakedBounds.Min.Y) * BakedWidth + (X - Compiled.BakedBounds.Min.X)] = true;
+					TypeMasks[Y * Width + X] |= TypeBit;
+				}
+			}
+		}
+	}
+
+	// Bucket zones by the 16x16 tile buckets their baked bounds overlap
+	const int32 NumBuckets = BucketsX * BucketsY;
+	TArray<int32> BucketCounts;
+	BucketCounts.SetNumZeroed(NumBuckets);
+
+	auto ForEachOverlappedBucket = [this](const FCompiledZone& Compiled, auto&& Visit)
+	{
+		if (Compiled.BakedBounds.Width() <= 0 || Compiled.BakedBounds.Height() <= 0)
+		{
+			return;
+		}
+
+		const int32 MinBX = Compiled.BakedBounds.Min.X >> BucketShift;
+		const int32 MinBY = Compiled.BakedBounds.Min.Y >> BucketShift;
+		const int32 MaxBX = (Compiled.BakedBounds.Max.X - 1) >> BucketShift;
+		const int32 MaxBY = (Compiled.BakedBounds.Max.Y - 1) >> BucketShift;
+		for (int32 BY = MinBY; BY <= MaxBY; ++BY)
+		{
+			for (int32 BX = MinBX; BX <= MaxBX; ++BX)
+			{
+				Visit(BY * BucketsX + BX);
+			}
+		}
+	};
+
+	for (const FCompiledZone& Compiled : CompiledZones)
+	{
+		ForEachOverlappedBucket(Compiled, [&BucketCounts](int32 Bucket) { ++BucketCounts[Bucket]; });
+	}
+
+	BucketStarts.SetNumUninitialized(NumBuckets + 1);
+	BucketStarts[0] = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		BucketStarts[Bucket + 1] = BucketStarts[Bucket] + BucketCounts[Bucket];
+	}
+
+	// Zones are appended in source order, so per-bucket lists keep the original zone order
+	BucketZones.SetNumUninitialized(BucketStarts[NumBuckets]);
+	TArray<int32> WriteCursor(BucketStarts.GetData(), NumBuckets);
+	for (int32 ZoneIndex = 0; ZoneIndex < CompiledZones.Num(); ++ZoneIndex)
+	{
+		ForEachOverlappedBucket(CompiledZones[ZoneIndex], [this, &WriteCursor, ZoneIndex](int32 Bucket)
+		{
+			BucketZones[WriteCursor[Bucket]++] = ZoneIndex;
+		});
+	}
+}
+
+void FGridZoneIndex::Reset()
+{
+	CompiledZones.Empty();
+	TypeMasks.Empty();
+	BucketStarts.Empty();
+	BucketZones.Empty();
+	PresentTypes = 0;
+	Width = 0;
+	Height = 0;
+	BucketsX = 0;
+	BucketsY = 0;
+}
+
+bool FGridZoneIndex::ContainsUnbaked(int32 ZoneIndex, int32 X, int32 Y) const
+{
+	const FCompiledZone& Compiled = CompiledZones[ZoneIndex];
+	if (X < Compiled.Bounds.Min.X || X >= Compiled.Bounds.Max.X || Y < Compiled.Bounds.Min.Y || Y >= Compiled.Bounds.Max.Y)
+	{
+		return false;
+	}
+	return Compiled.Shape == EZoneShape::Rect || Compiled.Source.ContainsPoint(X, Y);
+}
+
+bool FGridZoneIndex::IsInZoneType(int32 X, int32 Y, EZoneType Type) const
+{
+	const uint8 TypeBit = GetTypeBit(Type);
+	if ((PresentTypes & TypeBit) == 0)
+	{
+		return false;
+	}
+
+	if (IsInGrid(X, Y))
+	{
+		return (TypeMasks[Y * Width + X] & TypeBit) != 0;
+	}
+
+	for (int32 ZoneIndex = 0; ZoneIndex < CompiledZones.Num(); ++ZoneIndex)
+	{
+		if (CompiledZones[ZoneIndex].Type == Type && ContainsUnbaked(ZoneIndex, X, Y))
+		{
+			return true;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,119 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GridTypes.h"
+#include "MapDataTypes.h"
+
+/**
+ * Spatial index over map zones, built once per map load.
+ *
+ * Every zone is parsed to its enum type/shape and rasterised over its bounding box.
+ * In-grid tiles carry a bitmask of the zone types that cover them, so type queries
+ * (bounds, indoor, ...) are a single byte read. Zones are also bucketed into
+ * 16x16 tile buckets for queries that need the individual zones at a tile.
+ * Tiles outside the grid fall back to testing each zone's bounding box and shape.
+ */
+class HOBUNJIHOLLOW_API FGridZoneIndex
+{
+public:
+	static constexpr int32 BucketShift = 4;
+
+	/** Build the index for the given zones on a Width x Height grid */
+	void Build(const TArray<FMapZoneData>& Zones, int32 InWidth, int32 InHeight);
+
+	void Reset();
+
+	/** Whether any zone of this type exists on the map */
+	bool HasZoneType(EZoneType Type) const { return (PresentTypes & GetTypeBit(Type)) != 0; }
+
+	/** Whether any zone of this type covers the tile */
+	bool IsInZoneType(int32 X, int32 Y, EZoneType Type) const;
+
+	/** Visit the index (into the array passed to Build) of every zone covering the tile, in original order */
+	template <typename FuncType>
+	void ForEachZoneAt(int32 X, int32 Y, FuncType&& Func) const
+	{
+		if (IsInGrid(X, Y))
+		{
+			if (TypeMasks[Y * Width + X] == 0)
+			{
+				return;
+			}
+
+			const int32 Bucket = (Y >> BucketShift) * BucketsX + (X >> BucketShift);
+			for (int32 i = BucketStarts[Bucket]; i < BucketStarts[Bucket + 1]; ++i)
+			{
+				const int32 ZoneIndex = BucketZones[i];
+				if (CompiledZones[ZoneIndex].ContainsBaked(X, Y))
+				{
+					Func(ZoneIndex);
+				}
+			}
+			return;
+		}
+
+		for (int32 ZoneIndex = 0; ZoneIndex < CompiledZones.Num(); ++ZoneIndex)
+		{
+			if (ContainsUnbaked(ZoneIndex, X, Y))
+			{
+				Func(ZoneIndex);
+			}
+		}
+	}
+
+	static uint8 GetTypeBit(EZoneType Type) { return static_cast<uint8>(1u << static_cast<uint8>(Type)); }
+
+private:
+	struct FCompiledZone
+	{
+		EZoneType Type = EZoneType::Bounds;
+		EZoneShape Shape = EZoneShape::Unknown;
+
+		/** Full bounding box, max exclusive */
+		FIntRect Bounds;
+
+		/** Bounding box clamped to the grid; Coverage is laid out over this rect */
+		FIntRect BakedBounds;
+
+		/** One bit per tile of BakedBounds, row-major */
+		TBitArray<> Coverage;
+
+		/** Source data, used for tiles outside the grid */
+		FMapZoneData Source;
+
+		bool ContainsBaked(int32 X, int32 Y) const
+		{
+			if (X < BakedBounds.Min.X || X >= BakedBounds.Max.X || Y < BakedBounds.Min.Y || Y >= BakedBounds.Max.Y)
+			{
+				return false;
+			}
+			return Coverage[(Y - BakedBounds.Min.Y) * BakedBounds.Width() + (X - BakedBounds.Min.X)];
+		}
+	};
+
+	bool IsInGrid(int32 X, int32 Y) const
+	{
+		return static_cast<uint32>(X) < static_cast<uint32>(Width) && static_cast<uint32>(Y) < static_cast<uint32>(Height);
+	}
+
+	bool ContainsUnbaked(int32 ZoneIndex, int32 X, int32 Y) const;
+
+	static FIntRect ComputeBounds(const FMapZoneData& Zone, EZoneShape Shape);
+
+	TArray<FCompiledZone> CompiledZones;
+
+	/** Per-tile bitmask of covering zone types (bit = 1 << EZoneType) */
+	TArray<uint8> TypeMasks;
+
+	/** Bucketed zone lists in CSR layout: zones of bucket B are BucketZones[BucketStarts[B] .. BucketStarts[B + 1]) */
+	TArray<int32> BucketStarts;
+	TArray<int32> BucketZones;
+
+	uint8 PresentTypes = 0;
+	int32 Width = 0;
+	int32 Height = 0;
+	int32 BucketsX = 0;
+	int32 BucketsY = 0;
+};
@@ -0,0 +1,275 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MapDataCookedFile.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace MapDataCookedFile
+{
+	/** Dense terrain value for a tile with no explicit entry */
+	static constexpr uint8 NoTile = 0xFF;
+
+	/** Element counts read from disk can't exceed the bytes left (every element takes at least one) */
+	static bool SerializeCount(FArchive& Ar, int32& Num)
+	{
+		Ar << Num;
+		if (Ar.IsLoading() && (Num < 0 || Num > Ar.TotalSize() - Ar.Tell()))
+		{
+			Ar.SetError();
+		}
+		return !Ar.IsError();
+	}
+
+	template <typename StructType>
+	static bool SerializeStructArray(FArchive& Ar, TArray<StructType>& Items)
+	{
+		int32 Num = Items.Num();
+		if (!SerializeCount(Ar, Num))
+		{
+			return false;
+		}
+
+		if (Ar.IsLoading())
+		{
+			Items.SetNum(Num);
+		}
+		for (StructType& Item : Items)
+		{
+			StructType::StaticStruct()->SerializeBin(Ar, &Item);
+		}
+		return !Ar.IsError();
+	}
+
+	static bool SaveTerrain(FArchive& Ar, const FMapData& Data)
+	{
+		const int32 Width = FMath::Max(0, Data.Grid.Width);
+		const int32 Height = FMath::Max(0, Data.Grid.Height);
+
+		// Only unique, in-bounds, property-less tiles go into the dense layer. Anything else keeps
+		// its original order in the explicit list so "last tile wins" still holds on load.
+		TArray<uint8> TileCounts;
+		TileCounts.SetNumZeroed(Width * Height);
+		for (const FMapTerrainTile& Tile : Data.Terrain)
+		{
+			if (Tile.X >= 0 && Tile.Y >= 0 && Tile.X < Width && Tile.Y < Height)
+			{
+				uint8& Count = TileCounts[Tile.Y * Width + Tile.X];
+				Count = static_cast<uint8>(FMath::Min(Count + 1, 2));
+			}
+		}
+
+		TArray<uint8> Dense;
+		Dense.Init(NoTile, Width * Height);
+		TArray<int32> ExplicitTiles;
+		for (int32 Index = 0; Index < Data.Terrain.Num(); ++Index)
+		{
+			const FMapTerrainTile& Tile = Data.Terrain[Index];
+			const bool bInBounds = Tile.X >= 0 && Tile.Y >= 0 && Tile.X < Width && Tile.Y < Height;
+			if (bInBounds && Tile.PropertiesIndex == INDEX_NONE && TileCounts[Tile.Y * Width + Tile.X] == 1)
+			{
+				Dense[Tile.Y * Width + Tile.X] = static_cast<uint8>(Tile.Type);
+			}
+			else
+			{
+				ExplicitTiles.Add(Index);
+			}
+		}
+
+		// Run-length encode the dense layer
+		TArray<TPair<uint8, int32>> Runs;
+		for (int32 Index = 0; Index < Dense.Num(); ++Index)
+		{
+			if (Runs.Num() > 0 && Runs.Last().Key == Dense[Index])
+			{
+				++Runs.Last().Value;
+			}
+			else
+			{
+				Runs.Emplace(Dense[Index], 1);
+			}
+		}
+
+		int32 NumRuns = Runs.Num();
+		Ar << NumRuns;
+		for (TPair<uint8, int32>& Run : Runs)
+		{
+			Ar << Run.Key;
+			Ar << Run.Value;
+		}
+
+		int32 NumExplicit = ExplicitTiles.Num();
+		Ar << NumExplicit;
+		for (int32 Index : ExplicitTiles)
+		{
+			const FMapTerrainTile& Tile = Data.Terrain[Index];
+			int32 X = Tile.X;
+			int32 Y = Tile.Y;
+			uint8 Type = static_cast<uint8>(Tile.Type);
+			TMap<FString, FString> Properties;
+			if (const TMap<FString, FString>* TileProperties = Data.GetTerrainProperties(Tile))
+			{
+				Properties = *TileProperties;
+			}
+
+			Ar << X << Y << Type << Properties;
+		}
+
+		return !Ar.IsError();
+	}
+
+	static bool LoadTerrain(FArchive& Ar, FMapData& Data)
+	{
+		const int32 Width = FMath::Max(0, Data.Grid.Width);
+		const int32 Height = FMath::Max(0, Data.Grid.Height);
+		const uint8 MaxType = static_cast<uint8>(ETerrainType::Path);
+
+		int32 NumRuns = 0;
+		if (!SerializeCount(Ar, NumRuns))
+		{
+			return false;
+		}
+
+		int32 TileIndex = 0;
+		for (int32 RunIndex = 0; RunIndex < NumRuns; ++RunIndex)
+		{
+			uint8 Value = NoTile;
+			int32 Length = 0;
+			Ar << Value << Length;
+			if (Ar.IsError() || Length <= 0 || Length > Width * Height - TileIndex || (Value != NoTile && Value > MaxType))
+			{
+				Ar.SetError();
+				return false;
+			}
+
+			if (Value != NoTile)
+			{
+				for (int32 Offset = 0; Offset < Length; ++Offset)
+				{
+					const int32 Index = TileIndex + Offset;
+					Data.AddTerrainTile(Index % Width, Index / Width, static_cast<ETerrainType>(Value), {});
+				}
+			}
+			TileIndex += Length;
+		}
+
+		if (TileIndex != Width * Height)
+		{
+			Ar.SetError();
+			return false;
+		}
+
+		int32 NumExplicit = 0;
+		if (!SerializeCount(Ar, NumExplicit))
+		{
+			return false;
+		}
+
+		for (int32 Index = 0; Index < NumExplicit; ++Index)
+		{
+			int32 X = 0;
+			int32 Y = 0;
+			uint8 Type = 0;
+			TMap<FString, FString> Properties;
+			Ar << X << Y << Type << Properties;
+			if (Ar.IsError() || Type > MaxType)
+			{
+				Ar.SetError();
+				return false;
+			}
+
+			Data.AddTerrainTile(X, Y, static_cast<ETerrainType>(Type), MoveTemp(Properties));
+		}
+
+		return true;
+	}
+}
+
+FString FMapDataCookedFile::GetCookedPath(const FString& JsonPath)
+{
+	return FPaths::ChangeExtension(JsonPath, TEXT("mapbin"));
+}
+
+bool FMapDataCookedFile::IsUpToDate(const FString& JsonPath, const FString& CookedPath)
+{
+	IFileManager& FileManager = IFileManager::Get();
+	const FDateTime CookedTime = FileManager.GetTimeStamp(*CookedPath);
+	if (CookedTime == FDateTime::MinValue())
+	{
+		return false;
+	}
+
+	// A missing JSON (e.g. not staged in a packaged build) reports MinValue, so the cooked file wins
+	return CookedTime >= FileManager.GetTimeStamp(*JsonPath);
+}
+
+bool FMapDataCookedFile::Write(const FMapData& Data, const FString& CookedPath)
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes, /*bIsPersistent*/ true);
+
+	// Saving only reads from Data
+	if (!Serialize(Writer, const_cast<FMapData&>(Data)))
+	{
+		return false;
+	}
+
+	return FFileHelper::SaveArrayToFile(Bytes, *CookedPath);
+}
+
+bool FMapDataCookedFile::Read(const FString& CookedPath, FMapData& OutData)
+{
+	// One bulk read, then decode from memory
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *CookedPath, FILEREAD_Silent))
+	{
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes, /*bIsPersistent*/ true);
+	return Serialize(Reader, OutData);
+}
+
+bool FMapDataCookedFile::Serialize(FArchive& Ar, FMapData& Data)
+{
+	using namespace MapDataCookedFile;
+
+	uint32 FileMagic = Magic;
+	int32 LayoutVersion = CookedLayoutVersion;
+	Ar << FileMagic << LayoutVersion;
+	if (Ar.IsError() || FileMagic != Magic || LayoutVersion != CookedLayoutVersion)
+	{
+		return false;
+	}
+
+	Ar << Data.FormatVersion;
+	if (Ar.IsLoading())
+	{
+		// Cooked data is only trusted for the map format this build was written against
+		if (Ar.IsError() || Data.FormatVersion != FMapData().FormatVersion)
+		{
+			return false;
+		}
+		Data.Terrain.Reset();
+		Data.TerrainProperties.Reset();
+	}
+
+	Ar << Data.MapId << Data.DisplayName << Data.DefaultTerrain;
+	FMapMetadata::StaticStruct()->SerializeBin(Ar, &Data.Metadata);
+	FMapGridConfig::StaticStruct()->SerializeBin(Ar, &Data.Grid);
+	if (Ar.IsError())
+	{
+		return false;
+	}
+
+	const bool bTerrainOk = Ar.IsLoading() ? LoadTerrain(Ar, Data) : SaveTerrain(Ar, Data);
+	return bTerrainOk
+		&& SerializeStructArray(Ar, Data.Objects)
+		&& SerializeStructArray(Ar, Data.Zones)
+		&& SerializeStructArray(Ar, Data.Spawners)
+		&& SerializeStructArray(Ar, Data.Paths)
+		&& SerializeStructArray(Ar, Data.Roads)
+		&& SerializeStructArray(Ar, Data.Connections);
+}
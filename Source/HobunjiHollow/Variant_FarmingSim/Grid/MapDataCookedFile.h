@@ -0,0 +1,39 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MapDataTypes.h"
+
+/**
+ * Cooked binary form of FMapData, written next to the authoring JSON as <name>.mapbin.
+ *
+ * Layout: header (magic, layout version, the map's FormatVersion), grid config, terrain,
+ * then the remaining layers. Terrain is a run-length encoded byte per tile (terrain type,
+ * or "no explicit tile"); tiles that carry properties, fall outside the grid or repeat a
+ * coordinate are stored individually after the runs. The other layers use each struct's
+ * binary property serialization, so CookedLayoutVersion must be bumped whenever a map
+ * struct gains, loses or reorders a UPROPERTY.
+ *
+ * Files are read with a single bulk read and decoded from memory.
+ */
+class HOBUNJIHOLLOW_API FMapDataCookedFile
+{
+public:
+	static constexpr uint32 Magic = 0x504D4848; // "HHMP"
+	static constexpr int32 CookedLayoutVersion = 1;
+
+	/** Cooked file path for a JSON map path */
+	static FString GetCookedPath(const FString& JsonPath);
+
+	/** True if CookedPath exists and is at least as new as JsonPath (or JsonPath is missing) */
+	static bool IsUpToDate(const FString& JsonPath, const FString& CookedPath);
+
+	static bool Write(const FMapData& Data, const FString& CookedPath);
+
+	/** Rejects files with a different magic, layout version or FormatVersion than this build reads */
+	static bool Read(const FString& CookedPath, FMapData& OutData);
+
+	/** Encode/decode in memory (the archive direction decides which) */
+	static bool Serialize(FArchive& Ar, FMapData& Data);
+};
@@ -2,17 +2,31 @@
 
 #include "MapDataImporter.h"
 #include "FarmGridManager.h"
+#include "TerrainHeightBatch.h"
+#include "MapDataStreamReader.h"
+#include "MapDataCookedFile.h"
+#include "BlockedCollisionBuilder.h"
 #include "ObjectClassRegistry.h"
 #include "GridFootprintComponent.h"
+#include "GridActorPool.h"
 #include "Components/SceneComponent.h"
 #include "Components/LineBatchComponent.h"
 #include "Components/BoxComponent.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
+#include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "Engine/World.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+#include "Algo/StableSort.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
 #include "DrawDebugHelpers.h"
 
 AMapDataImporter::AMapDataImporter()
@@ -31,6 +45,11 @@ void AMapDataImporter::BeginPlay()
 {
 	Super::BeginPlay();
 
+	if (UGridActorPool* Pool = GetWorld()->GetSubsystem<UGridActorPool>())
+	{
+		ActorReleasedHandle = Pool->OnActorReleased.AddUObject(this, &AMapDataImporter::HandleActorReleased);
+	}
+
 	if (bAutoSpawnOnBeginPlay && !JsonFilePath.IsEmpty())
 	{
 		if (ImportFromJson())
@@ -45,6 +64,13 @@ void AMapDataImporter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	ClearSpawnedObjects();
 	ClearBlockedCollision();
 	DestroyGridLineBatch();
+
+	if (UGridActorPool* Pool = GetWorld()->GetSubsystem<UGridActorPool>())
+	{
+		Pool->OnActorReleased.Remove(ActorReleasedHandle);
+	}
+	ActorReleasedHandle.Reset();
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -97,7 +123,8 @@ void AMapDataImporter::PostEditChangeProperty(FPropertyChangedEvent& PropertyCha
 	else if (PropertyName == GET_MEMBER_NAME_CHECKED(AMapDataImporter, bGenerateBlockedCollision) ||
 			 PropertyName == GET_MEMBER_NAME_CHECKED(AMapDataImporter, BlockedCollisionHeight) ||
 			 PropertyName == GET_MEMBER_NAME_CHECKED(AMapDataImporter, CollisionDepthBelow) ||
-			 PropertyName == GET_MEMBER_NAME_CHECKED(AMapDataImporter, BlockedCollisionProfile))
+			 PropertyName == GET_MEMBER_NAME_CHECKED(AMapDataImporter, BlockedCollisionProfile) ||
+			 PropertyName == GET_MEMBER_NAME_CHECKED(AMapDataImporter, MaxMergedHeightDifference))
 	{
 		RebuildBlockedCollision();
 	}
@@ -121,6 +148,17 @@ bool AMapDataImporter::ImportFromJson()
 }
 
 bool AMapDataImporter::ImportFromJsonFile(const FString& FilePath)
+{
+	if (!LoadMapData(FilePath))
+	{
+		return false;
+	}
+
+	ApplyParsedMapData();
+	return true;
+}
+
+bool AMapDataImporter::LoadMapData(const FString& FilePath)
 {
 	if (FilePath.IsEmpty())
 	{
@@ -129,10 +167,22 @@ bool AMapDataImporter::ImportFromJsonFile(const FString& FilePath)
 	}
 
 	// Resolve path
-	FString FullPath = FilePath;
-	if (FPaths::IsRelative(FullPath))
+	const FString FullPath = ResolveJsonPath(FilePath);
+
+	// Prefer the cooked binary when it is at least as new as the JSON
+	if (bUseCookedMapData)
 	{
-		FullPath = FPaths::Combine(FPaths::ProjectContentDir(), FullPath);
+		const FString CookedPath = FMapDataCookedFile::GetCookedPath(FullPath);
+		if (FMapDataCookedFile::IsUpToDate(FullPath, CookedPath))
+		{
+			bHasValidData = false;
+			if (FMapDataCookedFile::Read(CookedPath, ParsedMapData))
+			{
+				bHasValidData = true;
+				return true;
+			}
+			UE_LOG(LogTemp, Warning, TEXT("MapDataImporter: Cooked map %s is unreadable or outdated, falling back to JSON"), *CookedPath);
+		}
 	}
 
 	// Read file
@@ -143,95 +193,165 @@ bool AMapDataImporter::ImportFromJsonFile(const FString& FilePath)
 		return false;
 	}
 
-	return ImportFromJsonString(JsonString);
+	bHasValidData = ParseJsonString(JsonString, bUseStreamingJsonReader);
+	return bHasValidData;
 }
 
-bool AMapDataImporter::ImportFromJsonString(const FString& JsonString)
+void AMapDataImporter::CookMapData()
 {
-	bHasValidData = false;
+	if (JsonFilePath.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MapDataImporter: No JSON file path specified"));
+		return;
+	}
 
-	// Parse JSON
-	TSharedPtr<FJsonObject> JsonObject;
-	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	const FString FullPath = ResolveJsonPath(JsonFilePath);
+	FString JsonString;
+	FMapData MapData;
+	FString Error;
+	if (!FFileHelper::LoadFileToString(JsonString, *FullPath) || !FMapDataStreamReader::ReadFromString(JsonString, MapData, Error))
+	{
+		UE_LOG(LogTemp, Error, TEXT("MapDataImporter: Failed to cook %s: %s"), *FullPath, *Error);
+		return;
+	}
 
-	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	const FString CookedPath = FMapDataCookedFile::GetCookedPath(FullPath);
+	if (!FMapDataCookedFile::Write(MapData, CookedPath))
 	{
-		UE_LOG(LogTemp, Error, TEXT("MapDataImporter: Failed to parse JSON"));
-		return false;
+		UE_LOG(LogTemp, Error, TEXT("MapDataImporter: Failed to write %s"), *CookedPath);
+		return;
 	}
 
-	if (!ParseJsonObject(JsonObject))
+	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Cooked %s (%lld bytes JSON -> %lld bytes)"),
+		*CookedPath, IFileManager::Get().FileSize(*FullPath), IFileManager::Get().FileSize(*CookedPath));
+}
+
+FString AMapDataImporter::ResolveJsonPath(const FString& FilePath)
+{
+	if (FPaths::IsRelative(FilePath))
+	{
+		return FPaths::Combine(FPaths::ProjectContentDir(), FilePath);
+	}
+	return FilePath;
+}
+
+bool AMapDataImporter::ImportFromJsonString(const FString& JsonString)
+{
+	bHasValidData = false;
+
+	if (!ParseJsonString(JsonString, bUseStreamingJsonReader))
 	{
 		return false;
 	}
 
 	bHasValidData = true;
+	ApplyParsedMapData();
+	return true;
+}
 
+void AMapDataImporter::ApplyParsedMapData()
+{
 	// Initialize grid manager with parsed data and actor's transform
 	if (UFarmGridManager* GridManager = GetGridManager())
 	{
 		GridManager->InitializeFromMapData(ParsedMapData);
 		// Use actor's transform: location for offset, X scale for grid scale, yaw for rotation
 		GridManager->SetGridTransform(GetActorLocation(), GetActorScale3D().X, GetActorRotation().Yaw);
+
+		// Level geometry is loaded by now; sample terrain heights once instead of per query
+		UWorld* World = GetWorld();
+		if (World && World->IsGameWorld())
+		{
+			GridManager->BakeHeightCache();
+		}
+	}
+
+	if (UGridActorPool* Pool = GetWorld() ? GetWorld()->GetSubsystem<UGridActorPool>() : nullptr)
+	{
+		Pool->PrewarmFromMapData(ParsedMapData, PrewarmPerTillableTile);
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Successfully imported map '%s' (%dx%d)"),
 		*ParsedMapData.DisplayName, ParsedMapData.Grid.Width, ParsedMapData.Grid.Height);
+}
 
-	return true;
+bool AMapDataImporter::ParseJsonString(const FString& JsonString, bool bStreaming)
+{
+	if (bStreaming)
+	{
+		FString Error;
+		if (!FMapDataStreamReader::ReadFromString(JsonString, ParsedMapData, Error))
+		{
+			UE_LOG(LogTemp, Error, TEXT("MapDataImporter: Failed to parse JSON: %s"), *Error);
+			return false;
+		}
+		return true;
+	}
+
+	// Parse JSON
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("MapDataImporter: Failed to parse JSON"));
+		return false;
+	}
+
+	return ParseJsonObject(JsonObject, ParsedMapData);
 }
 
-bool AMapDataImporter::ParseJsonObject(const TSharedPtr<FJsonObject>& JsonObject)
+bool AMapDataImporter::ParseJsonObject(const TSharedPtr<FJsonObject>& JsonObject, FMapData& OutData)
 {
 	// Reset data
-	ParsedMapData = FMapData();
+	OutData = FMapData();
 
 	// Parse root fields
-	JsonObject->TryGetStringField(TEXT("formatVersion"), ParsedMapData.FormatVersion);
-	JsonObject->TryGetStringField(TEXT("mapId"), ParsedMapData.MapId);
-	JsonObject->TryGetStringField(TEXT("displayName"), ParsedMapData.DisplayName);
-	JsonObject->TryGetStringField(TEXT("defaultTerrain"), ParsedMapData.DefaultTerrain);
+	JsonObject->TryGetStringField(TEXT("formatVersion"), OutData.FormatVersion);
+	JsonObject->TryGetStringField(TEXT("mapId"), OutData.MapId);
+	JsonObject->TryGetStringField(TEXT("displayName"), OutData.DisplayName);
+	JsonObject->TryGetStringField(TEXT("defaultTerrain"), OutData.DefaultTerrain);
 
 	// Parse metadata
 	if (const TSharedPtr<FJsonObject>* MetaObject = nullptr; JsonObject->TryGetObjectField(TEXT("metadata"), MetaObject))
 	{
-		(*MetaObject)->TryGetStringField(TEXT("author"), ParsedMapData.Metadata.Author);
-		(*MetaObject)->TryGetStringField(TEXT("created"), ParsedMapData.Metadata.Created);
-		(*MetaObject)->TryGetStringField(TEXT("modified"), ParsedMapData.Metadata.Modified);
-		(*MetaObject)->TryGetStringField(TEXT("description"), ParsedMapData.Metadata.Description);
+		(*MetaObject)->TryGetStringField(TEXT("author"), OutData.Metadata.Author);
+		(*MetaObject)->TryGetStringField(TEXT("created"), OutData.Metadata.Created);
+		(*MetaObject)->TryGetStringField(TEXT("modified"), OutData.Metadata.Modified);
+		(*MetaObject)->TryGetStringField(TEXT("description"), OutData.Metadata.Description);
 	}
 
 	// Parse grid config
 	if (const TSharedPtr<FJsonObject>* GridObject = nullptr; JsonObject->TryGetObjectField(TEXT("grid"), GridObject))
 	{
-		(*GridObject)->TryGetNumberField(TEXT("width"), ParsedMapData.Grid.Width);
-		(*GridObject)->TryGetNumberField(TEXT("height"), ParsedMapData.Grid.Height);
-		(*GridObject)->TryGetNumberField(TEXT("cellSize"), ParsedMapData.Grid.CellSize);
+		(*GridObject)->TryGetNumberField(TEXT("width"), OutData.Grid.Width);
+		(*GridObject)->TryGetNumberField(TEXT("height"), OutData.Grid.Height);
+		(*GridObject)->TryGetNumberField(TEXT("cellSize"), OutData.Grid.CellSize);
 
 		if (const TSharedPtr<FJsonObject>* OffsetObject = nullptr; (*GridObject)->TryGetObjectField(TEXT("originOffset"), OffsetObject))
 		{
 			double X = 0, Y = 0;
 			(*OffsetObject)->TryGetNumberField(TEXT("x"), X);
 			(*OffsetObject)->TryGetNumberField(TEXT("y"), Y);
-			ParsedMapData.Grid.OriginOffset = FVector2D(X, Y);
+			OutData.Grid.OriginOffset = FVector2D(X, Y);
 		}
 	}
 
 	// Parse layers
 	if (const TSharedPtr<FJsonObject>* LayersObject = nullptr; JsonObject->TryGetObjectField(TEXT("layers"), LayersObject))
 	{
-		ParseTerrainLayer(*LayersObject);
-		ParseObjectsLayer(*LayersObject);
-		ParseZonesLayer(*LayersObject);
-		ParseSpawnersLayer(*LayersObject);
-		ParsePathsLayer(*LayersObject);
-		ParseConnectionsLayer(*LayersObject);
+		ParseTerrainLayer(*LayersObject, OutData);
+		ParseObjectsLayer(*LayersObject, OutData);
+		ParseZonesLayer(*LayersObject, OutData);
+		ParseSpawnersLayer(*LayersObject, OutData);
+		ParsePathsLayer(*LayersObject, OutData);
+		ParseConnectionsLayer(*LayersObject, OutData);
 	}
 
 	return true;
 }
 
-void AMapDataImporter::ParseTerrainLayer(const TSharedPtr<FJsonObject>& LayersObject)
+void AMapDataImporter::ParseTerrainLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData)
 {
 	const TArray<TSharedPtr<FJsonValue>>* TerrainArray;
 	if (LayersObject->TryGetArrayField(TEXT("terrain"), TerrainArray))
@@ -241,23 +361,26 @@ void AMapDataImporter::ParseTerrainLayer(const TSharedPtr<FJsonObject>& LayersOb
 			const TSharedPtr<FJsonObject>* TileObject;
 			if (Value->TryGetObject(TileObject))
 			{
-				FMapTerrainTile Tile;
-				(*TileObject)->TryGetNumberField(TEXT("x"), Tile.X);
-				(*TileObject)->TryGetNumberField(TEXT("y"), Tile.Y);
-				(*TileObject)->TryGetStringField(TEXT("type"), Tile.Type);
-
+				int32 X = 0;
+				int32 Y = 0;
+				FString Type;
+				(*TileObject)->TryGetNumberField(TEXT("x"), X);
+				(*TileObject)->TryGetNumberField(TEXT("y"), Y);
+				(*TileObject)->TryGetStringField(TEXT("type"), Type);
+
+				TMap<FString, FString> Properties;
 				if (const TSharedPtr<FJsonObject>* PropsObject = nullptr; (*TileObject)->TryGetObjectField(TEXT("properties"), PropsObject))
 				{
-					Tile.Properties = ParsePropertiesObject(*PropsObject);
+					Properties = ParsePropertiesObject(*PropsObject);
 				}
 
-				ParsedMapData.Terrain.Add(Tile);
+				OutData.AddTerrainTile(X, Y, FMapTerrainTile::ParseTerrainType(Type), MoveTemp(Properties));
 			}
 		}
 	}
 }
 
-void AMapDataImporter::ParseObjectsLayer(const TSharedPtr<FJsonObject>& LayersObject)
+void AMapDataImporter::ParseObjectsLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData)
 {
 	const TArray<TSharedPtr<FJsonValue>>* ObjectsArray;
 	if (LayersObject->TryGetArrayField(TEXT("objects"), ObjectsArray))
@@ -282,13 +405,13 @@ void AMapDataImporter::ParseObjectsLayer(const TSharedPtr<FJsonObject>& LayersOb
 					Obj.Properties = ParsePropertiesObject(*PropsObject);
 				}
 
-				ParsedMapData.Objects.Add(Obj);
+				OutData.Objects.Add(Obj);
 			}
 		}
 	}
 }
 
-void AMapDataImporter::ParseZonesLayer(const TSharedPtr<FJsonObject>& LayersObject)
+void AMapDataImporter::ParseZonesLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData)
 {
 	const TArray<TSharedPtr<FJsonValue>>* ZonesArray;
 	if (LayersObject->TryGetArrayField(TEXT("zones"), ZonesArray))
@@ -329,13 +452,13 @@ void AMapDataImporter::ParseZonesLayer(const TSharedPtr<FJsonObject>& LayersObje
 					Zone.Properties = ParsePropertiesObject(*PropsObject);
 				}
 
-				ParsedMapData.Zones.Add(Zone);
+				OutData.Zones.Add(Zone);
 			}
 		}
 	}
 }
 
-void AMapDataImporter::ParseSpawnersLayer(const TSharedPtr<FJsonObject>& LayersObject)
+void AMapDataImporter::ParseSpawnersLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData)
 {
 	const TArray<TSharedPtr<FJsonValue>>* SpawnersArray;
 	if (LayersObject->TryGetArrayField(TEXT("spawners"), SpawnersArray))
@@ -363,13 +486,13 @@ void AMapDataImporter::ParseSpawnersLayer(const TSharedPtr<FJsonObject>& LayersO
 					Spawner.Properties = ParsePropertiesObject(*PropsObject);
 				}
 
-				ParsedMapData.Spawners.Add(Spawner);
+				OutData.Spawners.Add(Spawner);
 			}
 		}
 	}
 }
 
-void AMapDataImporter::ParsePathsLayer(const TSharedPtr<FJsonObject>& LayersObject)
+void AMapDataImporter::ParsePathsLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData)
 {
 	const TArray<TSharedPtr<FJsonValue>>* PathsArray;
 	if (LayersObject->TryGetArrayField(TEXT("paths"), PathsArray))
@@ -427,7 +550,7 @@ void AMapDataImporter::ParsePathsLayer(const TSharedPtr<FJsonObject>& LayersObje
 						Road.Properties = ParsePropertiesObject(*PropsObject);
 					}
 
-					ParsedMapData.Roads.Add(Road);
+					OutData.Roads.Add(Road);
 				}
 				else
 				{
@@ -482,14 +605,14 @@ void AMapDataImporter::ParsePathsLayer(const TSharedPtr<FJsonObject>& LayersObje
 						Path.Properties = ParsePropertiesObject(*PropsObject);
 					}
 
-					ParsedMapData.Paths.Add(Path);
+					OutData.Paths.Add(Path);
 				}
 			}
 		}
 	}
 }
 
-void AMapDataImporter::ParseConnectionsLayer(const TSharedPtr<FJsonObject>& LayersObject)
+void AMapDataImporter::ParseConnectionsLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData)
 {
 	const TArray<TSharedPtr<FJsonValue>>* ConnectionsArray;
 	if (LayersObject->TryGetArrayField(TEXT("connections"), ConnectionsArray))
@@ -515,7 +638,7 @@ void AMapDataImporter::ParseConnectionsLayer(const TSharedPtr<FJsonObject>& Laye
 					Connection.Properties = ParsePropertiesObject(*PropsObject);
 				}
 
-				ParsedMapData.Connections.Add(Connection);
+				OutData.Connections.Add(Connection);
 			}
 		}
 	}
@@ -530,38 +653,271 @@ void AMapDataImporter::SpawnAllObjects()
 	}
 
 	ClearSpawnedObjects();
+	BuildSpawnQueue();
+	RunSpawnQueue();
+}
 
-	// Spawn objects
-	for (const FMapObjectData& Obj : ParsedMapData.Objects)
+void AMapDataImporter::RunSpawnQueue()
+{
+	UWorld* World = GetWorld();
+	if (!bTimeSliceSpawning || !World || !World->IsGameWorld())
 	{
-		if (AActor* SpawnedActor = SpawnObject(Obj))
+		for (const FPendingSpawn& Pending : SpawnQueue)
 		{
-			SpawnedActors.Add(SpawnedActor);
+			SpawnPending(Pending);
 		}
+		SpawnQueue.Empty();
+
+		UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Spawned %d actors"), SpawnedActors.Num());
+		OnSpawnComplete.Broadcast(SpawnedActors.Num());
+		return;
 	}
 
-	// Spawn spawners (trees, rocks, etc.)
-	for (const FMapSpawnerData& Spawner : ParsedMapData.Spawners)
+	bSpawnQueueActive = true;
+
+	// Load any soft actor classes in the background before the first spawn needs them
+	TArray<FString> ClassIds;
+	GatherSpawnClassIds(ClassIds);
+	TArray<FSoftObjectPath> ClassPaths;
+	if (ObjectRegistry)
 	{
-		if (AActor* SpawnedActor = SpawnSpawner(Spawner))
+		ObjectRegistry->GetUnloadedClassPaths(ClassIds, ClassPaths);
+	}
+
+	if (ClassPaths.Num() > 0)
+	{
+		SpawnClassLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(ClassPaths,
+			FStreamableDelegate::CreateUObject(this, &AMapDataImporter::ProcessSpawnQueue));
+	}
+	else
+	{
+		ProcessSpawnQueue();
+	}
+}
+
+float AMapDataImporter::GetSpawnProgress() const
+{
+	if (!bSpawnQueueActive || SpawnQueue.Num() == 0)
+	{
+		return 1.0f;
+	}
+	return static_cast<float>(SpawnQueueCursor) / SpawnQueue.Num();
+}
+
+void AMapDataImporter::BuildSpawnQueue()
+{
+	SpawnQueue.Reset();
+	SpawnQueueCursor = 0;
+
+	const FVector Focus = GetSpawnFocusLocation();
+	auto AddPending = [this, &Focus](FPendingSpawn::EKind Kind, int32 Index, int32 X, int32 Y)
+	{
+		FPendingSpawn& Pending = SpawnQueue.AddDefaulted_GetRef();
+		Pending.Kind = Kind;
+		Pending.Index = Index;
+		Pending.DistanceSq = FVector::DistSquared2D(GridToWorldContinuous(X + 0.5f, Y + 0.5f), Focus);
+	};
+
+	for (int32 Index = 0; Index < ParsedMapData.Objects.Num(); ++Index)
+	{
+		const FMapObjectData& Obj = ParsedMapData.Objects[Index];
+		AddPending(FPendingSpawn::EKind::Object, Index, Obj.X, Obj.Y);
+	}
+
+	// Spawners (trees, rocks, etc.)
+	for (int32 Index = 0; Index < ParsedMapData.Spawners.Num(); ++Index)
+	{
+		const FMapSpawnerData& Spawner = ParsedMapData.Spawners[Index];
+		AddPending(FPendingSpawn::EKind::Spawner, Index, Spawner.X, Spawner.Y);
+	}
+
+	// Connections (doorways)
+	for (int32 Index = 0; Index < ParsedMapData.Connections.Num(); ++Index)
+	{
+		const FMapConnectionData& Connection = ParsedMapData.Connections[Index];
+		if (Connection.IsMapExit())
 		{
-			SpawnedActors.Add(SpawnedActor);
+			AddPending(FPendingSpawn::EKind::Connection, Index, Connection.X, Connection.Y);
 		}
 	}
 
-	// Spawn connections (doorways)
-	for (const FMapConnectionData& Connection : ParsedMapData.Connections)
+	// Stable, so equidistant spawns keep their layer order
+	Algo::StableSortBy(SpawnQueue, &FPendingSpawn::DistanceSq);
+}
+
+void AMapDataImporter::ProcessSpawnQueue()
+{
+	if (!bSpawnQueueActive)
 	{
-		if (Connection.IsMapExit())
+		return;
+	}
+
+	const double Deadline = FPlatformTime::Seconds() + SpawnBudgetMs / 1000.0;
+	do
+	{
+		if (SpawnQueueCursor >= SpawnQueue.Num())
 		{
-			if (AActor* SpawnedActor = SpawnConnection(Connection))
+			break;
+		}
+
+		SpawnPending(SpawnQueue[SpawnQueueCursor++]);
+	}
+	while (FPlatformTime::Seconds() < Deadline);
+
+	OnSpawnProgress.Broadcast(SpawnQueueCursor, SpawnQueue.Num());
+
+	if (SpawnQueueCursor >= SpawnQueue.Num())
+	{
+		FinishSpawnQueue();
+	}
+	else
+	{
+		SpawnTimerHandle = GetWorldTimerManager().SetTimerForNextTick(this, &AMapDataImporter::ProcessSpawnQueue);
+	}
+}
+
+void AMapDataImporter::FinishSpawnQueue()
+{
+	const int32 NumQueued = SpawnQueue.Num();
+	bSpawnQueueActive = false;
+	SpawnQueue.Empty();
+	SpawnQueueCursor = 0;
+	SpawnClassLoadHandle.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Spawned %d actors (%d queued)"), SpawnedActors.Num(), NumQueued);
+	OnSpawnComplete.Broadcast(SpawnedActors.Num());
+}
+
+void AMapDataImporter::CancelSpawnQueue()
+{
+	if (SpawnClassLoadHandle.IsValid())
+	{
+		SpawnClassLoadHandle->CancelHandle();
+		SpawnClassLoadHandle.Reset();
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(SpawnTimerHandle);
+	}
+
+	bSpawnQueueActive = false;
+	SpawnQueue.Empty();
+	SpawnQueueCursor = 0;
+}
+
+FVector AMapDataImporter::GetSpawnFocusLocation() const
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (APlayerController* PC = World->GetFirstPlayerController())
+		{
+			if (APawn* Pawn = PC->GetPawn())
 			{
-				SpawnedActors.Add(SpawnedActor);
+				return Pawn->GetActorLocation();
 			}
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Spawned %d actors"), SpawnedActors.Num());
+	if (const FMapConnectionData* DefaultSpawn = ParsedMapData.FindDefaultSpawn())
+	{
+		return GridToWorldContinuous(DefaultSpawn->X + 0.5f, DefaultSpawn->Y + 0.5f);
+	}
+
+	return GridToWorldContinuous(0.0f, 0.0f);
+}
+
+void AMapDataImporter::GatherSpawnClassIds(TArray<FString>& OutClassIds) const
+{
+	for (const FPendingSpawn& Pending : SpawnQueue)
+	{
+		switch (Pending.Kind)
+		{
+		case FPendingSpawn::EKind::Object:
+			OutClassIds.AddUnique(ParsedMapData.Objects[Pending.Index].ObjectClass);
+			break;
+
+		case FPendingSpawn::EKind::Spawner:
+		{
+			// Same candidates SpawnSpawner tries, in the same order
+			const FMapSpawnerData& Spawner = ParsedMapData.Spawners[Pending.Index];
+			if (!Spawner.ResourceType.IsEmpty())
+			{
+				OutClassIds.AddUnique(FString::Printf(TEXT("%s_%s"), *Spawner.Type, *Spawner.ResourceType));
+				OutClassIds.AddUnique(Spawner.ResourceType);
+			}
+			OutClassIds.AddUnique(Spawner.Type);
+			break;
+		}
+
+		case FPendingSpawn::EKind::Connection:
+			OutClassIds.AddUnique(TEXT("doorway"));
+			break;
+		}
+	}
+}
+
+AActor* AMapDataImporter::SpawnPending(const FPendingSpawn& Pending)
+{
+	// Indices can go stale if the map is reimported while a queue is running
+	AActor* SpawnedActor = nullptr;
+	switch (Pending.Kind)
+	{
+	case FPendingSpawn::EKind::Object:
+		SpawnedActor = ParsedMapData.Objects.IsValidIndex(Pending.Index) ? SpawnObject(ParsedMapData.Objects[Pending.Index]) : nullptr;
+		break;
+	case FPendingSpawn::EKind::Spawner:
+		SpawnedActor = ParsedMapData.Spawners.IsValidIndex(Pending.Index) ? SpawnSpawner(ParsedMapData.Spawners[Pending.Index]) : nullptr;
+		break;
+	case FPendingSpawn::EKind::Connection:
+		SpawnedActor = ParsedMapData.Connections.IsValidIndex(Pending.Index) ? SpawnConnection(ParsedMapData.Connections[Pending.Index]) : nullptr;
+		break;
+	}
+
+	if (SpawnedActor)
+	{
+		SpawnedActors.Add(SpawnedActor);
+
+		const FString Key = GetSpawnKey(Pending);
+		if (!Key.IsEmpty())
+		{
+			SpawnedActorsByKey.Add(Key, SpawnedActor);
+		}
+	}
+	return SpawnedActor;
+}
+
+FString AMapDataImporter::GetSpawnKey(FPendingSpawn::EKind Kind, const FString& Id)
+{
+	if (Id.IsEmpty())
+	{
+		return FString();
+	}
+
+	switch (Kind)
+	{
+	case FPendingSpawn::EKind::Object:
+		return TEXT("object:") + Id;
+	case FPendingSpawn::EKind::Spawner:
+		return TEXT("spawner:") + Id;
+	case FPendingSpawn::EKind::Connection:
+		return TEXT("connection:") + Id;
+	}
+	return FString();
+}
+
+FString AMapDataImporter::GetSpawnKey(const FPendingSpawn& Pending) const
+{
+	switch (Pending.Kind)
+	{
+	case FPendingSpawn::EKind::Object:
+		return ParsedMapData.Objects.IsValidIndex(Pending.Index) ? GetSpawnKey(Pending.Kind, ParsedMapData.Objects[Pending.Index].Id) : FString();
+	case FPendingSpawn::EKind::Spawner:
+		return ParsedMapData.Spawners.IsValidIndex(Pending.Index) ? GetSpawnKey(Pending.Kind, ParsedMapData.Spawners[Pending.Index].Id) : FString();
+	case FPendingSpawn::EKind::Connection:
+		return ParsedMapData.Connections.IsValidIndex(Pending.Index) ? GetSpawnKey(Pending.Kind, ParsedMapData.Connections[Pending.Index].Id) : FString();
+	}
+	return FString();
 }
 
 void AMapDataImporter::SpawnObjectsOfType(const FString& ObjectType)
@@ -585,24 +941,271 @@ void AMapDataImporter::SpawnObjectsOfType(const FString& ObjectType)
 
 void AMapDataImporter::ClearSpawnedObjects()
 {
-	for (AActor* Actor : SpawnedActors)
+	CancelSpawnQueue();
+
+	// Poolable actors are kept for the respawn that usually follows
 	{
-		if (IsValid(Actor))
+		TGuardValue<bool> ReleasingGuard(bReleasingSpawnedActors, true);
+		for (AActor* Actor : SpawnedActors)
 		{
-			Actor->Destroy();
+			UGridActorPool::ReleaseOrDestroy(Actor);
 		}
 	}
 	SpawnedActors.Empty();
+	SpawnedActorsByKey.Empty();
+}
+
+void AMapDataImporter::HandleActorReleased(AActor* Actor)
+{
+	if (bReleasingSpawnedActors || SpawnedActors.RemoveSingleSwap(Actor) == 0)
+	{
+		return;
+	}
+
+	// The pool may hand this actor to another owner, so it must not be matched to its key on reimport
+	for (auto It = SpawnedActorsByKey.CreateIterator(); It; ++It)
+	{
+		if (It.Value() == Actor)
+		{
+			It.RemoveCurrent();
+			break;
+		}
+	}
 }
 
 void AMapDataImporter::ReimportAndRespawn()
 {
-	ClearSpawnedObjects();
+	UFarmGridManager* GridManager = GetGridManager();
 
-	if (ImportFromJson())
+	// The grid's world transform is only set by a full import
+	bool bGridTransformChanged = true;
+	if (GridManager)
 	{
+		FVector GridOffset;
+		float GridScale = 1.0f;
+		float GridRotation = 0.0f;
+		GridManager->GetGridTransform(GridOffset, GridScale, GridRotation);
+		bGridTransformChanged = !GridOffset.Equals(GetActorLocation())
+			|| !FMath::IsNearlyEqual(GridScale, FMath::Max(0.1f, GetActorScale3D().X))
+			|| !FMath::IsNearlyEqual(GridRotation, GetActorRotation().Yaw);
+	}
+
+	// Diffing needs a previous import that finished spawning
+	if (!bHasValidData || bSpawnQueueActive || bGridTransformChanged)
+	{
+		ClearSpawnedObjects();
+		if (ImportFromJson())
+		{
+			SpawnAllObjects();
+		}
+		return;
+	}
+
+	const FMapData OldData = ParsedMapData;
+	if (!LoadMapData(JsonFilePath))
+	{
+		// Keep the running map rather than tearing it down over a broken edit
+		UE_LOG(LogTemp, Warning, TEXT("MapDataImporter: Reimport failed, keeping the previous map data"));
+		ParsedMapData = OldData;
+		bHasValidData = true;
+		return;
+	}
+
+	TArray<FIntPoint> ChangedTiles;
+	if (!GridManager->ApplyMapDataChanges(OldData, ParsedMapData, ChangedTiles))
+	{
+		// Grid layout changed, so no cell or actor placement carries over
+		ClearSpawnedObjects();
+		ApplyParsedMapData();
 		SpawnAllObjects();
+		if (BlockedCollisionBoxes.Num() > 0)
+		{
+			RebuildBlockedCollision();
+		}
+		return;
+	}
+
+	RespawnChangedObjects(OldData);
+
+	if (BlockedCollisionBoxes.Num() > 0)
+	{
+		RebuildBlockedCollisionForTiles(ChangedTiles);
 	}
+
+	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Reimported map '%s' in place (%d tiles changed)"),
+		*ParsedMapData.DisplayName, ChangedTiles.Num());
+}
+
+namespace MapDataImporterPrivate
+{
+	/** Element index by Id. Ids used more than once map to INDEX_NONE, since they can't be matched reliably. */
+	template <typename ElementType>
+	static TMap<FString, int32> IndexElementsById(const TArray<ElementType>& Elements)
+	{
+		TMap<FString, int32> Indices;
+		for (int32 Index = 0; Index < Elements.Num(); ++Index)
+		{
+			const FString& Id = Elements[Index].Id;
+			if (Id.IsEmpty())
+			{
+				continue;
+			}
+
+			if (int32* Existing = Indices.Find(Id))
+			{
+				*Existing = INDEX_NONE;
+			}
+			else
+			{
+				Indices.Add(Id, Index);
+			}
+		}
+		return Indices;
+	}
+
+	/** True if New matches Old apart from where it sits, so its actor can just be moved */
+	static bool DiffersOnlyInPlacement(const FMapObjectData& Old, const FMapObjectData& New)
+	{
+		FMapObjectData Unmoved = New;
+		Unmoved.X = Old.X;
+		Unmoved.Y = Old.Y;
+		Unmoved.Rotation = Old.Rotation;
+		return AreMapStructsEqual(Old, Unmoved);
+	}
+
+	static bool DiffersOnlyInPlacement(const FMapSpawnerData& Old, const FMapSpawnerData& New)
+	{
+		FMapSpawnerData Unmoved = New;
+		Unmoved.X = Old.X;
+		Unmoved.Y = Old.Y;
+		return AreMapStructsEqual(Old, Unmoved);
+	}
+
+	static bool DiffersOnlyInPlacement(const FMapConnectionData& Old, const FMapConnectionData& New)
+	{
+		FMapConnectionData Unmoved = New;
+		Unmoved.X = Old.X;
+		Unmoved.Y = Old.Y;
+		Unmoved.Facing = Old.Facing;
+		return AreMapStructsEqual(Old, Unmoved);
+	}
+}
+
+void AMapDataImporter::RespawnChangedObjects(const FMapData& OldData)
+{
+	using namespace MapDataImporterPrivate;
+	using EKind = FPendingSpawn::EKind;
+
+	// Match each new element to the actor spawned for the same Id; unchanged or merely moved ones keep it
+	TMap<FString, AActor*> KeptActorsByKey;
+	TArray<TPair<AActor*, FPendingSpawn>> MovedActors;
+	auto MatchLayer = [this, &KeptActorsByKey, &MovedActors](EKind Kind, const auto& OldElements, const auto& NewElements)
+	{
+		const TMap<FString, int32> OldIndices = IndexElementsById(OldElements);
+		for (const TPair<FString, int32>& Entry : IndexElementsById(NewElements))
+		{
+			const int32* OldIndex = OldIndices.Find(Entry.Key);
+			if (Entry.Value == INDEX_NONE || !OldIndex || *OldIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			const FString Key = GetSpawnKey(Kind, Entry.Key);
+			AActor* Actor = SpawnedActorsByKey.FindRef(Key);
+			if (!IsValid(Actor) || UGridActorPool::IsActorPooled(Actor))
+			{
+				continue;
+			}
+
+			const auto& OldElement = OldElements[*OldIndex];
+			const auto& NewElement = NewElements[Entry.Value];
+			if (AreMapStructsEqual(OldElement, NewElement))
+			{
+				KeptActorsByKey.Add(Key, Actor);
+			}
+			else if (DiffersOnlyInPlacement(OldElement, NewElement))
+			{
+				KeptActorsByKey.Add(Key, Actor);
+
+				FPendingSpawn Moved;
+				Moved.Kind = Kind;
+				Moved.Index = Entry.Value;
+				MovedActors.Emplace(Actor, Moved);
+			}
+		}
+	};
+
+	MatchLayer(EKind::Object, OldData.Objects, ParsedMapData.Objects);
+	MatchLayer(EKind::Spawner, OldData.Spawners, ParsedMapData.Spawners);
+	MatchLayer(EKind::Connection, OldData.Connections, ParsedMapData.Connections);
+
+	TSet<AActor*> KeptActors;
+	for (const TPair<FString, AActor*>& Entry : KeptActorsByKey)
+	{
+		KeptActors.Add(Entry.Value);
+	}
+
+	// Free the cells of everything leaving or moving before anything re-registers, so actors can swap places
+	int32 NumDestroyed = 0;
+	{
+		TGuardValue<bool> ReleasingGuard(bReleasingSpawnedActors, true);
+		for (AActor* Actor : SpawnedActors)
+		{
+			if (IsValid(Actor) && !KeptActors.Contains(Actor))
+			{
+				UnregisterSpawnedActorFromGrid(Actor);
+				UGridActorPool::ReleaseOrDestroy(Actor);
+				++NumDestroyed;
+			}
+		}
+	}
+	for (const TPair<AActor*, FPendingSpawn>& Moved : MovedActors)
+	{
+		UnregisterSpawnedActorFromGrid(Moved.Key);
+	}
+
+	for (const TPair<AActor*, FPendingSpawn>& Moved : MovedActors)
+	{
+		AActor* Actor = Moved.Key;
+		FTransform Transform;
+		switch (Moved.Value.Kind)
+		{
+		case EKind::Object:
+		{
+			const FMapObjectData& ObjectData = ParsedMapData.Objects[Moved.Value.Index];
+			Transform = GetSpawnTransform(ObjectData);
+			RegisterSpawnedActorWithGrid(Actor, ObjectData.GetGridCoordinate(), ObjectData.Width, ObjectData.Height);
+			break;
+		}
+		case EKind::Spawner:
+		{
+			const FMapSpawnerData& SpawnerData = ParsedMapData.Spawners[Moved.Value.Index];
+			Transform = GetSpawnTransform(SpawnerData);
+			RegisterSpawnedActorWithGrid(Actor, SpawnerData.GetGridCoordinate(), 1, 1);
+			break;
+		}
+		case EKind::Connection:
+			// Doorways don't occupy grid cells
+			Transform = GetSpawnTransform(ParsedMapData.Connections[Moved.Value.Index]);
+			break;
+		}
+		Actor->SetActorLocationAndRotation(Transform.GetLocation(), Transform.GetRotation(), false, nullptr, ETeleportType::TeleportPhysics);
+	}
+
+	SpawnedActorsByKey = MoveTemp(KeptActorsByKey);
+	SpawnedActors = KeptActors.Array();
+
+	// Queue only elements that didn't keep an actor
+	BuildSpawnQueue();
+	SpawnQueue.RemoveAll([this](const FPendingSpawn& Pending)
+	{
+		return SpawnedActorsByKey.Contains(GetSpawnKey(Pending));
+	});
+
+	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Reimport kept %d actors (%d moved), destroyed %d, spawning %d"),
+		SpawnedActors.Num(), MovedActors.Num(), NumDestroyed, SpawnQueue.Num());
+
+	RunSpawnQueue();
 }
 
 FMapValidationResult AMapDataImporter::ValidateMapData() const
@@ -673,36 +1276,13 @@ AActor* AMapDataImporter::SpawnObject(const FMapObjectData& ObjectData)
 		return nullptr;
 	}
 
-	FVector SpawnLocation = GridToWorldPosition2D(ObjectData.X, ObjectData.Y);
-
-	// Apply height offset from properties
-	FString HeightOffsetStr = ObjectData.GetProperty(TEXT("heightOffset"), TEXT("0"));
-	SpawnLocation.Z += FCString::Atof(*HeightOffsetStr);
-
-	FRotator SpawnRotation(0.0f, ObjectData.Rotation, 0.0f);
-
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-	AActor* SpawnedActor = GetWorld()->SpawnActor<AActor>(ActorClass, SpawnLocation, SpawnRotation, SpawnParams);
+	AActor* SpawnedActor = UGridActorPool::AcquireOrSpawn(GetWorld(), ActorClass, GetSpawnTransform(ObjectData), [](AActor&) {},
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
 
 	if (SpawnedActor)
 	{
-		// Register with grid manager
-		if (UFarmGridManager* GridManager = GetGridManager())
-		{
-			// Check if the actor has a GridFootprintComponent - if so, use it for registration
-			if (UGridFootprintComponent* Footprint = SpawnedActor->FindComponentByClass<UGridFootprintComponent>())
-			{
-				// Use the footprint component's dimensions and register through it
-				Footprint->RegisterWithGrid(GridManager, ObjectData.GetGridCoordinate());
-			}
-			else
-			{
-				// Fallback to JSON-specified dimensions
-				GridManager->PlaceObject(SpawnedActor, ObjectData.GetGridCoordinate(), ObjectData.Width, ObjectData.Height);
-			}
-		}
+		// JSON dimensions are only used when the actor has no footprint component
+		RegisterSpawnedActorWithGrid(SpawnedActor, ObjectData.GetGridCoordinate(), ObjectData.Width, ObjectData.Height);
 	}
 
 	return SpawnedActor;
@@ -743,30 +1323,13 @@ AActor* AMapDataImporter::SpawnSpawner(const FMapSpawnerData& SpawnerData)
 		return nullptr;
 	}
 
-	FVector SpawnLocation = GridToWorldPosition2D(SpawnerData.X, SpawnerData.Y);
-	FRotator SpawnRotation = FRotator::ZeroRotator;
-
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-
-	AActor* SpawnedActor = GetWorld()->SpawnActor<AActor>(ActorClass, SpawnLocation, SpawnRotation, SpawnParams);
+	AActor* SpawnedActor = UGridActorPool::AcquireOrSpawn(GetWorld(), ActorClass, GetSpawnTransform(SpawnerData), [](AActor&) {},
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
 
 	if (SpawnedActor)
 	{
-		if (UFarmGridManager* GridManager = GetGridManager())
-		{
-			// Check if the actor has a GridFootprintComponent - if so, use it for registration
-			if (UGridFootprintComponent* Footprint = SpawnedActor->FindComponentByClass<UGridFootprintComponent>())
-			{
-				// Use the footprint component's dimensions and register through it
-				Footprint->RegisterWithGrid(GridManager, SpawnerData.GetGridCoordinate());
-			}
-			else
-			{
-				// Fallback to 1x1 for spawners without footprint
-				GridManager->PlaceObject(SpawnedActor, SpawnerData.GetGridCoordinate());
-			}
-		}
+		// Spawners without a footprint take a single tile
+		RegisterSpawnedActorWithGrid(SpawnedActor, SpawnerData.GetGridCoordinate(), 1, 1);
 	}
 
 	return SpawnedActor;
@@ -786,13 +1349,67 @@ AActor* AMapDataImporter::SpawnConnection(const FMapConnectionData& ConnectionDa
 		return nullptr;
 	}
 
-	FVector SpawnLocation = GridToWorldPosition2D(ConnectionData.X, ConnectionData.Y);
-	FRotator SpawnRotation = UGridFunctionLibrary::DirectionToRotation(ConnectionData.GetFacingDirection());
+	return UGridActorPool::AcquireOrSpawn(GetWorld(), ActorClass, GetSpawnTransform(ConnectionData), [](AActor&) {},
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+}
+
+FTransform AMapDataImporter::GetSpawnTransform(const FMapObjectData& ObjectData) const
+{
+	FVector SpawnLocation = GridToWorldPosition2D(ObjectData.X, ObjectData.Y);
+
+	// Apply height offset from properties
+	FString HeightOffsetStr = ObjectData.GetProperty(TEXT("heightOffset"), TEXT("0"));
+	SpawnLocation.Z += FCString::Atof(*HeightOffsetStr);
+
+	return FTransform(FRotator(0.0f, ObjectData.Rotation, 0.0f), SpawnLocation);
+}
+
+FTransform AMapDataImporter::GetSpawnTransform(const FMapSpawnerData& SpawnerData) const
+{
+	return FTransform(FRotator::ZeroRotator, GridToWorldPosition2D(SpawnerData.X, SpawnerData.Y));
+}
+
+FTransform AMapDataImporter::GetSpawnTransform(const FMapConnectionData& ConnectionData) const
+{
+	return FTransform(UGridFunctionLibrary::DirectionToRotation(ConnectionData.GetFacingDirection()),
+		GridToWorldPosition2D(ConnectionData.X, ConnectionData.Y));
+}
+
+void AMapDataImporter::RegisterSpawnedActorWithGrid(AActor* Actor, const FGridCoordinate& Anchor, int32 Width, int32 Height) const
+{
+	UFarmGridManager* GridManager = GetGridManager();
+	if (!GridManager || !Actor)
+	{
+		return;
+	}
+
+	// Check if the actor has a GridFootprintComponent - if so, use it for registration
+	if (UGridFootprintComponent* Footprint = Actor->FindComponentByClass<UGridFootprintComponent>())
+	{
+		Footprint->RegisterWithGrid(GridManager, Anchor);
+	}
+	else
+	{
+		GridManager->PlaceObject(Actor, Anchor, Width, Height);
+	}
+}
 
-	FActorSpawnParameters SpawnParams;
-	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+void AMapDataImporter::UnregisterSpawnedActorFromGrid(AActor* Actor) const
+{
+	UFarmGridManager* GridManager = GetGridManager();
+	if (!GridManager || !Actor)
+	{
+		return;
+	}
 
-	return GetWorld()->SpawnActor<AActor>(ActorClass, SpawnLocation, SpawnRotation, SpawnParams);
+	if (UGridFootprintComponent* Footprint = Actor->FindComponentByClass<UGridFootprintComponent>())
+	{
+		Footprint->UnregisterFromGrid(GridManager);
+	}
+	else
+	{
+		GridManager->RemoveObjectByActor(Actor);
+	}
 }
 
 UFarmGridManager* AMapDataImporter::GetGridManager() const
@@ -979,6 +1596,66 @@ TMap<FString, FString> AMapDataImporter::ParsePropertiesObject(const TSharedPtr<
 	return Result;
 }
 
+void AMapDataImporter::BenchmarkJsonImport()
+{
+	const int32 Iterations = 10;
+
+	FString JsonString;
+	if (JsonFilePath.IsEmpty() || !FFileHelper::LoadFileToString(JsonString, *ResolveJsonPath(JsonFilePath)))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MapDataImporter: BenchmarkJsonImport needs a readable JsonFilePath"));
+		return;
+	}
+
+	// Process-wide memory deltas; the DOM is sampled at its largest, after layers are copied out
+	auto UsedBytes = []() { return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical); };
+
+	// Parsed into a scratch copy so the live data and the next reimport's diff are left alone
+	FMapData BenchmarkData;
+
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		const bool bStreaming = Pass == 1;
+		double TotalSeconds = 0.0;
+		int64 PeakDelta = 0;
+
+		for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+		{
+			BenchmarkData = FMapData();
+			const int64 Baseline = UsedBytes();
+			const double StartTime = FPlatformTime::Seconds();
+
+			if (bStreaming)
+			{
+				FString Error;
+				FMapDataStreamReader::ReadFromString(JsonString, BenchmarkData, Error);
+				TotalSeconds += FPlatformTime::Seconds() - StartTime;
+				PeakDelta = FMath::Max(PeakDelta, UsedBytes() - Baseline);
+			}
+			else
+			{
+				TSharedPtr<FJsonObject> JsonObject;
+				TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+				if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
+				{
+					ParseJsonObject(JsonObject, BenchmarkData);
+				}
+				TotalSeconds += FPlatformTime::Seconds() - StartTime;
+				PeakDelta = FMath::Max(PeakDelta, UsedBytes() - Baseline);
+			}
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("MapDataImporter: %s import of %s (%d KB, %d terrain tiles, %d with properties) - %.2f ms avg, peak ~%.1f KB"),
+			bStreaming ? TEXT("Streaming") : TEXT("DOM"), *JsonFilePath, JsonString.Len() / 1024,
+			BenchmarkData.Terrain.Num(), BenchmarkData.TerrainProperties.Num(),
+			TotalSeconds * 1000.0 / Iterations, PeakDelta / 1024.0);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Terrain storage %.1f KB (%d bytes per tile)"),
+		(BenchmarkData.Terrain.GetAllocatedSize() + BenchmarkData.TerrainProperties.GetAllocatedSize()) / 1024.0,
+		static_cast<int32>(sizeof(FMapTerrainTile)));
+}
+
 // ---- Debug Visualization Implementation ----
 
 void AMapDataImporter::DrawAllGridData()
@@ -1166,7 +1843,7 @@ void AMapDataImporter::DrawDebugTerrain(float Duration) const
 		DrawDebugPoint(World, CellCenter, 8.0f, TileColor, false, Duration);
 
 		// Label blocked tiles
-		if (Tile.Type == TEXT("blocked") || Tile.Type == TEXT("water"))
+		if (Tile.Type == ETerrainType::Blocked || Tile.Type == ETerrainType::Water)
 		{
 			// Draw X for impassable
 			DrawDebugLine(World, Corner1, Corner3, TileColor, false, Duration, 0, DebugLineThickness);
@@ -1510,16 +2187,19 @@ void AMapDataImporter::DrawDebugConnections(float Duration) const
 	}
 }
 
-FColor AMapDataImporter::GetTerrainColor(const FString& TerrainType)
+FColor AMapDataImporter::GetTerrainColor(ETerrainType TerrainType)
 {
-	if (TerrainType == TEXT("blocked")) return FColor::Red;
-	if (TerrainType == TEXT("water")) return FColor::Blue;
-	if (TerrainType == TEXT("tillable")) return FColor(139, 90, 43); // Brown
-	if (TerrainType == TEXT("path")) return FColor(200, 180, 150); // Tan
-	if (TerrainType == TEXT("sand")) return FColor(238, 214, 175); // Sandy
-	if (TerrainType == TEXT("stone")) return FColor(128, 128, 128); // Gray
-	if (TerrainType == TEXT("wood_floor")) return FColor(139, 90, 43); // Wood brown
-	return FColor(100, 180, 100); // Default green
+	switch (TerrainType)
+	{
+	case ETerrainType::Blocked:		return FColor::Red;
+	case ETerrainType::Water:		return FColor::Blue;
+	case ETerrainType::Tillable:	return FColor(139, 90, 43); // Brown
+	case ETerrainType::Path:		return FColor(200, 180, 150); // Tan
+	case ETerrainType::Sand:		return FColor(238, 214, 175); // Sandy
+	case ETerrainType::Stone:		return FColor(128, 128, 128); // Gray
+	case ETerrainType::WoodFloor:	return FColor(139, 90, 43); // Wood brown
+	default:						return FColor(100, 180, 100); // Default green
+	}
 }
 
 FColor AMapDataImporter::GetZoneColor(const FString& ZoneType)
@@ -1573,10 +2253,12 @@ void AMapDataImporter::RebuildPersistentGridLines()
 		return;
 	}
 
-	GridLineBatch->Flush();
+	// Any batch still in flight is for an older layout
+	const int32 RequestId = ++GridLineRequestId;
 
 	if (!bDrawDebugGrid)
 	{
+		GridLineBatch->Flush();
 		GridLineBatch->SetVisibility(false);
 		return;
 	}
@@ -1587,7 +2269,6 @@ void AMapDataImporter::RebuildPersistentGridLines()
 	float GridScale = GetActorScale3D().X;
 	float Yaw = GetActorRotation().Yaw;
 	float CellSize = ParsedMapData.Grid.CellSize * GridScale;
-	float LineLifetime = -1.0f;
 
 	// Determine draw range
 	int32 StartX = 0;
@@ -1605,10 +2286,8 @@ void AMapDataImporter::RebuildPersistentGridLines()
 		EndY = FMath::Min(ParsedMapData.Grid.Height, CenterY + DebugGridDrawRadius);
 	}
 
-	FLinearColor GridColor(0.3f, 0.3f, 0.3f, 0.5f);
-
-	// Helper to get position with optional terrain raycast
-	auto GetGridPoint = [&](int32 X, int32 Y) -> FVector
+	// Helper to get the world XY of a tile centre
+	auto GetGridPoint = [&](int32 X, int32 Y) -> FVector2D
 	{
 		FVector2D LocalPos((X + 0.5f) * CellSize + ParsedMapData.Grid.OriginOffset.X * GridScale,
 						   (Y + 0.5f) * CellSize + ParsedMapData.Grid.OriginOffset.Y * GridScale);
@@ -1623,51 +2302,32 @@ void AMapDataImporter::RebuildPersistentGridLines()
 			LocalPos = FVector2D(RotatedX, RotatedY);
 		}
 
-		FVector WorldPos(LocalPos.X + ActorLocation.X, LocalPos.Y + ActorLocation.Y, ActorLocation.Z);
-
-		if (bRaycastGridToTerrain)
-		{
-			WorldPos.Z = SampleHeightAtWorld(WorldPos.X, WorldPos.Y) + DebugDrawHeightOffset;
-		}
-		else
-		{
-			WorldPos.Z = ActorLocation.Z + DebugDrawHeightOffset;
-		}
-
-		return WorldPos;
+		return FVector2D(LocalPos.X + ActorLocation.X, LocalPos.Y + ActorLocation.Y);
 	};
 
-	// Draw grid lines if enabled
+	// Collect every point that needs a height, each exactly once:
+	// the grid point lattice for the lines, then four corners per terrain tile
+	TSharedRef<FGridLineGeometry> Geometry = MakeShared<FGridLineGeometry>();
+	Geometry->BaseZ = ActorLocation.Z;
+	Geometry->HalfCell = CellSize * 0.5f;
+
 	if (bDrawGridLines)
 	{
-		float HalfCell = CellSize * 0.5f;
-
-		// Draw vertical lines
-		for (int32 X = StartX; X <= EndX; ++X)
-		{
-			for (int32 Y = StartY; Y < EndY; ++Y)
-			{
-				FVector Start = GetGridPoint(X, Y) - FVector(HalfCell, HalfCell, 0);
-				FVector End = GetGridPoint(X, Y + 1) - FVector(HalfCell, HalfCell, 0);
-				GridLineBatch->DrawLine(Start, End, GridColor, 0, DebugLineThickness * 0.5f, LineLifetime);
-			}
-		}
-
-		// Draw horizontal lines
+		Geometry->LatticeWidth = EndX - StartX + 1;
+		Geometry->LatticeHeight = EndY - StartY + 1;
+		Geometry->Points.Reserve(Geometry->LatticeWidth * Geometry->LatticeHeight);
 		for (int32 Y = StartY; Y <= EndY; ++Y)
 		{
-			for (int32 X = StartX; X < EndX; ++X)
+			for (int32 X = StartX; X <= EndX; ++X)
 			{
-				FVector Start = GetGridPoint(X, Y) - FVector(HalfCell, HalfCell, 0);
-				FVector End = GetGridPoint(X + 1, Y) - FVector(HalfCell, HalfCell, 0);
-				GridLineBatch->DrawLine(Start, End, GridColor, 0, DebugLineThickness * 0.5f, LineLifetime);
+				Geometry->Points.Add(GetGridPoint(X, Y));
 			}
 		}
 	}
 
-	// Draw terrain tiles
 	if (bDrawTerrain)
 	{
+		const float HalfSize = CellSize * 0.45f;
 		for (const FMapTerrainTile& Tile : ParsedMapData.Terrain)
 		{
 			if (Tile.X < StartX || Tile.X >= EndX || Tile.Y < StartY || Tile.Y >= EndY)
@@ -1675,35 +2335,121 @@ void AMapDataImporter::RebuildPersistentGridLines()
 				continue;
 			}
 
-			FVector CellCenter = GetGridPoint(Tile.X, Tile.Y);
-			float HalfSize = CellSize * 0.45f;
+			const FVector2D CellCenter = GetGridPoint(Tile.X, Tile.Y);
+			Geometry->Points.Add(CellCenter + FVector2D(-HalfSize, -HalfSize));
+			Geometry->Points.Add(CellCenter + FVector2D(HalfSize, -HalfSize));
+			Geometry->Points.Add(CellCenter + FVector2D(HalfSize, HalfSize));
+			Geometry->Points.Add(CellCenter + FVector2D(-HalfSize, HalfSize));
+			Geometry->TileColors.Add(FLinearColor(GetTerrainColor(Tile.Type)));
+		}
+	}
 
-			FVector Corner1 = CellCenter + FVector(-HalfSize, -HalfSize, 0);
-			FVector Corner2 = CellCenter + FVector(HalfSize, -HalfSize, 0);
-			FVector Corner3 = CellCenter + FVector(HalfSize, HalfSize, 0);
-			FVector Corner4 = CellCenter + FVector(-HalfSize, HalfSize, 0);
+	if (!bRaycastGridToTerrain)
+	{
+		DrawPersistentGridLines(*Geometry, nullptr);
+		return;
+	}
 
-			// Raycast each corner for proper terrain following
-			if (bRaycastGridToTerrain)
+	// One batch for the whole grid; lines are rebuilt when the heights come back
+	TWeakObjectPtr<AMapDataImporter> WeakThis(this);
+	FTerrainHeightBatch::SampleAsync(GetWorld(), Geometry->Points, GetHeightTraceSettings(),
+		[WeakThis, RequestId, Geometry](TArray<float>&& Heights)
+		{
+			AMapDataImporter* This = WeakThis.Get();
+			if (This && This->GridLineRequestId == RequestId)
 			{
-				Corner1.Z = SampleHeightAtWorld(Corner1.X, Corner1.Y) + DebugDrawHeightOffset;
-				Corner2.Z = SampleHeightAtWorld(Corner2.X, Corner2.Y) + DebugDrawHeightOffset;
-				Corner3.Z = SampleHeightAtWorld(Corner3.X, Corner3.Y) + DebugDrawHeightOffset;
-				Corner4.Z = SampleHeightAtWorld(Corner4.X, Corner4.Y) + DebugDrawHeightOffset;
+				This->DrawPersistentGridLines(*Geometry, &Heights);
 			}
+		});
+}
+
+void AMapDataImporter::DrawPersistentGridLines(const FGridLineGeometry& Geometry, const TArray<float>* Heights)
+{
+	if (!GridLineBatch)
+	{
+		return;
+	}
+
+	GridLineBatch->Flush();
+
+	const float LineLifetime = -1.0f;
+	const FLinearColor GridColor(0.3f, 0.3f, 0.3f, 0.5f);
+
+	auto GetPoint = [&](int32 Index) -> FVector
+	{
+		const float Z = (Heights ? (*Heights)[Index] : Geometry.BaseZ) + DebugDrawHeightOffset;
+		return FVector(Geometry.Points[Index].X, Geometry.Points[Index].Y, Z);
+	};
+
+	// Grid lines run through cell corners, offset from the sampled centres
+	if (Geometry.LatticeWidth > 0)
+	{
+		const FVector CornerOffset(Geometry.HalfCell, Geometry.HalfCell, 0);
+		auto GetLatticePoint = [&](int32 LX, int32 LY) -> FVector
+		{
+			return GetPoint(LY * Geometry.LatticeWidth + LX) - CornerOffset;
+		};
 
-			FLinearColor TileColor(GetTerrainColor(Tile.Type));
+		// Draw vertical lines
+		for (int32 LX = 0; LX < Geometry.LatticeWidth; ++LX)
+		{
+			for (int32 LY = 0; LY + 1 < Geometry.LatticeHeight; ++LY)
+			{
+				GridLineBatch->DrawLine(GetLatticePoint(LX, LY), GetLatticePoint(LX, LY + 1), GridColor, 0, DebugLineThickness * 0.5f, LineLifetime);
+			}
+		}
 
-			GridLineBatch->DrawLine(Corner1, Corner2, TileColor, 0, DebugLineThickness, LineLifetime);
-			GridLineBatch->DrawLine(Corner2, Corner3, TileColor, 0, DebugLineThickness, LineLifetime);
-			GridLineBatch->DrawLine(Corner3, Corner4, TileColor, 0, DebugLineThickness, LineLifetime);
-			GridLineBatch->DrawLine(Corner4, Corner1, TileColor, 0, DebugLineThickness, LineLifetime);
+		// Draw horizontal lines
+		for (int32 LY = 0; LY < Geometry.LatticeHeight; ++LY)
+		{
+			for (int32 LX = 0; LX + 1 < Geometry.LatticeWidth; ++LX)
+			{
+				GridLineBatch->DrawLine(GetLatticePoint(LX, LY), GetLatticePoint(LX + 1, LY), GridColor, 0, DebugLineThickness * 0.5f, LineLifetime);
+			}
 		}
 	}
 
+	// Draw terrain tiles
+	const int32 FirstCorner = Geometry.LatticeWidth * Geometry.LatticeHeight;
+	for (int32 TileIndex = 0; TileIndex < Geometry.TileColors.Num(); ++TileIndex)
+	{
+		const int32 Base = FirstCorner + TileIndex * 4;
+		const FVector Corner1 = GetPoint(Base);
+		const FVector Corner2 = GetPoint(Base + 1);
+		const FVector Corner3 = GetPoint(Base + 2);
+		const FVector Corner4 = GetPoint(Base + 3);
+		const FLinearColor& TileColor = Geometry.TileColors[TileIndex];
+
+		GridLineBatch->DrawLine(Corner1, Corner2, TileColor, 0, DebugLineThickness, LineLifetime);
+		GridLineBatch->DrawLine(Corner2, Corner3, TileColor, 0, DebugLineThickness, LineLifetime);
+		GridLineBatch->DrawLine(Corner3, Corner4, TileColor, 0, DebugLineThickness, LineLifetime);
+		GridLineBatch->DrawLine(Corner4, Corner1, TileColor, 0, DebugLineThickness, LineLifetime);
+	}
+
 	GridLineBatch->MarkRenderStateDirty();
 }
 
+FTerrainHeightTraceSettings AMapDataImporter::GetHeightTraceSettings() const
+{
+	FTerrainHeightTraceSettings Settings;
+	if (const UFarmGridManager* GridManager = GetGridManager())
+	{
+		Settings.TraceStart = GridManager->HeightTraceStart;
+		Settings.TraceDepth = GridManager->HeightTraceDepth;
+		Settings.DefaultHeight = GridManager->DefaultHeight;
+		Settings.Channel = ECC_WorldStatic;
+	}
+	else
+	{
+		// Same as SampleHeightAtWorld's own fallback trace
+		Settings.TraceStart = 10000.0f;
+		Settings.TraceDepth = 20000.0f;
+		Settings.DefaultHeight = 0.0f;
+		Settings.Channel = ECC_Visibility;
+	}
+	return Settings;
+}
+
 // ---- Collision Generation ----
 
 void AMapDataImporter::GenerateBlockedCollision()
@@ -1714,62 +2460,146 @@ void AMapDataImporter::GenerateBlockedCollision()
 		return;
 	}
 
-	FVector ActorLocation = GetActorLocation();
-	float GridScale = GetActorScale3D().X;
-	float Yaw = GetActorRotation().Yaw;
-	float CellSize = ParsedMapData.Grid.CellSize * GridScale;
+	const int32 ChunksX = FMath::DivideAndRoundUp(ParsedMapData.Grid.Width, FBlockedCollisionBuilder::ChunkSize);
+	const int32 ChunksY = FMath::DivideAndRoundUp(ParsedMapData.Grid.Height, FBlockedCollisionBuilder::ChunkSize);
 
-	// Helper to transform grid position to world
-	auto GridToWorld = [&](int32 X, int32 Y) -> FVector
+	TArray<FIntPoint> Chunks;
+	Chunks.Reserve(ChunksX * ChunksY);
+	for (int32 ChunkY = 0; ChunkY < ChunksY; ++ChunkY)
 	{
-		FVector2D LocalPos((X + 0.5f) * CellSize + ParsedMapData.Grid.OriginOffset.X * GridScale,
-						   (Y + 0.5f) * CellSize + ParsedMapData.Grid.OriginOffset.Y * GridScale);
+		for (int32 ChunkX = 0; ChunkX < ChunksX; ++ChunkX)
+		{
+			Chunks.Add(FIntPoint(ChunkX, ChunkY));
+		}
+	}
 
-		if (!FMath::IsNearlyZero(Yaw))
+	// A full generation supersedes any batch still in flight
+	GenerateBlockedCollisionForChunks(Chunks, ++CollisionRequestId);
+}
+
+void AMapDataImporter::RebuildBlockedCollisionForTiles(const TArray<FIntPoint>& Tiles)
+{
+	if (!bHasValidData || !bGenerateBlockedCollision)
+	{
+		return;
+	}
+
+	TArray<FIntPoint> Chunks;
+	for (const FIntPoint& Tile : Tiles)
+	{
+		if (Tile.X >= 0 && Tile.Y >= 0 && Tile.X < ParsedMapData.Grid.Width && Tile.Y < ParsedMapData.Grid.Height)
 		{
-			float RadAngle = FMath::DegreesToRadians(Yaw);
-			float CosAngle = FMath::Cos(RadAngle);
-			float SinAngle = FMath::Sin(RadAngle);
-			float RotatedX = LocalPos.X * CosAngle - LocalPos.Y * SinAngle;
-			float RotatedY = LocalPos.X * SinAngle + LocalPos.Y * CosAngle;
-			LocalPos = FVector2D(RotatedX, RotatedY);
+			Chunks.AddUnique(FBlockedCollisionBuilder::GetChunkForTile(Tile.X, Tile.Y));
 		}
+	}
 
-		return FVector(LocalPos.X + ActorLocation.X, LocalPos.Y + ActorLocation.Y, ActorLocation.Z);
-	};
+	if (Chunks.Num() > 0)
+	{
+		GenerateBlockedCollisionForChunks(Chunks, CollisionRequestId);
+	}
+}
+
+void AMapDataImporter::GenerateBlockedCollisionForChunks(const TArray<FIntPoint>& Chunks, int32 RequestId)
+{
+	const int32 GridWidth = ParsedMapData.Grid.Width;
+	const int32 GridHeight = ParsedMapData.Grid.Height;
 
-	int32 BlockedCount = 0;
+	TBitArray<> Blocked;
+	BuildBlockedTileMask(Blocked);
 
-	// Create collision boxes for blocked tiles
-	for (const FMapTerrainTile& Tile : ParsedMapData.Terrain)
+	// Gather blocked tile centres in the requested chunks and sample all their heights in one batch
+	TArray<int32> SampleSlots;
+	TArray<FVector2D> Points;
+	for (int32 ChunkSlot = 0; ChunkSlot < Chunks.Num(); ++ChunkSlot)
 	{
-		if (Tile.Type != TEXT("blocked"))
+		const FIntPoint& Chunk = Chunks[ChunkSlot];
+		const int32 MinX = Chunk.X * FBlockedCollisionBuilder::ChunkSize;
+		const int32 MinY = Chunk.Y * FBlockedCollisionBuilder::ChunkSize;
+		const int32 MaxX = FMath::Min(MinX + FBlockedCollisionBuilder::ChunkSize, GridWidth);
+		const int32 MaxY = FMath::Min(MinY + FBlockedCollisionBuilder::ChunkSize, GridHeight);
+
+		for (int32 Y = MinY; Y < MaxY; ++Y)
 		{
-			continue;
+			for (int32 X = MinX; X < MaxX; ++X)
+			{
+				if (Blocked[Y * GridWidth + X])
+				{
+					const FVector WorldPos = GridToWorldContinuous(X + 0.5f, Y + 0.5f);
+					SampleSlots.Add(ChunkSlot * FBlockedCollisionBuilder::TilesPerChunk + (Y - MinY) * FBlockedCollisionBuilder::ChunkSize + (X - MinX));
+					Points.Add(FVector2D(WorldPos.X, WorldPos.Y));
+				}
+			}
 		}
+	}
+
+	// This chunk's old boxes stay registered until the new ones replace them, and must not raise the walls
+	FTerrainHeightTraceSettings TraceSettings = GetHeightTraceSettings();
+	TraceSettings.IgnoredActors.Add(this);
+
+	TWeakObjectPtr<AMapDataImporter> WeakThis(this);
+	FTerrainHeightBatch::SampleAsync(GetWorld(), Points, TraceSettings,
+		[WeakThis, RequestId, Chunks, Blocked = MoveTemp(Blocked), SampleSlots = MoveTemp(SampleSlots)](TArray<float>&& Heights)
+		{
+			AMapDataImporter* This = WeakThis.Get();
+			if (This && This->CollisionRequestId == RequestId)
+			{
+				This->CreateBlockedCollisionBoxes(Chunks, Blocked, SampleSlots, Heights);
+			}
+		});
+}
+
+void AMapDataImporter::CreateBlockedCollisionBoxes(const TArray<FIntPoint>& Chunks, const TBitArray<>& Blocked, const TArray<int32>& SampleSlots, const TArray<float>& TerrainHeights)
+{
+	const int32 GridWidth = ParsedMapData.Grid.Width;
+	const int32 GridHeight = ParsedMapData.Grid.Height;
+	const int32 ChunksX = FMath::DivideAndRoundUp(GridWidth, FBlockedCollisionBuilder::ChunkSize);
+	const float CellSize = ParsedMapData.Grid.CellSize * GetActorScale3D().X;
+	const FRotator GridRotation(0.0f, GetActorRotation().Yaw, 0.0f);
+
+	// Scatter sampled heights into per-chunk tiles so the builder can index them locally
+	TArray<float> ChunkHeights;
+	ChunkHeights.SetNumZeroed(Chunks.Num() * FBlockedCollisionBuilder::TilesPerChunk);
+	for (int32 Index = 0; Index < SampleSlots.Num(); ++Index)
+	{
+		ChunkHeights[SampleSlots[Index]] = TerrainHeights[Index];
+	}
 
-		FVector WorldPos = GridToWorld(Tile.X, Tile.Y);
+	UFarmGridManager* GridManager = GetGridManager();
 
-		// Sample terrain height at this position
-		float TerrainZ = SampleHeightAtWorld(WorldPos.X, WorldPos.Y);
+	int32 BoxCount = 0;
+	TArray<FBlockedCollisionRect> Rects;
+	for (int32 ChunkSlot = 0; ChunkSlot < Chunks.Num(); ++ChunkSlot)
+	{
+		const FIntPoint& Chunk = Chunks[ChunkSlot];
+		const int32 ChunkIndex = Chunk.Y * ChunksX + Chunk.X;
+		DestroyBlockedCollisionChunk(ChunkIndex);
+
+		Rects.Reset();
+		FBlockedCollisionBuilder::BuildChunkRects(Blocked,
+			TConstArrayView<float>(ChunkHeights.GetData() + ChunkSlot * FBlockedCollisionBuilder::TilesPerChunk, FBlockedCollisionBuilder::TilesPerChunk),
+			GridWidth, GridHeight, Chunk, MaxMergedHeightDifference, Rects);
 
-		// Create box component
-		UBoxComponent* BoxComp = NewObject<UBoxComponent>(this);
-		if (BoxComp)
+		for (const FBlockedCollisionRect& Rect : Rects)
 		{
+			UBoxComponent* BoxComp = NewObject<UBoxComponent>(this);
+			if (!BoxComp)
+			{
+				continue;
+			}
+
 			BoxComp->SetupAttachment(SceneRoot);
 
-			// Set box size (half extents)
-			float HalfCell = CellSize * 0.5f;
-			BoxComp->SetBoxExtent(FVector(HalfCell, HalfCell, BlockedCollisionHeight * 0.5f));
+			// Span from below the lowest tile to the wall height above the highest one
+			const float Bottom = Rect.MinZ - CollisionDepthBelow;
+			const float Top = Rect.MaxZ - CollisionDepthBelow + BlockedCollisionHeight;
+			BoxComp->SetBoxExtent(FVector(Rect.Width * CellSize * 0.5f, Rect.Height * CellSize * 0.5f, (Top - Bottom) * 0.5f));
 
-			// Position at terrain height, centered on collision volume
-			FVector BoxLocation = WorldPos;
-			BoxLocation.Z = TerrainZ - CollisionDepthBelow + (BlockedCollisionHeight * 0.5f);
+			FVector BoxLocation = GridToWorldContinuous(Rect.X + Rect.Width * 0.5f, Rect.Y + Rect.Height * 0.5f);
+			BoxLocation.Z = (Bottom + Top) * 0.5f;
 			BoxComp->SetWorldLocation(BoxLocation);
 
 			// Apply rotation to match grid
-			BoxComp->SetWorldRotation(FRotator(0, Yaw, 0));
+			BoxComp->SetWorldRotation(GridRotation);
 
 			// Configure collision
 			BoxComp->SetCollisionProfileName(BlockedCollisionProfile);
@@ -1778,15 +2608,120 @@ void AMapDataImporter::GenerateBlockedCollision()
 
 			BoxComp->RegisterComponent();
 			BlockedCollisionBoxes.Add(BoxComp);
-			BlockedCount++;
+			BlockedCollisionBoxChunks.Add(ChunkIndex);
+			BoxCount++;
+		}
+
+		// Collision boxes are static geometry that height traces can hit, so re-sample under this chunk
+		if (GridManager)
+		{
+			const int32 MinX = Chunk.X * FBlockedCollisionBuilder::ChunkSize;
+			const int32 MinY = Chunk.Y * FBlockedCollisionBuilder::ChunkSize;
+			const int32 MaxX = FMath::Min(MinX + FBlockedCollisionBuilder::ChunkSize, GridWidth);
+			const int32 MaxY = FMath::Min(MinY + FBlockedCollisionBuilder::ChunkSize, GridHeight);
+
+			FBox ChunkBounds(ForceInit);
+			ChunkBounds += GridToWorldContinuous(MinX, MinY);
+			ChunkBounds += GridToWorldContinuous(MaxX, MinY);
+			ChunkBounds += GridToWorldContinuous(MinX, MaxY);
+			ChunkBounds += GridToWorldContinuous(MaxX, MaxY);
+			GridManager->InvalidateHeightCacheRegion(ChunkBounds.Min, ChunkBounds.Max);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Generated %d collision boxes for %d blocked tiles in %d chunks"),
+		BoxCount, SampleSlots.Num(), Chunks.Num());
+}
+
+void AMapDataImporter::DestroyBlockedCollisionChunk(int32 ChunkIndex)
+{
+	for (int32 Index = BlockedCollisionBoxes.Num() - 1; Index >= 0; --Index)
+	{
+		if (BlockedCollisionBoxChunks[Index] != ChunkIndex)
+		{
+			continue;
+		}
+
+		if (UBoxComponent* Box = BlockedCollisionBoxes[Index])
+		{
+			Box->DestroyComponent();
+		}
+		BlockedCollisionBoxes.RemoveAtSwap(Index);
+		BlockedCollisionBoxChunks.RemoveAtSwap(Index);
+	}
+}
+
+void AMapDataImporter::BuildBlockedTileMask(TBitArray<>& OutBlocked) const
+{
+	const int32 GridWidth = ParsedMapData.Grid.Width;
+	const int32 GridHeight = ParsedMapData.Grid.Height;
+
+	OutBlocked.Init(false, FMath::Max(0, GridWidth * GridHeight));
+	for (const FMapTerrainTile& Tile : ParsedMapData.Terrain)
+	{
+		if (Tile.X >= 0 && Tile.Y >= 0 && Tile.X < GridWidth && Tile.Y < GridHeight && Tile.Type == ETerrainType::Blocked)
+		{
+			OutBlocked[Tile.Y * GridWidth + Tile.X] = true;
+		}
+	}
+}
+
+FVector AMapDataImporter::GridToWorldContinuous(float GridX, float GridY) const
+{
+	const FVector ActorLocation = GetActorLocation();
+	const float GridScale = GetActorScale3D().X;
+	const float CellSize = ParsedMapData.Grid.CellSize * GridScale;
+	const float Yaw = GetActorRotation().Yaw;
+
+	FVector2D LocalPos(GridX * CellSize + ParsedMapData.Grid.OriginOffset.X * GridScale,
+					   GridY * CellSize + ParsedMapData.Grid.OriginOffset.Y * GridScale);
+
+	if (!FMath::IsNearlyZero(Yaw))
+	{
+		float RadAngle = FMath::DegreesToRadians(Yaw);
+		float CosAngle = FMath::Cos(RadAngle);
+		float SinAngle = FMath::Sin(RadAngle);
+		float RotatedX = LocalPos.X * CosAngle - LocalPos.Y * SinAngle;
+		float RotatedY = LocalPos.X * SinAngle + LocalPos.Y * CosAngle;
+		LocalPos = FVector2D(RotatedX, RotatedY);
+	}
+
+	return FVector(LocalPos.X + ActorLocation.X, LocalPos.Y + ActorLocation.Y, ActorLocation.Z);
+}
+
+void AMapDataImporter::LogBlockedCollisionStats() const
+{
+	TBitArray<> Blocked;
+	BuildBlockedTileMask(Blocked);
+	const int32 BlockedTiles = Blocked.CountSetBits();
+
+	// Every box carries the same body setup regardless of its extent, so the per-tile
+	// cost is estimated as one box's measured footprint per blocked tile
+	SIZE_T BoxBytes = 0;
+	int32 LiveBoxes = 0;
+	for (const UBoxComponent* Box : BlockedCollisionBoxes)
+	{
+		if (Box)
+		{
+			BoxBytes += Box->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal) + Box->GetClass()->GetStructureSize();
+			LiveBoxes++;
 		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Generated %d blocked tile collision boxes"), BlockedCount);
+	const double BytesPerBox = LiveBoxes > 0 ? static_cast<double>(BoxBytes) / LiveBoxes : 0.0;
+	const double PerTileBytes = BytesPerBox * BlockedTiles;
+
+	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Blocked collision - %d blocked tiles, %d boxes (%.1f%% fewer components)"),
+		BlockedTiles, LiveBoxes, BlockedTiles > 0 ? 100.0 * (1.0 - static_cast<double>(LiveBoxes) / BlockedTiles) : 0.0);
+	UE_LOG(LogTemp, Log, TEXT("MapDataImporter: Blocked collision memory - merged %.1f KB, per-tile estimate %.1f KB (%.0f bytes per box)"),
+		BoxBytes / 1024.0, PerTileBytes / 1024.0, BytesPerBox);
 }
 
 void AMapDataImporter::ClearBlockedCollision()
 {
+	// Drop any collision batch still waiting on heights
+	++CollisionRequestId;
+
 	for (UBoxComponent* Box : BlockedCollisionBoxes)
 	{
 		if (Box)
@@ -1795,6 +2730,7 @@ void AMapDataImporter::ClearBlockedCollision()
 		}
 	}
 	BlockedCollisionBoxes.Empty();
+	BlockedCollisionBoxChunks.Empty();
 }
 
 void AMapDataImporter::RebuildBlockedCollision()
@@ -5,11 +5,19 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "MapDataTypes.h"
+#include "TerrainHeightBatch.h"
 #include "MapDataImporter.generated.h"
 
 class UFarmGridManager;
 class UObjectClassRegistry;
 class UBillboardComponent;
+struct FStreamableHandle;
+
+/**
+ * Delegates for time-sliced spawning progress
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnMapSpawnProgress, int32, NumProcessed, int32, NumTotal);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnMapSpawnComplete, int32, NumSpawned);
 
 /**
  * Actor that imports map data from JSON and spawns objects into the level.
@@ -38,6 +46,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
 	UObjectClassRegistry* ObjectRegistry;
 
+	/** Parse JSON with the streaming reader instead of building a full DOM first */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
+	bool bUseStreamingJsonReader = true;
+
+	/** Load the cooked binary (<json>.mapbin) instead of parsing the JSON when it is at least as new */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
+	bool bUseCookedMapData = true;
+
 	/** Whether to automatically spawn objects on BeginPlay */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
 	bool bAutoSpawnOnBeginPlay = true;
@@ -98,6 +114,31 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data|Debug", meta = (EditCondition = "bDrawDebugGrid"))
 	bool bUsePersistentLines = true;
 
+	// ---- Spawning ----
+
+	/** Spread SpawnAllObjects over several frames in game worlds (editor worlds always spawn at once) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data|Spawning")
+	bool bTimeSliceSpawning = true;
+
+	/** Milliseconds of spawning per frame when time-slicing (at least one spawn always runs) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data|Spawning", meta = (EditCondition = "bTimeSliceSpawning", ClampMin = "0.1"))
+	float SpawnBudgetMs = 3.0f;
+
+	/** Fired after each frame of time-sliced spawning */
+	UPROPERTY(BlueprintAssignable, Category = "Map Data|Spawning")
+	FOnMapSpawnProgress OnSpawnProgress;
+
+	/** Fired once SpawnAllObjects has spawned everything (immediately when not time-slicing) */
+	UPROPERTY(BlueprintAssignable, Category = "Map Data|Spawning")
+	FOnMapSpawnComplete OnSpawnComplete;
+
+	/**
+	 * Poolable classes planted or placed on farmland at runtime (e.g. tilled soil, crops). On import in
+	 * game worlds the grid actor pool is prewarmed with one of each per tillable tile, up to its cap.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data|Spawning")
+	TArray<TSubclassOf<AActor>> PrewarmPerTillableTile;
+
 	// ---- Collision Generation ----
 
 	/** Whether to generate invisible collision walls for blocked tiles */
@@ -116,6 +157,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data|Collision", meta = (EditCondition = "bGenerateBlockedCollision"))
 	FName BlockedCollisionProfile = TEXT("BlockAll");
 
+	/** Adjacent blocked tiles share one collision box only while their terrain heights differ by at most this much */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data|Collision", meta = (EditCondition = "bGenerateBlockedCollision", ClampMin = "0.0"))
+	float MaxMergedHeightDifference = 25.0f;
+
 	// ---- Import Functions ----
 
 	/** Import and parse the JSON file */
@@ -126,6 +171,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Map Data")
 	bool ImportFromJsonFile(const FString& FilePath);
 
+	/** Write the cooked binary for JsonFilePath next to the JSON */
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Map Data")
+	void CookMapData();
+
 	/** Import from a JSON string directly */
 	UFUNCTION(BlueprintCallable, Category = "Map Data")
 	bool ImportFromJsonString(const FString& JsonString);
@@ -138,11 +187,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Map Data")
 	void SpawnObjectsOfType(const FString& ObjectType);
 
-	/** Clear all spawned objects */
+	/** Clear all spawned objects (and cancel any spawning still in progress) */
 	UFUNCTION(BlueprintCallable, Category = "Map Data")
 	void ClearSpawnedObjects();
 
-	/** Reimport JSON and respawn all objects */
+	/** Whether a time-sliced SpawnAllObjects is still running */
+	UFUNCTION(BlueprintPure, Category = "Map Data|Spawning")
+	bool IsSpawning() const { return bSpawnQueueActive; }
+
+	/** Fraction of the current spawn queue processed (1 when idle) */
+	UFUNCTION(BlueprintPure, Category = "Map Data|Spawning")
+	float GetSpawnProgress() const;
+
+	/**
+	 * Reimport the map file and apply only what changed, matching objects, spawners and map exits
+	 * by Id: unchanged elements keep their actors, moved ones are relocated, and only changed or
+	 * new ones are spawned. The grid manager only rewrites changed tiles, zones and roads.
+	 * Falls back to a full respawn when the grid layout changed.
+	 */
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Map Data")
 	void ReimportAndRespawn();
 
@@ -193,6 +255,10 @@ public:
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Map Data|Debug")
 	void ReimportAndRedraw();
 
+	/** Parse JsonFilePath repeatedly with the DOM and streaming readers and log time and memory for each */
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Map Data|Debug")
+	void BenchmarkJsonImport();
+
 	// ---- Collision Generation ----
 
 	/** Generate collision for all blocked tiles */
@@ -207,6 +273,14 @@ public:
 	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Map Data|Collision")
 	void RebuildBlockedCollision();
 
+	/** Regenerate collision for the chunks containing these tiles (call after their terrain changes) */
+	UFUNCTION(BlueprintCallable, Category = "Map Data|Collision")
+	void RebuildBlockedCollisionForTiles(const TArray<FIntPoint>& Tiles);
+
+	/** Log blocked tiles vs generated boxes and the estimated physics memory of each approach */
+	UFUNCTION(BlueprintCallable, CallInEditor, Category = "Map Data|Collision")
+	void LogBlockedCollisionStats() const;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -226,6 +300,10 @@ protected:
 	UPROPERTY()
 	TArray<AActor*> SpawnedActors;
 
+	/** Spawned actors by GetSpawnKey, for matching actors to elements on reimport */
+	UPROPERTY()
+	TMap<FString, AActor*> SpawnedActorsByKey;
+
 	UPROPERTY()
 	bool bHasValidData = false;
 
@@ -237,23 +315,148 @@ protected:
 	UPROPERTY()
 	TArray<class UBoxComponent*> BlockedCollisionBoxes;
 
+	/** Collision chunk index (ChunkY * ChunksX + ChunkX) of each entry in BlockedCollisionBoxes */
+	UPROPERTY()
+	TArray<int32> BlockedCollisionBoxChunks;
+
 	/** Create/destroy the persistent line component */
 	void CreateGridLineBatch();
 	void DestroyGridLineBatch();
 
-	/** Rebuild persistent line visualization */
+	/** Flat line geometry awaiting terrain heights */
+	struct FGridLineGeometry
+	{
+		/** XY of every height sample: the grid point lattice (row-major) followed by 4 corners per terrain tile */
+		TArray<FVector2D> Points;
+		TArray<FLinearColor> TileColors;
+		int32 LatticeWidth = 0;
+		int32 LatticeHeight = 0;
+		float HalfCell = 0.0f;
+		float BaseZ = 0.0f;
+	};
+
+	/** Rebuild persistent line visualization (heights are sampled in one batch) */
 	void RebuildPersistentGridLines();
 
-	/** Parse JSON object into map data */
-	bool ParseJsonObject(const TSharedPtr<FJsonObject>& JsonObject);
+	/** Emit the line batch once heights are known (nullptr = flat at the actor's height) */
+	void DrawPersistentGridLines(const FGridLineGeometry& Geometry, const TArray<float>* Heights);
+
+	/** Sample heights for the blocked tiles of these collision chunks, then rebuild their boxes */
+	void GenerateBlockedCollisionForChunks(const TArray<FIntPoint>& Chunks, int32 RequestId);
+
+	/**
+	 * Replace each chunk's boxes with merged boxes once terrain heights are known.
+	 * SampleSlots gives each sampled height's position in a per-chunk scratch buffer:
+	 * ChunkSlot * TilesPerChunk + LocalY * ChunkSize + LocalX, with chunk slots in Chunks order.
+	 */
+	void CreateBlockedCollisionBoxes(const TArray<FIntPoint>& Chunks, const TBitArray<>& Blocked, const TArray<int32>& SampleSlots, const TArray<float>& TerrainHeights);
+
+	/** Destroy the collision boxes belonging to one chunk */
+	void DestroyBlockedCollisionChunk(int32 ChunkIndex);
+
+	/** Row-major blocked flags for every in-bounds tile of the parsed map */
+	void BuildBlockedTileMask(TBitArray<>& OutBlocked) const;
+
+	/** World position of a fractional grid position (tile corners at integers), at the actor's height */
+	FVector GridToWorldContinuous(float GridX, float GridY) const;
+
+	/** Trace settings for batched height sampling (matches the grid manager's when available) */
+	FTerrainHeightTraceSettings GetHeightTraceSettings() const;
+
+	/** Forget a spawned actor released to the pool by someone else (chopped, harvested, ...) */
+	void HandleActorReleased(AActor* Actor);
+
+	FDelegateHandle ActorReleasedHandle;
+
+	/** Set while the importer releases its own actors, which it untracks itself */
+	bool bReleasingSpawnedActors = false;
+
+	/** Bumped per rebuild so stale height batches are ignored */
+	int32 GridLineRequestId = 0;
+	int32 CollisionRequestId = 0;
+
+	/** Resolve a JSON path relative to the Content folder */
+	static FString ResolveJsonPath(const FString& FilePath);
+
+	/** Load a cooked or JSON map into ParsedMapData without applying it */
+	bool LoadMapData(const FString& FilePath);
+
+	/** Push freshly loaded ParsedMapData into the grid manager */
+	void ApplyParsedMapData();
+
+	/** Parse a JSON document into ParsedMapData, streaming or through a DOM */
+	bool ParseJsonString(const FString& JsonString, bool bStreaming);
+
+	/** Parse JSON object into OutData, which is reset first */
+	bool ParseJsonObject(const TSharedPtr<FJsonObject>& JsonObject, FMapData& OutData);
 
 	/** Parse layers from JSON */
-	void ParseTerrainLayer(const TSharedPtr<FJsonObject>& LayersObject);
-	void ParseObjectsLayer(const TSharedPtr<FJsonObject>& LayersObject);
-	void ParseZonesLayer(const TSharedPtr<FJsonObject>& LayersObject);
-	void ParseSpawnersLayer(const TSharedPtr<FJsonObject>& LayersObject);
-	void ParsePathsLayer(const TSharedPtr<FJsonObject>& LayersObject);
-	void ParseConnectionsLayer(const TSharedPtr<FJsonObject>& LayersObject);
+	void ParseTerrainLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData);
+	void ParseObjectsLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData);
+	void ParseZonesLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData);
+	void ParseSpawnersLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData);
+	void ParsePathsLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData);
+	void ParseConnectionsLayer(const TSharedPtr<FJsonObject>& LayersObject, FMapData& OutData);
+
+	/** A queued spawn: which layer, and the element's index in it */
+	struct FPendingSpawn
+	{
+		enum class EKind : uint8 { Object, Spawner, Connection };
+
+		EKind Kind = EKind::Object;
+		int32 Index = 0;
+		float DistanceSq = 0.0f;
+	};
+
+	/** Spawns left for time-sliced spawning, nearest to the player first */
+	TArray<FPendingSpawn> SpawnQueue;
+	int32 SpawnQueueCursor = 0;
+	bool bSpawnQueueActive = false;
+	FTimerHandle SpawnTimerHandle;
+
+	/** Keeps soft actor classes loaded for the spawn queue */
+	TSharedPtr<FStreamableHandle> SpawnClassLoadHandle;
+
+	/** Fill SpawnQueue from the parsed map, sorted by distance to GetSpawnFocusLocation */
+	void BuildSpawnQueue();
+
+	/** Spawn everything in SpawnQueue, synchronously or time-sliced */
+	void RunSpawnQueue();
+
+	/** Spawn from the queue until the frame budget is spent, then reschedule */
+	void ProcessSpawnQueue();
+
+	void FinishSpawnQueue();
+	void CancelSpawnQueue();
+
+	/** Player pawn if there is one yet, else the map's default spawn point, else the grid origin */
+	FVector GetSpawnFocusLocation() const;
+
+	/** Registry IDs the queued spawns may resolve */
+	void GatherSpawnClassIds(TArray<FString>& OutClassIds) const;
+
+	AActor* SpawnPending(const FPendingSpawn& Pending);
+
+	/** Stable key for an element's actor ("object:<Id>" etc.), empty for elements without an Id */
+	static FString GetSpawnKey(FPendingSpawn::EKind Kind, const FString& Id);
+
+	/** Key of the element a pending spawn refers to */
+	FString GetSpawnKey(const FPendingSpawn& Pending) const;
+
+	/**
+	 * Reuse, move or replace spawned actors after ParsedMapData was reloaded over OldData.
+	 * Grid cells must already reflect the new data.
+	 */
+	void RespawnChangedObjects(const FMapData& OldData);
+
+	/** Where each element type's actor is placed */
+	FTransform GetSpawnTransform(const FMapObjectData& ObjectData) const;
+	FTransform GetSpawnTransform(const FMapSpawnerData& SpawnerData) const;
+	FTransform GetSpawnTransform(const FMapConnectionData& ConnectionData) const;
+
+	/** Occupy grid cells through the actor's footprint component, or with the given size if it has none */
+	void RegisterSpawnedActorWithGrid(AActor* Actor, const FGridCoordinate& Anchor, int32 Width, int32 Height) const;
+	void UnregisterSpawnedActorFromGrid(AActor* Actor) const;
 
 	/** Spawn individual element types */
 	AActor* SpawnObject(const FMapObjectData& ObjectData);
@@ -293,7 +496,7 @@ protected:
 	void DrawDebugGridLines(float Duration) const;
 
 	/** Get color for terrain type */
-	static FColor GetTerrainColor(const FString& TerrainType);
+	static FColor GetTerrainColor(ETerrainType TerrainType);
 
 	/** Get color for zone type */
 	static FColor GetZoneColor(const FString& ZoneType);
@@ -0,0 +1,758 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "MapDataStreamReader.h"
+
+bool FMapDataStreamReader::ReadFromString(const FString& JsonString, FMapData& OutData, FString& OutError)
+{
+	OutData = FMapData();
+
+	TSharedRef<TJsonReader<>> JsonReader = TJsonReaderFactory<>::Create(JsonString);
+	FMapDataStreamReader StreamReader(JsonReader, OutData);
+
+	EJsonNotation Notation;
+	if (!JsonReader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart)
+	{
+		OutError = TEXT("Expected a JSON object at the document root");
+		return false;
+	}
+
+	if (!StreamReader.ReadRoot())
+	{
+		OutError = JsonReader->GetErrorMessage();
+		if (OutError.IsEmpty())
+		{
+			OutError = TEXT("Unexpected end of document");
+		}
+		return false;
+	}
+
+	return true;
+}
+
+FMapDataStreamReader::FMapDataStreamReader(const TSharedRef<TJsonReader<>>& InReader, FMapData& InData)
+	: Reader(InReader)
+	, Data(InData)
+{
+}
+
+// ---- Traversal ----
+
+template <typename HandlerType>
+bool FMapDataStreamReader::ForEachMember(HandlerType&& Handler)
+{
+	EJsonNotation Notation;
+	while (Reader->ReadNext(Notation))
+	{
+		if (Notation == EJsonNotation::ObjectEnd)
+		{
+			return true;
+		}
+		if (Notation == EJsonNotation::Error)
+		{
+			return false;
+		}
+		if (!Handler(Notation, Reader->GetIdentifier()) && !SkipValue(Notation))
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+template <typename HandlerType>
+bool FMapDataStreamReader::ForEachElement(HandlerType&& Handler)
+{
+	EJsonNotation Notation;
+	while (Reader->ReadNext(Notation))
+	{
+		if (Notation == EJsonNotation::ArrayEnd)
+		{
+			return true;
+		}
+		if (Notation == EJsonNotation::Error)
+		{
+			return false;
+		}
+		if (!Handler(Notation) && !SkipValue(Notation))
+		{
+			return false;
+		}
+	}
+	return false;
+}
+
+bool FMapDataStreamReader::SkipValue(EJsonNotation Notation)
+{
+	if (Notation == EJsonNotation::ObjectStart)
+	{
+		return Reader->SkipObject();
+	}
+	if (Notation == EJsonNotation::ArrayStart)
+	{
+		return Reader->SkipArray();
+	}
+	return true;
+}
+
+void FMapDataStreamReader::ReadString(EJsonNotation Notation, FString& Out) const
+{
+	if (Notation == EJsonNotation::String)
+	{
+		Out = Reader->GetValueAsString();
+	}
+}
+
+void FMapDataStreamReader::ReadInt(EJsonNotation Notation, int32& Out) const
+{
+	if (Notation == EJsonNotation::Number)
+	{
+		Out = FMath::RoundToInt(Reader->GetValueAsNumber());
+	}
+}
+
+void FMapDataStreamReader::ReadFloat(EJsonNotation Notation, float& Out) const
+{
+	if (Notation == EJsonNotation::Number)
+	{
+		Out = static_cast<float>(Reader->GetValueAsNumber());
+	}
+}
+
+void FMapDataStreamReader::ReadBool(EJsonNotation Notation, bool& Out) const
+{
+	if (Notation == EJsonNotation::Boolean)
+	{
+		Out = Reader->GetValueAsBoolean();
+	}
+}
+
+// ---- Document ----
+
+bool FMapDataStreamReader::ReadRoot()
+{
+	return ForEachMember([this](EJsonNotation Notation, const FString& Name)
+	{
+		if (Notation == EJsonNotation::ObjectStart)
+		{
+			if (Name == TEXT("metadata"))
+			{
+				return ReadMetadata();
+			}
+			if (Name == TEXT("grid"))
+			{
+				return ReadGrid();
+			}
+			if (Name == TEXT("layers"))
+			{
+				return ReadLayers();
+			}
+			return false;
+		}
+
+		if (Name == TEXT("formatVersion"))
+		{
+			ReadString(Notation, Data.FormatVersion);
+		}
+		else if (Name == TEXT("mapId"))
+		{
+			ReadString(Notation, Data.MapId);
+		}
+		else if (Name == TEXT("displayName"))
+		{
+			ReadString(Notation, Data.DisplayName);
+		}
+		else if (Name == TEXT("defaultTerrain"))
+		{
+			ReadString(Notation, Data.DefaultTerrain);
+		}
+		return false;
+	});
+}
+
+bool FMapDataStreamReader::ReadMetadata()
+{
+	return ForEachMember([this](EJsonNotation Notation, const FString& Name)
+	{
+		if (Name == TEXT("author"))
+		{
+			ReadString(Notation, Data.Metadata.Author);
+		}
+		else if (Name == TEXT("created"))
+		{
+			ReadString(Notation, Data.Metadata.Created);
+		}
+		else if (Name == TEXT("modified"))
+		{
+			ReadString(Notation, Data.Metadata.Modified);
+		}
+		else if (Name == TEXT("description"))
+		{
+			ReadString(Notation, Data.Metadata.Description);
+		}
+		return false;
+	});
+}
+
+bool FMapDataStreamReader::ReadGrid()
+{
+	return ForEachMember([this](EJsonNotation Notation, const FString& Name)
+	{
+		if (Name == TEXT("width"))
+		{
+			ReadInt(Notation, Data.Grid.Width);
+		}
+		else if (Name == TEXT("height"))
+		{
+			ReadInt(Notation, Data.Grid.Height);
+		}
+		else if (Name == TEXT("cellSize"))
+		{
+			ReadFloat(Notation, Data.Grid.CellSize);
+		}
+		else if (Name == TEXT("originOffset") && Notation == EJsonNotation::ObjectStart)
+		{
+			float X = 0.0f;
+			float Y = 0.0f;
+			const bool bOk = ForEachMember([this, &X, &Y](EJsonNotation OffsetNotation, const FString& Axis)
+			{
+				if (Axis == TEXT("x"))
+				{
+					ReadFloat(OffsetNotation, X);
+				}
+				else if (Axis == TEXT("y"))
+				{
+					ReadFloat(OffsetNotation, Y);
+				}
+				return false;
+			});
+			Data.Grid.OriginOffset = FVector2D(X, Y);
+			return bOk;
+		}
+		return false;
+	});
+}
+
+bool FMapDataStreamReader::ReadLayers()
+{
+	return ForEachMember([this](EJsonNotation Notation, const FString& Name)
+	{
+		if (Notation != EJsonNotation::ArrayStart)
+		{
+			return false;
+		}
+
+		if (Name == TEXT("terrain"))
+		{
+			return ReadTerrain();
+		}
+		if (Name == TEXT("objects"))
+		{
+			return ReadObjects();
+		}
+		if (Name == TEXT("zones"))
+		{
+			return ReadZones();
+		}
+		if (Name == TEXT("spawners"))
+		{
+			return ReadSpawners();
+		}
+		if (Name == TEXT("paths"))
+		{
+			return ReadPaths();
+		}
+		if (Name == TEXT("connections"))
+		{
+			return ReadConnections();
+		}
+		return false;
+	});
+}
+
+// ---- Layers ----
+
+bool FMapDataStreamReader::ReadTerrain()
+{
+	return ForEachElement([this](EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		int32 X = 0;
+		int32 Y = 0;
+		ETerrainType Type = ETerrainType::Default;
+		TMap<FString, FString> Properties;
+
+		const bool bOk = ForEachMember([this, &X, &Y, &Type, &Properties](EJsonNotation TileNotation, const FString& Name)
+		{
+			if (Name == TEXT("x"))
+			{
+				ReadInt(TileNotation, X);
+			}
+			else if (Name == TEXT("y"))
+			{
+				ReadInt(TileNotation, Y);
+			}
+			else if (Name == TEXT("type") && TileNotation == EJsonNotation::String)
+			{
+				// Interned straight from the reader's token buffer; no per-tile string is kept
+				Type = FMapTerrainTile::ParseTerrainType(Reader->GetValueAsString());
+			}
+			else if (Name == TEXT("properties") && TileNotation == EJsonNotation::ObjectStart)
+			{
+				return ReadProperties(Properties);
+			}
+			return false;
+		});
+
+		Data.AddTerrainTile(X, Y, Type, MoveTemp(Properties));
+		return bOk;
+	});
+}
+
+bool FMapDataStreamReader::ReadObjects()
+{
+	return ForEachElement([this](EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		FMapObjectData& Obj = Data.Objects.AddDefaulted_GetRef();
+		return ForEachMember([this, &Obj](EJsonNotation FieldNotation, const FString& Name)
+		{
+			if (Name == TEXT("properties") && FieldNotation == EJsonNotation::ObjectStart)
+			{
+				return ReadProperties(Obj.Properties);
+			}
+
+			if (Name == TEXT("id"))
+			{
+				ReadString(FieldNotation, Obj.Id);
+			}
+			else if (Name == TEXT("type"))
+			{
+				ReadString(FieldNotation, Obj.Type);
+			}
+			else if (Name == TEXT("objectClass"))
+			{
+				ReadString(FieldNotation, Obj.ObjectClass);
+			}
+			else if (Name == TEXT("x"))
+			{
+				ReadInt(FieldNotation, Obj.X);
+			}
+			else if (Name == TEXT("y"))
+			{
+				ReadInt(FieldNotation, Obj.Y);
+			}
+			else if (Name == TEXT("width"))
+			{
+				ReadInt(FieldNotation, Obj.Width);
+			}
+			else if (Name == TEXT("height"))
+			{
+				ReadInt(FieldNotation, Obj.Height);
+			}
+			else if (Name == TEXT("rotation"))
+			{
+				ReadInt(FieldNotation, Obj.Rotation);
+			}
+			return false;
+		});
+	});
+}
+
+bool FMapDataStreamReader::ReadZones()
+{
+	return ForEachElement([this](EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		FMapZoneData& Zone = Data.Zones.AddDefaulted_GetRef();
+		return ForEachMember([this, &Zone](EJsonNotation FieldNotation, const FString& Name)
+		{
+			if (Name == TEXT("points") && FieldNotation == EJsonNotation::ArrayStart)
+			{
+				return ReadMapPoints(Zone.Points);
+			}
+			if (Name == TEXT("properties") && FieldNotation == EJsonNotation::ObjectStart)
+			{
+				return ReadProperties(Zone.Properties);
+			}
+
+			if (Name == TEXT("id"))
+			{
+				ReadString(FieldNotation, Zone.Id);
+			}
+			else if (Name == TEXT("type"))
+			{
+				ReadString(FieldNotation, Zone.Type);
+			}
+			else if (Name == TEXT("shape"))
+			{
+				ReadString(FieldNotation, Zone.Shape);
+			}
+			else if (Name == TEXT("x"))
+			{
+				ReadInt(FieldNotation, Zone.X);
+			}
+			else if (Name == TEXT("y"))
+			{
+				ReadInt(FieldNotation, Zone.Y);
+			}
+			else if (Name == TEXT("width"))
+			{
+				ReadInt(FieldNotation, Zone.Width);
+			}
+			else if (Name == TEXT("height"))
+			{
+				ReadInt(FieldNotation, Zone.Height);
+			}
+			return false;
+		});
+	});
+}
+
+bool FMapDataStreamReader::ReadSpawners()
+{
+	return ForEachElement([this](EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		FMapSpawnerData& Spawner = Data.Spawners.AddDefaulted_GetRef();
+		FString TreeType;
+		bool bHasResourceType = false;
+
+		const bool bOk = ForEachMember([this, &Spawner, &TreeType, &bHasResourceType](EJsonNotation FieldNotation, const FString& Name)
+		{
+			if (Name == TEXT("properties") && FieldNotation == EJsonNotation::ObjectStart)
+			{
+				return ReadProperties(Spawner.Properties);
+			}
+
+			if (Name == TEXT("id"))
+			{
+				ReadString(FieldNotation, Spawner.Id);
+			}
+			else if (Name == TEXT("type"))
+			{
+				ReadString(FieldNotation, Spawner.Type);
+			}
+			else if (Name == TEXT("resourceType") && FieldNotation == EJsonNotation::String)
+			{
+				Spawner.ResourceType = Reader->GetValueAsString();
+				bHasResourceType = true;
+			}
+			else if (Name == TEXT("treeType"))
+			{
+				ReadString(FieldNotation, TreeType);
+			}
+			else if (Name == TEXT("x"))
+			{
+				ReadInt(FieldNotation, Spawner.X);
+			}
+			else if (Name == TEXT("y"))
+			{
+				ReadInt(FieldNotation, Spawner.Y);
+			}
+			return false;
+		});
+
+		// Support both "resourceType" and "treeType", preferring the former
+		if (!bHasResourceType)
+		{
+			Spawner.ResourceType = MoveTemp(TreeType);
+		}
+		return bOk;
+	});
+}
+
+bool FMapDataStreamReader::ReadPaths()
+{
+	return ForEachElement([this](EJsonNotation Notation)
+	{
+		return Notation == EJsonNotation::ObjectStart && ReadRoadOrPath();
+	});
+}
+
+bool FMapDataStreamReader::ReadRoadOrPath()
+{
+	// "type" may appear after the fields that depend on it, so fill both shapes and keep one
+	FMapRoadData Road;
+	FMapPathData Path;
+	TMap<FString, FString> Properties;
+
+	// An absent type reads as empty, matching the DOM import
+	Path.Type.Reset();
+
+	const bool bOk = ForEachMember([this, &Road, &Path, &Properties](EJsonNotation Notation, const FString& Name)
+	{
+		if (Notation == EJsonNotation::ArrayStart)
+		{
+			if (Name == TEXT("waypoints"))
+			{
+				return ReadRoadWaypoints(Road);
+			}
+			if (Name == TEXT("connectedRoads"))
+			{
+				return ReadStringArray(Road.ConnectedRoads);
+			}
+			if (Name == TEXT("locations"))
+			{
+				return ReadScheduleLocations(Path);
+			}
+			return false;
+		}
+		if (Name == TEXT("properties") && Notation == EJsonNotation::ObjectStart)
+		{
+			return ReadProperties(Properties);
+		}
+
+		if (Name == TEXT("type"))
+		{
+			ReadString(Notation, Path.Type);
+		}
+		else if (Name == TEXT("id"))
+		{
+			ReadString(Notation, Path.Id);
+		}
+		else if (Name == TEXT("bidirectional"))
+		{
+			ReadBool(Notation, Road.bBidirectional);
+		}
+		else if (Name == TEXT("speedMultiplier"))
+		{
+			ReadFloat(Notation, Road.SpeedMultiplier);
+		}
+		else if (Name == TEXT("npcId"))
+		{
+			ReadString(Notation, Path.NpcId);
+		}
+		else if (Name == TEXT("npcClass"))
+		{
+			ReadString(Notation, Path.NpcClass);
+		}
+		else if (Name == TEXT("startTime"))
+		{
+			ReadFloat(Notation, Path.StartTime);
+		}
+		else if (Name == TEXT("endTime"))
+		{
+			ReadFloat(Notation, Path.EndTime);
+		}
+		return false;
+	});
+
+	if (Path.Type == TEXT("road"))
+	{
+		Road.Id = MoveTemp(Path.Id);
+		Road.Properties = MoveTemp(Properties);
+		Data.Roads.Add(MoveTemp(Road));
+	}
+	else
+	{
+		Path.Properties = MoveTemp(Properties);
+		Data.Paths.Add(MoveTemp(Path));
+	}
+	return bOk;
+}
+
+bool FMapDataStreamReader::ReadConnections()
+{
+	return ForEachElement([this](EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		FMapConnectionData& Connection = Data.Connections.AddDefaulted_GetRef();
+		return ForEachMember([this, &Connection](EJsonNotation FieldNotation, const FString& Name)
+		{
+			if (Name == TEXT("properties") && FieldNotation == EJsonNotation::ObjectStart)
+			{
+				return ReadProperties(Connection.Properties);
+			}
+
+			if (Name == TEXT("id"))
+			{
+				ReadString(FieldNotation, Connection.Id);
+			}
+			else if (Name == TEXT("type"))
+			{
+				ReadString(FieldNotation, Connection.Type);
+			}
+			else if (Name == TEXT("x"))
+			{
+				ReadInt(FieldNotation, Connection.X);
+			}
+			else if (Name == TEXT("y"))
+			{
+				ReadInt(FieldNotation, Connection.Y);
+			}
+			else if (Name == TEXT("width"))
+			{
+				ReadInt(FieldNotation, Connection.Width);
+			}
+			else if (Name == TEXT("height"))
+			{
+				ReadInt(FieldNotation, Connection.Height);
+			}
+			else if (Name == TEXT("facing"))
+			{
+				ReadString(FieldNotation, Connection.Facing);
+			}
+			else if (Name == TEXT("targetMap"))
+			{
+				ReadString(FieldNotation, Connection.TargetMap);
+			}
+			else if (Name == TEXT("targetSpawn"))
+			{
+				ReadString(FieldNotation, Connection.TargetSpawn);
+			}
+			return false;
+		});
+	});
+}
+
+// ---- Nested values ----
+
+bool FMapDataStreamReader::ReadRoadWaypoints(FMapRoadData& Road)
+{
+	return ForEachElement([this, &Road](EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		FRoadWaypoint& Waypoint = Road.Waypoints.AddDefaulted_GetRef();
+		return ForEachMember([this, &Waypoint](EJsonNotation FieldNotation, const FString& Name)
+		{
+			if (Name == TEXT("name"))
+			{
+				ReadString(FieldNotation, Waypoint.Name);
+			}
+			else if (Name == TEXT("x"))
+			{
+				ReadInt(FieldNotation, Waypoint.X);
+			}
+			else if (Name == TEXT("y"))
+			{
+				ReadInt(FieldNotation, Waypoint.Y);
+			}
+			return false;
+		});
+	});
+}
+
+bool FMapDataStreamReader::ReadScheduleLocations(FMapPathData& Path)
+{
+	return ForEachElement([this, &Path](EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		FMapScheduleLocation& Location = Path.Locations.AddDefaulted_GetRef();
+		return ForEachMember([this, &Location](EJsonNotation FieldNotation, const FString& Name)
+		{
+			if (Name == TEXT("activities") && FieldNotation == EJsonNotation::ArrayStart)
+			{
+				return ReadStringArray(Location.Activities);
+			}
+
+			if (Name == TEXT("name"))
+			{
+				ReadString(FieldNotation, Location.Name);
+			}
+			else if (Name == TEXT("x"))
+			{
+				ReadInt(FieldNotation, Location.X);
+			}
+			else if (Name == TEXT("y"))
+			{
+				ReadInt(FieldNotation, Location.Y);
+			}
+			else if (Name == TEXT("facing"))
+			{
+				ReadString(FieldNotation, Location.Facing);
+			}
+			else if (Name == TEXT("arrivalTolerance"))
+			{
+				ReadFloat(FieldNotation, Location.ArrivalTolerance);
+			}
+			return false;
+		});
+	});
+}
+
+bool FMapDataStreamReader::ReadMapPoints(TArray<FMapPoint>& OutPoints)
+{
+	return ForEachElement([this, &OutPoints](EJsonNotation Notation)
+	{
+		if (Notation != EJsonNotation::ObjectStart)
+		{
+			return false;
+		}
+
+		FMapPoint& Point = OutPoints.AddDefaulted_GetRef();
+		return ForEachMember([this, &Point](EJsonNotation FieldNotation, const FString& Name)
+		{
+			if (Name == TEXT("x"))
+			{
+				ReadInt(FieldNotation, Point.X);
+			}
+			else if (Name == TEXT("y"))
+			{
+				ReadInt(FieldNotation, Point.Y);
+			}
+			return false;
+		});
+	});
+}
+
+bool FMapDataStreamReader::ReadStringArray(TArray<FString>& OutStrings)
+{
+	return ForEachElement([this, &OutStrings](EJsonNotation Notation)
+	{
+		if (Notation == EJsonNotation::String)
+		{
+			OutStrings.Add(Reader->GetValueAsString());
+		}
+		return false;
+	});
+}
+
+bool FMapDataStreamReader::ReadProperties(TMap<FString, FString>& OutProperties)
+{
+	return ForEachMember([this, &OutProperties](EJsonNotation Notation, const FString& Key)
+	{
+		switch (Notation)
+		{
+		case EJsonNotation::String:
+			OutProperties.Add(Key, Reader->GetValueAsString());
+			break;
+		case EJsonNotation::Boolean:
+			OutProperties.Add(Key, Reader->GetValueAsBoolean() ? TEXT("true") : TEXT("false"));
+			break;
+		case EJsonNotation::Number:
+			OutProperties.Add(Key, FString::SanitizeFloat(Reader->GetValueAsNumber()));
+			break;
+		default:
+			break;
+		}
+		return false;
+	});
+}
@@ -0,0 +1,71 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Serialization/JsonReader.h"
+#include "MapDataTypes.h"
+
+/**
+ * Streaming map JSON reader.
+ *
+ * Pulls tokens from a TJsonReader and writes each element straight into FMapData,
+ * without first building a FJsonObject DOM of the whole file. Terrain tiles are
+ * interned to ETerrainType as they are read and only tiles with a "properties"
+ * object allocate a property map. Produces the same FMapData as the DOM import;
+ * unknown fields are skipped.
+ */
+class HOBUNJIHOLLOW_API FMapDataStreamReader
+{
+public:
+	/** Parse a full map document. On failure OutData is left partially filled and OutError describes the problem. */
+	static bool ReadFromString(const FString& JsonString, FMapData& OutData, FString& OutError);
+
+private:
+	FMapDataStreamReader(const TSharedRef<TJsonReader<>>& InReader, FMapData& InData);
+
+	bool ReadRoot();
+	bool ReadMetadata();
+	bool ReadGrid();
+	bool ReadLayers();
+
+	bool ReadTerrain();
+	bool ReadObjects();
+	bool ReadZones();
+	bool ReadSpawners();
+	bool ReadPaths();
+	bool ReadConnections();
+
+	bool ReadRoadOrPath();
+	bool ReadRoadWaypoints(FMapRoadData& Road);
+	bool ReadScheduleLocations(FMapPathData& Path);
+	bool ReadMapPoints(TArray<FMapPoint>& OutPoints);
+	bool ReadStringArray(TArray<FString>& OutStrings);
+
+	/** Read a "properties" object: strings as-is, numbers and booleans stringified, anything else skipped */
+	bool ReadProperties(TMap<FString, FString>& OutProperties);
+
+	/**
+	 * Visit the members of an object whose ObjectStart was just read, up to its ObjectEnd.
+	 * Handler(Notation, Identifier) returns true if it consumed the value; nested values it
+	 * declines are skipped.
+	 */
+	template <typename HandlerType>
+	bool ForEachMember(HandlerType&& Handler);
+
+	/** Visit the elements of an array whose ArrayStart was just read, up to its ArrayEnd */
+	template <typename HandlerType>
+	bool ForEachElement(HandlerType&& Handler);
+
+	/** Skip the value just read if it opens an object or array */
+	bool SkipValue(EJsonNotation Notation);
+
+	/** Scalar accessors for the value just read; mismatched types leave Out untouched */
+	void ReadString(EJsonNotation Notation, FString& Out) const;
+	void ReadInt(EJsonNotation Notation, int32& Out) const;
+	void ReadFloat(EJsonNotation Notation, float& Out) const;
+	void ReadBool(EJsonNotation Notation, bool& Out) const;
+
+	TSharedRef<TJsonReader<>> Reader;
+	FMapData& Data;
+};
@@ -2,39 +2,38 @@
 
 #include "MapDataTypes.h"
 
-ETerrainType FMapTerrainTile::GetTerrainType() const
+ETerrainType FMapTerrainTile::ParseTerrainType(const FString& TypeName)
 {
-	FString Lower = Type.ToLower();
-
-	if (Lower == TEXT("default") || Lower == TEXT("grass") || Lower == TEXT("dirt"))
+	// FString comparison is case-insensitive, so no lowered copy is needed
+	if (TypeName == TEXT("default") || TypeName == TEXT("grass") || TypeName == TEXT("dirt"))
 	{
 		return ETerrainType::Default;
 	}
-	if (Lower == TEXT("tillable") || Lower == TEXT("farmable"))
+	if (TypeName == TEXT("tillable") || TypeName == TEXT("farmable"))
 	{
 		return ETerrainType::Tillable;
 	}
-	if (Lower == TEXT("water"))
+	if (TypeName == TEXT("water"))
 	{
 		return ETerrainType::Water;
 	}
-	if (Lower == TEXT("blocked") || Lower == TEXT("wall") || Lower == TEXT("impassable"))
+	if (TypeName == TEXT("blocked") || TypeName == TEXT("wall") || TypeName == TEXT("impassable"))
 	{
 		return ETerrainType::Blocked;
 	}
-	if (Lower == TEXT("sand") || Lower == TEXT("beach"))
+	if (TypeName == TEXT("sand") || TypeName == TEXT("beach"))
 	{
 		return ETerrainType::Sand;
 	}
-	if (Lower == TEXT("stone") || Lower == TEXT("rock"))
+	if (TypeName == TEXT("stone") || TypeName == TEXT("rock"))
 	{
 		return ETerrainType::Stone;
 	}
-	if (Lower == TEXT("wood_floor") || Lower == TEXT("wood") || Lower == TEXT("floor"))
+	if (TypeName == TEXT("wood_floor") || TypeName == TEXT("wood") || TypeName == TEXT("floor"))
 	{
 		return ETerrainType::WoodFloor;
 	}
-	if (Lower == TEXT("path") || Lower == TEXT("road"))
+	if (TypeName == TEXT("path") || TypeName == TEXT("road"))
 	{
 		return ETerrainType::Path;
 	}
@@ -42,6 +41,20 @@ ETerrainType FMapTerrainTile::GetTerrainType() const
 	return ETerrainType::Default;
 }
 
+void FMapData::AddTerrainTile(int32 X, int32 Y, ETerrainType Type, TMap<FString, FString>&& Properties)
+{
+	FMapTerrainTile& Tile = Terrain.AddDefaulted_GetRef();
+	Tile.X = X;
+	Tile.Y = Y;
+	Tile.Type = Type;
+
+	if (Properties.Num() > 0)
+	{
+		Tile.PropertiesIndex = TerrainProperties.Num();
+		TerrainProperties.AddDefaulted_GetRef().Values = MoveTemp(Properties);
+	}
+}
+
 EZoneType FMapZoneData::GetZoneType() const
 {
 	FString Lower = Type.ToLower();
@@ -74,14 +87,30 @@ EZoneType FMapZoneData::GetZoneType() const
 	return EZoneType::Bounds;
 }
 
-bool FMapZoneData::ContainsPoint(int32 PX, int32 PY) const
+EZoneShape FMapZoneData::GetZoneShape() const
 {
 	if (Shape == TEXT("rect"))
+	{
+		return EZoneShape::Rect;
+	}
+	if (Shape == TEXT("polygon"))
+	{
+		return EZoneShape::Polygon;
+	}
+
+	return EZoneShape::Unknown;
+}
+
+bool FMapZoneData::ContainsPoint(int32 PX, int32 PY) const
+{
+	const EZoneShape ZoneShape = GetZoneShape();
+
+	if (ZoneShape == EZoneShape::Rect)
 	{
 		return PX >= X && PX < X + Width && PY >= Y && PY < Y + Height;
 	}
 
-	if (Shape == TEXT("polygon") && Points.Num() >= 3)
+	if (ZoneShape == EZoneShape::Polygon && Points.Num() >= 3)
 	{
 		// Point-in-polygon test using ray casting
 		bool bInside = false;
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GridTypes.h"
+#include "UObject/PropertyPortFlags.h"
 #include "MapDataTypes.generated.h"
 
 /**
@@ -20,14 +21,32 @@ struct HOBUNJIHOLLOW_API FMapTerrainTile
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
 	int32 Y = 0;
 
+	/** Terrain type, interned from the JSON type name at import */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
-	FString Type = TEXT("default");
+	ETerrainType Type = ETerrainType::Default;
 
+	/** Index into FMapData::TerrainProperties, or INDEX_NONE when the tile has no properties */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
-	TMap<FString, FString> Properties;
+	int32 PropertiesIndex = INDEX_NONE;
 
 	FGridCoordinate GetGridCoordinate() const { return FGridCoordinate(X, Y); }
-	ETerrainType GetTerrainType() const;
+	ETerrainType GetTerrainType() const { return Type; }
+
+	/** Map a JSON terrain type name (case-insensitive, with aliases) to a terrain type */
+	static ETerrainType ParseTerrainType(const FString& TypeName);
+};
+
+/**
+ * Property bag for a terrain tile that has properties.
+ * Kept out of line so the common property-less tile stays small.
+ */
+USTRUCT(BlueprintType)
+struct HOBUNJIHOLLOW_API FMapTerrainProperties
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
+	TMap<FString, FString> Values;
 };
 
 /**
@@ -127,6 +146,7 @@ struct HOBUNJIHOLLOW_API FMapZoneData
 	TMap<FString, FString> Properties;
 
 	EZoneType GetZoneType() const;
+	EZoneShape GetZoneShape() const;
 	bool ContainsPoint(int32 PX, int32 PY) const;
 };
 
@@ -459,6 +479,10 @@ struct HOBUNJIHOLLOW_API FMapData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
 	TArray<FMapTerrainTile> Terrain;
 
+	/** Out-of-line properties referenced by FMapTerrainTile::PropertiesIndex */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
+	TArray<FMapTerrainProperties> TerrainProperties;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
 	TArray<FMapObjectData> Objects;
 
@@ -477,6 +501,15 @@ struct HOBUNJIHOLLOW_API FMapData
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Map Data")
 	TArray<FMapConnectionData> Connections;
 
+	/** Append a terrain tile; properties are stored only if non-empty */
+	void AddTerrainTile(int32 X, int32 Y, ETerrainType Type, TMap<FString, FString>&& Properties);
+
+	/** Properties of a terrain tile, or nullptr if it has none */
+	const TMap<FString, FString>* GetTerrainProperties(const FMapTerrainTile& Tile) const
+	{
+		return TerrainProperties.IsValidIndex(Tile.PropertiesIndex) ? &TerrainProperties[Tile.PropertiesIndex].Values : nullptr;
+	}
+
 	/** Find a spawn point by ID */
 	const FMapConnectionData* FindSpawnPoint(const FString& SpawnId) const;
 
@@ -524,3 +557,28 @@ struct HOBUNJIHOLLOW_API FMapValidationResult
 		Warnings.Add(Warning);
 	}
 };
+
+/** Property-wise equality for map data structs, used when diffing a re-import against the previous one */
+template <typename StructType>
+bool AreMapStructsEqual(const StructType& A, const StructType& B)
+{
+	return StructType::StaticStruct()->CompareScriptStruct(&A, &B, PPF_None);
+}
+
+template <typename StructType>
+bool AreMapStructArraysEqual(const TArray<StructType>& A, const TArray<StructType>& B)
+{
+	if (A.Num() != B.Num())
+	{
+		return false;
+	}
+
+	for (int32 Index = 0; Index < A.Num(); ++Index)
+	{
+		if (!AreMapStructsEqual(A[Index], B[Index]))
+		{
+			return false;
+		}
+	}
+	return true;
+}
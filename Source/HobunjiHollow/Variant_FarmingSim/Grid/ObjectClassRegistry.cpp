@@ -8,20 +8,11 @@
 
 TSubclassOf<AActor> UObjectClassRegistry::GetClassForId(const FString& ClassId) const
 {
-	BuildCacheIfNeeded();
-
-	const TSubclassOf<AActor>* Found = ClassLookupCache.Find(ClassId.ToLower());
-	if (Found && *Found)
-	{
-		return *Found;
-	}
-
-	// Try case-insensitive search in original array (backup)
-	for (const FObjectClassEntry& Entry : ObjectClasses)
+	if (const FObjectClassEntry* Entry = FindEntry(ClassId))
 	{
-		if (Entry.ClassId.Equals(ClassId, ESearchCase::IgnoreCase))
+		if (TSubclassOf<AActor> ActorClass = ResolveEntryClass(*Entry))
 		{
-			return Entry.ActorClass;
+			return ActorClass;
 		}
 	}
 
@@ -33,6 +24,43 @@ TSubclassOf<AActor> UObjectClassRegistry::GetClassForId(const FString& ClassId)
 	return DefaultFallbackClass;
 }
 
+void UObjectClassRegistry::GetUnloadedClassPaths(const TArray<FString>& ClassIds, TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const FString& ClassId : ClassIds)
+	{
+		const FObjectClassEntry* Entry = FindEntry(ClassId);
+		if (Entry && !Entry->ActorClass && !Entry->SoftActorClass.IsNull() && !Entry->SoftActorClass.IsValid())
+		{
+			OutPaths.AddUnique(Entry->SoftActorClass.ToSoftObjectPath());
+		}
+	}
+}
+
+const FObjectClassEntry* UObjectClassRegistry::FindEntry(const FString& ClassId) const
+{
+	BuildCacheIfNeeded();
+
+	const int32* Found = ClassLookupCache.Find(ClassId.ToLower());
+	return Found && ObjectClasses.IsValidIndex(*Found) ? &ObjectClasses[*Found] : nullptr;
+}
+
+TSubclassOf<AActor> UObjectClassRegistry::ResolveEntryClass(const FObjectClassEntry& Entry)
+{
+	if (Entry.ActorClass)
+	{
+		return Entry.ActorClass;
+	}
+	if (Entry.SoftActorClass.IsNull())
+	{
+		return nullptr;
+	}
+	if (UClass* Loaded = Entry.SoftActorClass.Get())
+	{
+		return Loaded;
+	}
+	return Entry.SoftActorClass.LoadSynchronous();
+}
+
 bool UObjectClassRegistry::HasClassForId(const FString& ClassId) const
 {
 	BuildCacheIfNeeded();
@@ -60,6 +88,7 @@ void UObjectClassRegistry::RegisterClass(const FString& ClassId, TSubclassOf<AAc
 		if (Entry.ClassId.Equals(ClassId, ESearchCase::IgnoreCase))
 		{
 			Entry.ActorClass = ActorClass;
+			Entry.SoftActorClass.Reset();
 			Entry.Description = Description;
 			InvalidateCache();
 			return;
@@ -106,9 +135,9 @@ EDataValidationResult UObjectClassRegistry::IsDataValid(FDataValidationContext&
 			Result = EDataValidationResult::Invalid;
 		}
 
-		if (!Entry.ActorClass)
+		if (!Entry.ActorClass && Entry.SoftActorClass.IsNull())
 		{
-			Context.AddWarning(FText::FromString(FString::Printf(TEXT("Entry '%s' has no ActorClass assigned"), *Entry.ClassId)));
+			Context.AddWarning(FText::FromString(FString::Printf(TEXT("Entry '%s' has no ActorClass or SoftActorClass assigned"), *Entry.ClassId)));
 		}
 
 		FString LowerId = Entry.ClassId.ToLower();
@@ -133,11 +162,12 @@ void UObjectClassRegistry::BuildCacheIfNeeded() const
 
 	ClassLookupCache.Empty(ObjectClasses.Num());
 
-	for (const FObjectClassEntry& Entry : ObjectClasses)
+	for (int32 Index = 0; Index < ObjectClasses.Num(); ++Index)
 	{
-		if (!Entry.ClassId.IsEmpty())
+		const FString& ClassId = ObjectClasses[Index].ClassId;
+		if (!ClassId.IsEmpty())
 		{
-			ClassLookupCache.Add(Entry.ClassId.ToLower(), Entry.ActorClass);
+			ClassLookupCache.Add(ClassId.ToLower(), Index);
 		}
 	}
 
@@ -22,6 +22,10 @@ struct HOBUNJIHOLLOW_API FObjectClassEntry
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Class")
 	TSubclassOf<AActor> ActorClass;
 
+	/** Lazily loaded alternative to ActorClass, used when ActorClass is unset. Keeps the class out of memory until a map spawns it. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Class")
+	TSoftClassPtr<AActor> SoftActorClass;
+
 	/** Optional description for editor reference */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Object Class")
 	FString Description;
@@ -69,6 +73,12 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Object Classes")
 	TArray<FString> GetAllClassIds() const;
 
+	/**
+	 * Soft class paths for the given IDs that still need loading. Feed these to an async
+	 * load ahead of spawning so GetClassForId doesn't have to load them synchronously.
+	 */
+	void GetUnloadedClassPaths(const TArray<FString>& ClassIds, TArray<FSoftObjectPath>& OutPaths) const;
+
 	/**
 	 * Register a class at runtime (useful for mods or dynamic content)
 	 */
@@ -87,10 +97,16 @@ public:
 #endif
 
 protected:
-	/** Cached lookup map, built on first query */
-	mutable TMap<FString, TSubclassOf<AActor>> ClassLookupCache;
+	/** Cached lookup from lowercase ID to index in ObjectClasses, built on first query */
+	mutable TMap<FString, int32> ClassLookupCache;
 	mutable bool bCacheBuilt = false;
 
 	void BuildCacheIfNeeded() const;
+
+	/** Entry for an ID (case-insensitive), or nullptr */
+	const FObjectClassEntry* FindEntry(const FString& ClassId) const;
+
+	/** Hard class if set, else the soft class (loading it synchronously if nothing preloaded it) */
+	static TSubclassOf<AActor> ResolveEntryClass(const FObjectClassEntry& Entry);
 	void InvalidateCache();
 };
@@ -0,0 +1,333 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "RoadGraph.h"
+#include "Algo/Reverse.h"
+
+void FRoadGraph::Reset()
+{
+	Nodes.Empty();
+	NumJunctions = 0;
+	RoadIndexById.Empty();
+	WaypointNodes.Empty();
+	Buckets.Empty();
+	MinBucket = FIntPoint::ZeroValue;
+	MaxBucket = FIntPoint::ZeroValue;
+	RouteCache.Empty();
+}
+
+void FRoadGraph::AddEdge(int32 FromNode, int32 ToNode, float Cost)
+{
+	if (FromNode == ToNode)
+	{
+		return;
+	}
+
+	// Keep only the cheapest edge between a pair of nodes
+	for (FRoadEdge& Edge : Nodes[FromNode].Edges)
+	{
+		if (Edge.ToNode == ToNode)
+		{
+			Edge.Cost = FMath::Min(Edge.Cost, Cost);
+			return;
+		}
+	}
+	Nodes[FromNode].Edges.Add(FRoadEdge{ ToNode, Cost });
+}
+
+void FRoadGraph::Build(const TArray<FMapRoadData>& Roads)
+{
+	Reset();
+
+	// Merge waypoints at the same grid position into shared nodes
+	TMap<FIntPoint, int32> NodeByPosition;
+	WaypointNodes.SetNum(Roads.Num());
+	bool bFirstBucket = true;
+
+	for (int32 RoadIndex = 0; RoadIndex < Roads.Num(); ++RoadIndex)
+	{
+		const FMapRoadData& Road = Roads[RoadIndex];
+		if (!RoadIndexById.Contains(Road.Id))
+		{
+			RoadIndexById.Add(Road.Id, RoadIndex);
+		}
+
+		TArray<int32>& RoadNodes = WaypointNodes[RoadIndex];
+		RoadNodes.Init(INDEX_NONE, Road.Waypoints.Num());
+
+		for (int32 WaypointIndex = 0; WaypointIndex < Road.Waypoints.Num(); ++WaypointIndex)
+		{
+			const FIntPoint Position(Road.Waypoints[WaypointIndex].X, Road.Waypoints[WaypointIndex].Y);
+
+			int32 Node;
+			if (const int32* Existing = NodeByPosition.Find(Position))
+			{
+				Node = *Existing;
+			}
+			else
+			{
+				Node = Nodes.Num();
+				Nodes.AddDefaulted_GetRef().Position = Position;
+				NodeByPosition.Add(Position, Node);
+			}
+
+			// Count each road once per node, even if it loops back through it
+			if (!RoadNodes.Contains(Node))
+			{
+				++Nodes[Node].NumRoads;
+			}
+			RoadNodes[WaypointIndex] = Node;
+
+			const FIntPoint Bucket = GetBucket(Position);
+			Buckets.FindOrAdd(Bucket).Add(FWaypointEntry{ Position, RoadIndex, WaypointIndex });
+			if (bFirstBucket)
+			{
+				MinBucket = MaxBucket = Bucket;
+				bFirstBucket = false;
+			}
+			else
+			{
+				MinBucket = FIntPoint(FMath::Min(MinBucket.X, Bucket.X), FMath::Min(MinBucket.Y, Bucket.Y));
+				MaxBucket = FIntPoint(FMath::Max(MaxBucket.X, Bucket.X), FMath::Max(MaxBucket.Y, Bucket.Y));
+			}
+		}
+	}
+
+	// Road segments, weighted by travel time
+	for (int32 RoadIndex = 0; RoadIndex < Roads.Num(); ++RoadIndex)
+	{
+		const FMapRoadData& Road = Roads[RoadIndex];
+		const TArray<int32>& RoadNodes = WaypointNodes[RoadIndex];
+		const float Speed = FMath::Max(Road.SpeedMultiplier, 0.01f);
+
+		for (int32 i = 1; i < RoadNodes.Num(); ++i)
+		{
+			const FIntPoint Delta = Nodes[RoadNodes[i]].Position - Nodes[RoadNodes[i - 1]].Position;
+			const float Cost = FMath::Sqrt(static_cast<float>(Delta.X * Delta.X + Delta.Y * Delta.Y)) / Speed;
+
+			AddEdge(RoadNodes[i - 1], RoadNodes[i], Cost);
+			if (Road.bBidirectional)
+			{
+				AddEdge(RoadNodes[i], RoadNodes[i - 1], Cost);
+			}
+		}
+	}
+
+	// Declared connections that don't already meet at a junction: link the closest waypoints on foot
+	for (int32 RoadIndex = 0; RoadIndex < Roads.Num(); ++RoadIndex)
+	{
+		const TArray<int32>& RoadNodes = WaypointNodes[RoadIndex];
+
+		for (const FString& ConnectedId : Roads[RoadIndex].ConnectedRoads)
+		{
+			const int32 OtherIndex = FindRoadIndex(ConnectedId);
+			if (OtherIndex == INDEX_NONE || OtherIndex == RoadIndex)
+			{
+				continue;
+			}
+
+			const TArray<int32>& OtherNodes = WaypointNodes[OtherIndex];
+
+			int32 BestFrom = INDEX_NONE;
+			int32 BestTo = INDEX_NONE;
+			int64 BestDistSq = MAX_int64;
+			for (const int32 From : RoadNodes)
+			{
+				for (const int32 To : OtherNodes)
+				{
+					const FIntPoint Delta = Nodes[To].Position - Nodes[From].Position;
+					const int64 DistSq = static_cast<int64>(Delta.X) * Delta.X + static_cast<int64>(Delta.Y) * Delta.Y;
+					if (DistSq < BestDistSq)
+					{
+						BestDistSq = DistSq;
+						BestFrom = From;
+						BestTo = To;
+					}
+				}
+			}
+
+			if (BestFrom != INDEX_NONE && BestFrom != BestTo)
+			{
+				const float Cost = FMath::Sqrt(static_cast<float>(BestDistSq));
+				AddEdge(BestFrom, BestTo, Cost);
+				AddEdge(BestTo, BestFrom, Cost);
+			}
+		}
+	}
+
+	for (const FRoadNode& Node : Nodes)
+	{
+		NumJunctions += Node.NumRoads > 1 ? 1 : 0;
+	}
+}
+
+int32 FRoadGraph::FindRoadIndex(const FString& RoadId) const
+{
+	const int32* Index = RoadIndexById.Find(RoadId);
+	return Index ? *Index : INDEX_NONE;
+}
+
+int32 FRoadGraph::GetWaypointNode(int32 RoadIndex, int32 WaypointIndex) const
+{
+	if (!WaypointNodes.IsValidIndex(RoadIndex) || !WaypointNodes[RoadIndex].IsValidIndex(WaypointIndex))
+	{
+		return INDEX_NONE;
+	}
+	return WaypointNodes[RoadIndex][WaypointIndex];
+}
+
+bool FRoadGraph::FindNearestWaypoint(const FGridCoordinate& Position, float MaxDistance, int32& OutRoadIndex, int32& OutWaypointIndex) const
+{
+	if (Buckets.Num() == 0)
+	{
+		return false;
+	}
+
+	const FIntPoint Query(Position.X, Position.Y);
+	const FIntPoint Center = GetBucket(Query);
+
+	// Only strictly closer than MaxDistance counts, as in FindNearestRoadEntry
+	float BestDistSq = MaxDistance * MaxDistance;
+	int32 BestRoad = INDEX_NONE;
+	int32 BestWaypoint = INDEX_NONE;
+
+	const int32 MaxRing = FMath::Max(
+		FMath::Max(FMath::Abs(Center.X - MinBucket.X), FMath::Abs(MaxBucket.X - Center.X)),
+		FMath::Max(FMath::Abs(Center.Y - MinBucket.Y), FMath::Abs(MaxBucket.Y - Center.Y)));
+
+	auto VisitBucket = [&](int32 BX, int32 BY)
+	{
+		const TArray<FWaypointEntry>* Entries = Buckets.Find(FIntPoint(BX, BY));
+		if (!Entries)
+		{
+			return;
+		}
+
+		for (const FWaypointEntry& Entry : *Entries)
+		{
+			const float DX = static_cast<float>(Entry.Position.X - Query.X);
+			const float DY = static_cast<float>(Entry.Position.Y - Query.Y);
+			const float DistSq = DX * DX + DY * DY;
+
+			const bool bCloser = DistSq < BestDistSq;
+			const bool bTieEarlier = DistSq == BestDistSq && BestRoad != INDEX_NONE
+				&& (Entry.RoadIndex < BestRoad || (Entry.RoadIndex == BestRoad && Entry.WaypointIndex < BestWaypoint));
+			if (bCloser || bTieEarlier)
+			{
+				BestDistSq = DistSq;
+				BestRoad = Entry.RoadIndex;
+				BestWaypoint = Entry.WaypointIndex;
+			}
+		}
+	};
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		for (int32 BX = Center.X - Ring; BX <= Center.X + Ring; ++BX)
+		{
+			const bool bEdgeColumn = FMath::Abs(BX - Center.X) == Ring;
+			const int32 StepY = (bEdgeColumn || Ring == 0) ? 1 : Ring * 2;
+			for (int32 BY = Center.Y - Ring; BY <= Center.Y + Ring; BY += StepY)
+			{
+				VisitBucket(BX, BY);
+			}
+		}
+
+		// Waypoints outside the rings visited so far are more than Ring * BucketSize away
+		const float RingReach = static_cast<float>(Ring * BucketSize);
+		if (RingReach * RingReach >= BestDistSq)
+		{
+			break;
+		}
+	}
+
+	if (BestRoad == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutRoadIndex = BestRoad;
+	OutWaypointIndex = BestWaypoint;
+	return true;
+}
+
+bool FRoadGraph::FindRoute(int32 StartNode, int32 EndNode, TArray<int32>& OutNodes) const
+{
+	OutNodes.Reset();
+
+	if (!Nodes.IsValidIndex(StartNode) || !Nodes.IsValidIndex(EndNode))
+	{
+		return false;
+	}
+
+	const uint64 Key = (static_cast<uint64>(StartNode) << 32) | static_cast<uint32>(EndNode);
+	if (const TArray<int32>* Cached = RouteCache.Find(Key))
+	{
+		OutNodes = *Cached;
+		return OutNodes.Num() > 0;
+	}
+
+	if (RouteCache.Num() >= MaxCachedRoutes)
+	{
+		RouteCache.Reset();
+	}
+
+	// Dijkstra; road graphs are small, so plain per-call arrays are fine
+	struct FOpenEntry
+	{
+		float Cost;
+		int32 Node;
+
+		bool operator<(const FOpenEntry& Other) const { return Cost < Other.Cost; }
+	};
+
+	TArray<float> Costs;
+	Costs.Init(TNumericLimits<float>::Max(), Nodes.Num());
+	TArray<int32> Parents;
+	Parents.Init(INDEX_NONE, Nodes.Num());
+	TArray<FOpenEntry> Open;
+
+	Costs[StartNode] = 0.0f;
+	Open.HeapPush(FOpenEntry{ 0.0f, StartNode });
+
+	bool bFound = false;
+	while (Open.Num() > 0)
+	{
+		FOpenEntry Top;
+		Open.HeapPop(Top, false);
+		if (Top.Cost > Costs[Top.Node])
+		{
+			continue;
+		}
+
+		if (Top.Node == EndNode)
+		{
+			bFound = true;
+			break;
+		}
+
+		for (const FRoadEdge& Edge : Nodes[Top.Node].Edges)
+		{
+			const float NewCost = Top.Cost + Edge.Cost;
+			if (NewCost < Costs[Edge.ToNode])
+			{
+				Costs[Edge.ToNode] = NewCost;
+				Parents[Edge.ToNode] = Top.Node;
+				Open.HeapPush(FOpenEntry{ NewCost, Edge.ToNode });
+			}
+		}
+	}
+
+	// Unreachable pairs are cached too (as an empty route)
+	TArray<int32>& Route = RouteCache.Add(Key);
+	if (bFound)
+	{
+		for (int32 Node = EndNode; Node != INDEX_NONE; Node = Parents[Node])
+		{
+			Route.Add(Node);
+		}
+		Algo::Reverse(Route);
+	}
+
+	OutNodes = Route;
+	return bFound;
+}
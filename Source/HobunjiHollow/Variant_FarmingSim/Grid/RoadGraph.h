@@ -0,0 +1,96 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MapDataTypes.h"
+
+/**
+ * Compiled road network, built once per map load.
+ *
+ * Waypoints that share a grid position (across or within roads) collapse into a
+ * single junction node. Consecutive waypoints become edges costed by length divided
+ * by the road's SpeedMultiplier; one-way roads only get forward edges. Roads listed in
+ * ConnectedRoads that do not already share a junction are linked at their closest
+ * waypoint pair. Waypoints are bucketed spatially for nearest-entry lookups, and
+ * routes are cached per (start node, end node) until the next build.
+ */
+class HOBUNJIHOLLOW_API FRoadGraph
+{
+public:
+	/** Spatial bucket size in tiles */
+	static constexpr int32 BucketSize = 8;
+
+	/** Cached routes are dropped wholesale once this many are stored */
+	static constexpr int32 MaxCachedRoutes = 4096;
+
+	void Build(const TArray<FMapRoadData>& Roads);
+	void Reset();
+
+	bool IsEmpty() const { return Nodes.Num() == 0; }
+	int32 GetNumNodes() const { return Nodes.Num(); }
+	int32 GetNumJunctions() const { return NumJunctions; }
+
+	/** Index into the roads array passed to Build, or INDEX_NONE */
+	int32 FindRoadIndex(const FString& RoadId) const;
+
+	/**
+	 * Nearest waypoint within MaxDistance (grid units). Ties go to the earlier road,
+	 * then the earlier waypoint, matching a linear scan in road order.
+	 */
+	bool FindNearestWaypoint(const FGridCoordinate& Position, float MaxDistance, int32& OutRoadIndex, int32& OutWaypointIndex) const;
+
+	/** Node a waypoint was compiled into, or INDEX_NONE */
+	int32 GetWaypointNode(int32 RoadIndex, int32 WaypointIndex) const;
+
+	/** Grid position of a node */
+	FGridCoordinate GetNodePosition(int32 Node) const { return FGridCoordinate(Nodes[Node].Position.X, Nodes[Node].Position.Y); }
+
+	/** Shortest route between two nodes (both ends included), honouring one-way roads */
+	bool FindRoute(int32 StartNode, int32 EndNode, TArray<int32>& OutNodes) const;
+
+private:
+	struct FRoadEdge
+	{
+		int32 ToNode;
+		float Cost;
+	};
+
+	struct FRoadNode
+	{
+		FIntPoint Position;
+		TArray<FRoadEdge, TInlineAllocator<4>> Edges;
+
+		/** Number of distinct roads passing through this node */
+		int32 NumRoads = 0;
+	};
+
+	struct FWaypointEntry
+	{
+		FIntPoint Position;
+		int32 RoadIndex;
+		int32 WaypointIndex;
+	};
+
+	static FIntPoint GetBucket(const FIntPoint& Position)
+	{
+		return FIntPoint(FMath::FloorToInt(static_cast<float>(Position.X) / BucketSize), FMath::FloorToInt(static_cast<float>(Position.Y) / BucketSize));
+	}
+
+	void AddEdge(int32 FromNode, int32 ToNode, float Cost);
+
+	TArray<FRoadNode> Nodes;
+	int32 NumJunctions = 0;
+
+	TMap<FString, int32> RoadIndexById;
+
+	/** Per road, per waypoint node index */
+	TArray<TArray<int32>> WaypointNodes;
+
+	/** Waypoint entries grouped by bucket */
+	TMap<FIntPoint, TArray<FWaypointEntry>> Buckets;
+	FIntPoint MinBucket = FIntPoint::ZeroValue;
+	FIntPoint MaxBucket = FIntPoint::ZeroValue;
+
+	mutable TMap<uint64, TArray<int32>> RouteCache;
+};
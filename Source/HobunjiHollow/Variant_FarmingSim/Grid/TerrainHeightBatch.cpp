@@ -0,0 +1,87 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TerrainHeightBatch.h"
+#include "Engine/World.h"
+#include "Async/ParallelFor.h"
+
+FCollisionQueryParams FTerrainHeightTraceSettings::MakeQueryParams() const
+{
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(TerrainHeightBatch), bTraceComplex);
+	for (const AActor* Actor : IgnoredActors)
+	{
+		QueryParams.AddIgnoredActor(Actor);
+	}
+	return QueryParams;
+}
+
+void FTerrainHeightBatch::SampleBlocking(UWorld* World, const TArray<FVector2D>& Points, const FTerrainHeightTraceSettings& Settings, TArray<float>& OutHeights)
+{
+	OutHeights.Init(Settings.DefaultHeight, Points.Num());
+	if (!World || Points.Num() == 0)
+	{
+		return;
+	}
+
+	// Scene queries are read-only and safe to run from worker threads while the game thread waits here
+	const FCollisionQueryParams QueryParams = Settings.MakeQueryParams();
+	ParallelFor(Points.Num(), [&](int32 Index)
+	{
+		const FVector2D& Point = Points[Index];
+		const FVector Start(Point.X, Point.Y, Settings.TraceStart);
+		const FVector End(Point.X, Point.Y, Settings.TraceStart - Settings.TraceDepth);
+
+		FHitResult HitResult;
+		if (World->LineTraceSingleByChannel(HitResult, Start, End, Settings.Channel, QueryParams))
+		{
+			OutHeights[Index] = HitResult.Location.Z;
+		}
+	});
+}
+
+void FTerrainHeightBatch::SampleAsync(UWorld* World, const TArray<FVector2D>& Points, const FTerrainHeightTraceSettings& Settings, FOnHeightsSampled&& OnComplete)
+{
+	if (!World || Points.Num() == 0 || !World->IsGameWorld())
+	{
+		TArray<float> Heights;
+		SampleBlocking(World, Points, Settings, Heights);
+		OnComplete(MoveTemp(Heights));
+		return;
+	}
+
+	struct FPendingBatch
+	{
+		TArray<float> Heights;
+		int32 Remaining = 0;
+		FOnHeightsSampled OnComplete;
+	};
+
+	TSharedRef<FPendingBatch> Batch = MakeShared<FPendingBatch>();
+	Batch->Heights.Init(Settings.DefaultHeight, Points.Num());
+	Batch->Remaining = Points.Num();
+	Batch->OnComplete = MoveTemp(OnComplete);
+
+	const FCollisionQueryParams QueryParams = Settings.MakeQueryParams();
+	for (int32 Index = 0; Index < Points.Num(); ++Index)
+	{
+		const FVector2D& Point = Points[Index];
+		const FVector Start(Point.X, Point.Y, Settings.TraceStart);
+		const FVector End(Point.X, Point.Y, Settings.TraceStart - Settings.TraceDepth);
+
+		// Trace delegates are called on the game thread when the async trace queue is flushed
+		FTraceDelegate OnTraceDone = FTraceDelegate::CreateLambda([Batch, Index](const FTraceHandle& Handle, FTraceDatum& Datum)
+		{
+			if (Datum.OutHits.Num() > 0 && Datum.OutHits[0].bBlockingHit)
+			{
+				Batch->Heights[Index] = Datum.OutHits[0].Location.Z;
+			}
+
+			if (--Batch->Remaining == 0)
+			{
+				Batch->OnComplete(MoveTemp(Batch->Heights));
+			}
+		});
+
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Start, End, Settings.Channel, QueryParams,
+			FCollisionResponseParams::DefaultResponseParam, &OnTraceDone);
+	}
+}
@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "CollisionQueryParams.h"
+
+class UWorld;
+class AActor;
+
+/**
+ * Trace parameters for terrain height sampling
+ */
+struct HOBUNJIHOLLOW_API FTerrainHeightTraceSettings
+{
+	/** Height above which to start tracing down */
+	float TraceStart = 10000.0f;
+
+	/** How far down to trace */
+	float TraceDepth = 20000.0f;
+
+	/** Height reported for points where nothing was hit */
+	float DefaultHeight = 0.0f;
+
+	ECollisionChannel Channel = ECC_WorldStatic;
+	bool bTraceComplex = true;
+
+	/** Actors the traces pass through, e.g. whoever is about to replace their own collision */
+	TArray<const AActor*, TInlineAllocator<1>> IgnoredActors;
+
+	/** Query params for one trace of these settings */
+	FCollisionQueryParams MakeQueryParams() const;
+};
+
+/**
+ * Batched terrain height sampling: one vertical trace per XY point, one result array back.
+ *
+ * In game worlds the traces go through the engine's async trace queue and the callback
+ * fires on the game thread once every result is in (normally the next frame). Elsewhere
+ * (editor worlds, which don't service the async queue reliably) the traces run across
+ * worker threads and the callback fires before SampleAsync returns.
+ */
+class HOBUNJIHOLLOW_API FTerrainHeightBatch
+{
+public:
+	using FOnHeightsSampled = TFunction<void(TArray<float>&& Heights)>;
+
+	/** Trace every point across worker threads and block until done. OutHeights matches Points. */
+	static void SampleBlocking(UWorld* World, const TArray<FVector2D>& Points, const FTerrainHeightTraceSettings& Settings, TArray<float>& OutHeights);
+
+	/** Queue every point and call OnComplete once with the heights, in point order */
+	static void SampleAsync(UWorld* World, const TArray<FVector2D>& Points, const FTerrainHeightTraceSettings& Settings, FOnHeightsSampled&& OnComplete);
+};
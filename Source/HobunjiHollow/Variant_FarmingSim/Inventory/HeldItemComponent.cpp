@@ -523,16 +523,13 @@ FItemActionResult UHeldItemComponent::DoPlaceAction(AActor* Target)
 			return FItemActionResult::Failure(FText::FromString("Invalid crop class"));
 		}
 
-		// Plant the crop
-		AGridPlaceableCrop* PlantedCrop = GridManager->PlantCrop(CropSubclass, GridCoord);
+		// Plant the crop, with its type ID for saving
+		AGridPlaceableCrop* PlantedCrop = GridManager->PlantCrop(CropSubclass, GridCoord, Data->CropToPlant);
 		if (!PlantedCrop)
 		{
 			return FItemActionResult::Failure(FText::FromString("Failed to plant crop"));
 		}
 
-		// Set the crop type ID for saving
-		PlantedCrop->CropTypeId = Data->CropToPlant;
-
 		UE_LOG(LogTemp, Log, TEXT("HeldItemComponent: Planted %s at (%d, %d)"),
 			*Data->CropToPlant.ToString(), GridCoord.X, GridCoord.Y);
 
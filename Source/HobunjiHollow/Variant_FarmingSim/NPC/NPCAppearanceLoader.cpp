@@ -0,0 +1,187 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NPCAppearanceLoader.h"
+#include "NPCCharacterData.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "Algo/AllOf.h"
+
+bool UNPCAppearanceLoader::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UNPCAppearanceLoader::Deinitialize()
+{
+	for (FCacheEntry& Entry : Entries)
+	{
+		if (Entry.Handle.IsValid())
+		{
+			Entry.Handle->CancelHandle();
+		}
+	}
+	Entries.Reset();
+
+	Super::Deinitialize();
+}
+
+void UNPCAppearanceLoader::GetAppearanceAssetPaths(const UNPCCharacterData& Data, TArray<FSoftObjectPath>& OutPaths)
+{
+	if (!Data.Appearance.OverrideMesh.IsNull())
+	{
+		OutPaths.Add(Data.Appearance.OverrideMesh.ToSoftObjectPath());
+	}
+	if (!Data.Portrait.IsNull())
+	{
+		OutPaths.Add(Data.Portrait.ToSoftObjectPath());
+	}
+	for (const TPair<FString, TSoftObjectPtr<UTexture2D>>& Pair : Data.EmotionPortraits)
+	{
+		if (!Pair.Value.IsNull())
+		{
+			OutPaths.AddUnique(Pair.Value.ToSoftObjectPath());
+		}
+	}
+}
+
+void UNPCAppearanceLoader::Prefetch(const UNPCCharacterData* Data)
+{
+	if (Data)
+	{
+		Touch(Data);
+	}
+}
+
+void UNPCAppearanceLoader::RequestAppearance(const UNPCCharacterData* Data, FSimpleDelegate OnReady)
+{
+	if (!Data)
+	{
+		OnReady.ExecuteIfBound();
+		return;
+	}
+
+	FCacheEntry& Entry = Touch(Data);
+	if (Entry.bReady)
+	{
+		++NumHits;
+		OnReady.ExecuteIfBound();
+	}
+	else
+	{
+		++NumMisses;
+		Entry.Waiting.Add(MoveTemp(OnReady));
+	}
+}
+
+bool UNPCAppearanceLoader::IsAppearanceReady(const UNPCCharacterData* Data) const
+{
+	const FCacheEntry* Entry = Entries.FindByPredicate([Data](const FCacheEntry& Candidate) { return Candidate.Data.Get() == Data; });
+	return Entry && Entry->bReady;
+}
+
+UNPCAppearanceLoader::FCacheEntry& UNPCAppearanceLoader::Touch(const UNPCCharacterData* Data)
+{
+	const int32 Index = Entries.IndexOfByPredicate([Data](const FCacheEntry& Entry) { return Entry.Data.Get() == Data; });
+	if (Index != INDEX_NONE)
+	{
+		if (Index != Entries.Num() - 1)
+		{
+			FCacheEntry Entry = MoveTemp(Entries[Index]);
+			Entries.RemoveAt(Index);
+			Entries.Add(MoveTemp(Entry));
+		}
+		return Entries.Last();
+	}
+
+	// Make room first: the new entry must not be moved once its load can call back
+	EvictOverflow(FMath::Max(MaxCachedNPCs, 1) - 1);
+
+	FCacheEntry& Entry = Entries.AddDefaulted_GetRef();
+	Entry.Data = Data;
+
+	TArray<FSoftObjectPath> Paths;
+	GetAppearanceAssetPaths(*Data, Paths);
+
+	if (Paths.Num() == 0)
+	{
+		Entry.bReady = true;
+	}
+	else if (Algo::AllOf(Paths, [](const FSoftObjectPath& Path) { return Path.ResolveObject() != nullptr; }))
+	{
+		// Already resident; the handle just keeps them that way while cached
+		Entry.Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths);
+		Entry.bReady = true;
+	}
+	else
+	{
+		Entry.Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(Paths,
+			FStreamableDelegate::CreateUObject(this, &UNPCAppearanceLoader::HandleLoaded, TWeakObjectPtr<const UNPCCharacterData>(Data)));
+	}
+
+	return Entry;
+}
+
+void UNPCAppearanceLoader::HandleLoaded(TWeakObjectPtr<const UNPCCharacterData> Data)
+{
+	FCacheEntry* Entry = Entries.FindByPredicate([&Data](const FCacheEntry& Candidate) { return Candidate.Data == Data; });
+	if (!Entry)
+	{
+		return;
+	}
+
+	Entry->bReady = true;
+
+	// Callbacks may request more appearances and reshuffle the cache
+	TArray<FSimpleDelegate> Waiting = MoveTemp(Entry->Waiting);
+	Entry->Waiting.Reset();
+	for (FSimpleDelegate& Callback : Waiting)
+	{
+		Callback.ExecuteIfBound();
+	}
+
+	EvictOverflow(FMath::Max(MaxCachedNPCs, 1));
+}
+
+void UNPCAppearanceLoader::EvictOverflow(int32 MaxEntries)
+{
+	for (int32 i = 0; i < Entries.Num() && Entries.Num() > MaxEntries; )
+	{
+		FCacheEntry& Entry = Entries[i];
+
+		// Someone may be waiting on it; it becomes evictable once loaded
+		if (!Entry.bReady && Entry.Data.IsValid())
+		{
+			++i;
+			continue;
+		}
+
+		if (Entry.Handle.IsValid())
+		{
+			if (Entry.bReady)
+			{
+				Entry.Handle->ReleaseHandle();
+			}
+			else
+			{
+				Entry.Handle->CancelHandle();
+			}
+		}
+
+		Entries.RemoveAt(i);
+		++NumEvictions;
+	}
+}
+
+void UNPCAppearanceLoader::LogStats() const
+{
+	int32 NumLoading = 0;
+	for (const FCacheEntry& Entry : Entries)
+	{
+		NumLoading += Entry.bReady ? 0 : 1;
+	}
+
+	const int32 NumRequests = NumHits + NumMisses;
+	UE_LOG(LogTemp, Log, TEXT("NPCAppearanceLoader: %d/%d NPCs cached (%d loading), %d requests, %.0f%% ready on request, %d evictions"),
+		Entries.Num(), MaxCachedNPCs, NumLoading, NumRequests,
+		NumRequests > 0 ? 100.0 * NumHits / NumRequests : 0.0, NumEvictions);
+}
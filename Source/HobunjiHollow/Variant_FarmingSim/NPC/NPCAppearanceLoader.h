@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NPCAppearanceLoader.generated.h"
+
+class UNPCCharacterData;
+struct FStreamableHandle;
+
+/**
+ * World subsystem that streams NPC appearance assets (override mesh, portrait, emotion portraits)
+ * in the background and keeps them loaded for the most recently used NPCs.
+ *
+ * Each cached NPC holds one streamable handle over all of its appearance assets; once more than
+ * MaxCachedNPCs are cached the least recently used handle is released. Entries still loading are
+ * never evicted, so callbacks waiting on them always fire.
+ */
+UCLASS()
+class HOBUNJIHOLLOW_API UNPCAppearanceLoader : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Deinitialize() override;
+
+	/** NPCs whose appearance assets are kept loaded */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC|Appearance", meta = (ClampMin = "1"))
+	int32 MaxCachedNPCs = 24;
+
+	/** Start loading an NPC's appearance assets ahead of it appearing */
+	void Prefetch(const UNPCCharacterData* Data);
+
+	/**
+	 * Call OnReady once Data's appearance assets are loaded: straight away if they already are,
+	 * otherwise when the async load completes (whether or not every asset could be found).
+	 */
+	void RequestAppearance(const UNPCCharacterData* Data, FSimpleDelegate OnReady);
+
+	/** Whether Data's appearance load has finished, so a synchronous load of its assets won't stall */
+	bool IsAppearanceReady(const UNPCCharacterData* Data) const;
+
+	/** Soft assets an NPC's appearance uses */
+	static void GetAppearanceAssetPaths(const UNPCCharacterData& Data, TArray<FSoftObjectPath>& OutPaths);
+
+	/** Cache occupancy and hit rate to the log */
+	UFUNCTION(BlueprintCallable, Category = "NPC|Appearance")
+	void LogStats() const;
+
+protected:
+	struct FCacheEntry
+	{
+		TWeakObjectPtr<const UNPCCharacterData> Data;
+		TSharedPtr<FStreamableHandle> Handle;
+		bool bReady = false;
+
+		/** Callbacks for when the load completes */
+		TArray<FSimpleDelegate> Waiting;
+	};
+
+	/** Least recently used first */
+	TArray<FCacheEntry> Entries;
+
+	int32 NumHits = 0;
+	int32 NumMisses = 0;
+	int32 NumEvictions = 0;
+
+	/** Move Data's entry to the most recent end, creating it and starting its load if needed */
+	FCacheEntry& Touch(const UNPCCharacterData* Data);
+
+	void HandleLoaded(TWeakObjectPtr<const UNPCCharacterData> Data);
+
+	/** Release least recently used entries until at most MaxEntries remain */
+	void EvictOverflow(int32 MaxEntries);
+};
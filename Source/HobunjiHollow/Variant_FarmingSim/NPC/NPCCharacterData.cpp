@@ -36,167 +36,108 @@ EGiftPreference UNPCCharacterData::GetGiftPreference(const FString& ItemId) cons
 
 TArray<FNPCDialogueLine> UNPCCharacterData::GetDialogueForCategory(const FString& Category) const
 {
-	for (const FNPCDialogueSet& DialogueSet : DialogueSets)
-	{
-		if (DialogueSet.Category == Category)
-		{
-			return DialogueSet.Lines;
-		}
-	}
+	const FNPCDialogueSet* DialogueSet = FindDialogueSet(Category);
+	return DialogueSet ? DialogueSet->Lines : TArray<FNPCDialogueLine>();
+}
 
-	return TArray<FNPCDialogueLine>();
+const FNPCDialogueSet* UNPCCharacterData::FindDialogueSet(const FString& Category) const
+{
+	const int32 SetIndex = GetDialogueIndex().FindSetIndex(FName(*Category, FNAME_Find));
+	return DialogueSets.IsValidIndex(SetIndex) ? &DialogueSets[SetIndex] : nullptr;
 }
 
 bool UNPCCharacterData::GetBestDialogue(const FString& Category, int32 CurrentHearts, int32 CurrentSeason,
 	int32 CurrentDayOfWeek, const FString& CurrentWeather, const FString& CurrentLocation,
 	const TArray<FString>& ActiveFlags, FNPCDialogueLine& OutDialogue) const
 {
-	TArray<FNPCDialogueLine> CategoryLines = GetDialogueForCategory(Category);
-
-	if (CategoryLines.Num() == 0)
+	// Strings nobody interned can't match a line's condition, so FNAME_Find is enough
+	TBitArray<> Flags;
+	GetDialogueIndex().MakeFlagSet(ActiveFlags, Flags);
+
+	FNPCDialogueQuery Query;
+	Query.Hearts = CurrentHearts;
+	Query.Season = CurrentSeason;
+	Query.DayOfWeek = CurrentDayOfWeek;
+	Query.Weather = FName(*CurrentWeather, FNAME_Find);
+	Query.Location = FName(*CurrentLocation, FNAME_Find);
+	Query.Flags = &Flags;
+
+	const FNPCDialogueLine* Line = SelectDialogue(FName(*Category, FNAME_Find), Query);
+	if (!Line)
 	{
 		return false;
 	}
 
-	// Find all matching lines
-	TArray<const FNPCDialogueLine*> MatchingLines;
-	int32 HighestPriority = TNumericLimits<int32>::Min();
+	OutDialogue = *Line;
+	return true;
+}
 
-	for (const FNPCDialogueLine& Line : CategoryLines)
+const FNPCDialogueLine* UNPCCharacterData::SelectDialogue(FName Category, const FNPCDialogueQuery& Query) const
+{
+	const FNPCDialogueIndex& Index = GetDialogueIndex();
+	const int32 LineIndex = Index.SelectLine(Category, Query);
+	if (LineIndex == INDEX_NONE)
 	{
-		// Check heart requirements
-		if (Line.MinHearts > 0 && CurrentHearts < Line.MinHearts)
-		{
-			continue;
-		}
-		if (Line.MaxHearts > 0 && CurrentHearts > Line.MaxHearts)
-		{
-			continue;
-		}
-
-		// Check season
-		if (Line.Season >= 0 && Line.Season != CurrentSeason)
-		{
-			continue;
-		}
-
-		// Check day of week
-		if (Line.DayOfWeek >= 0 && Line.DayOfWeek != CurrentDayOfWeek)
-		{
-			continue;
-		}
-
-		// Check weather
-		if (!Line.Weather.IsEmpty() && Line.Weather != CurrentWeather)
-		{
-			continue;
-		}
-
-		// Check location
-		if (!Line.Location.IsEmpty() && Line.Location != CurrentLocation)
-		{
-			continue;
-		}
-
-		// Check required flag
-		if (!Line.RequiredFlag.IsEmpty() && !ActiveFlags.Contains(Line.RequiredFlag))
-		{
-			continue;
-		}
-
-		// Check blocking flag
-		if (!Line.BlockingFlag.IsEmpty() && ActiveFlags.Contains(Line.BlockingFlag))
-		{
-			continue;
-		}
-
-		// Line matches all conditions
-		if (Line.Priority > HighestPriority)
-		{
-			HighestPriority = Line.Priority;
-			MatchingLines.Empty();
-			MatchingLines.Add(&Line);
-		}
-		else if (Line.Priority == HighestPriority)
-		{
-			MatchingLines.Add(&Line);
-		}
+		return nullptr;
 	}
 
-	if (MatchingLines.Num() == 0)
+	return &DialogueSets[Index.FindSetIndex(Category)].Lines[LineIndex];
+}
+
+const FNPCDialogueIndex& UNPCCharacterData::GetDialogueIndex() const
+{
+	if (!DialogueIndex.IsBuilt())
 	{
-		return false;
+		DialogueIndex.Build(DialogueSets);
 	}
+	return DialogueIndex;
+}
 
-	// Pick a random line from highest priority matches
-	int32 RandomIndex = FMath::RandRange(0, MatchingLines.Num() - 1);
-	OutDialogue = *MatchingLines[RandomIndex];
-	return true;
+void UNPCCharacterData::PostLoad()
+{
+	Super::PostLoad();
+	DialogueIndex.Build(DialogueSets);
+	ScheduleIndex.Build(Schedule);
+}
+
+#if WITH_EDITOR
+void UNPCCharacterData::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+	DialogueIndex.Reset();
+	ScheduleIndex.Reset();
 }
+#endif
 
 bool UNPCCharacterData::GetScheduleSlotForTime(float CurrentTime, int32 CurrentSeason, int32 CurrentDayOfWeek,
 	const FString& CurrentWeather, FNPCScheduleSlot& OutSlot) const
 {
-	const FNPCScheduleSlot* BestSlot = nullptr;
-	int32 BestSpecificity = -1;
+	const int32 SlotIndex = GetScheduleIndex().FindSlot(CurrentTime, CurrentSeason, CurrentDayOfWeek,
+		FName(*CurrentWeather, FNAME_Find));
 
-	for (const FNPCScheduleSlot& Slot : Schedule)
+	if (!Schedule.IsValidIndex(SlotIndex))
 	{
-		// Check if time falls within this slot
-		bool bTimeMatches = false;
-		if (Slot.StartTime <= Slot.EndTime)
-		{
-			bTimeMatches = (CurrentTime >= Slot.StartTime && CurrentTime < Slot.EndTime);
-		}
-		else
-		{
-			// Wraps around midnight
-			bTimeMatches = (CurrentTime >= Slot.StartTime || CurrentTime < Slot.EndTime);
-		}
-
-		if (!bTimeMatches)
-		{
-			continue;
-		}
-
-		// Check season
-		if (Slot.Season >= 0 && Slot.Season != CurrentSeason)
-		{
-			continue;
-		}
-
-		// Check day of week
-		if (Slot.DayOfWeek >= 0 && Slot.DayOfWeek != CurrentDayOfWeek)
-		{
-			continue;
-		}
-
-		// Check weather
-		if (!Slot.Weather.IsEmpty() && Slot.Weather != CurrentWeather)
-		{
-			continue;
-		}
+		return false;
+	}
 
-		// Calculate specificity (more specific = higher priority)
-		int32 Specificity = 0;
-		if (Slot.Season >= 0) Specificity += 100;
-		if (Slot.DayOfWeek >= 0) Specificity += 10;
-		if (!Slot.Weather.IsEmpty()) Specificity += 1;
+	OutSlot = Schedule[SlotIndex];
+	return true;
+}
 
-		if (Specificity > BestSpecificity)
-		{
-			BestSpecificity = Specificity;
-			BestSlot = &Slot;
-		}
-	}
+float UNPCCharacterData::GetNextScheduleTransition(float CurrentTime, int32 CurrentSeason, int32 CurrentDayOfWeek,
+	const FString& CurrentWeather) const
+{
+	return GetScheduleIndex().GetNextTransition(CurrentTime, CurrentSeason, CurrentDayOfWeek,
+		FName(*CurrentWeather, FNAME_Find));
+}
 
-	if (BestSlot)
+const FNPCScheduleIndex& UNPCCharacterData::GetScheduleIndex() const
+{
+	if (!ScheduleIndex.IsBuilt())
 	{
-		OutSlot = *BestSlot;
-		return true;
+		ScheduleIndex.Build(Schedule);
 	}
-
-	return false;
+	return ScheduleIndex;
 }
 
 FString UNPCCharacterData::GetSeasonName(int32 SeasonIndex)
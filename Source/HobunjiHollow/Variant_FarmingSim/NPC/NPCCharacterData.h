@@ -6,6 +6,8 @@
 #include "Engine/DataAsset.h"
 #include "Grid/GridTypes.h"
 #include "Data/SpeciesDatabase.h"
+#include "NPCDialogueIndex.h"
+#include "NPCScheduleIndex.h"
 #include "NPCCharacterData.generated.h"
 
 class USkeletalMesh;
@@ -544,18 +546,60 @@ public:
 	UFUNCTION(BlueprintPure, Category = "NPC Data")
 	TArray<FNPCDialogueLine> GetDialogueForCategory(const FString& Category) const;
 
+	/** Dialogue set for a category without copying it, or null */
+	const FNPCDialogueSet* FindDialogueSet(const FString& Category) const;
+
 	/** Get best matching dialogue line based on current conditions */
 	UFUNCTION(BlueprintPure, Category = "NPC Data")
 	bool GetBestDialogue(const FString& Category, int32 CurrentHearts, int32 CurrentSeason,
 		int32 CurrentDayOfWeek, const FString& CurrentWeather, const FString& CurrentLocation,
 		const TArray<FString>& ActiveFlags, FNPCDialogueLine& OutDialogue) const;
 
+	/**
+	 * Best matching line for a query already in the dialogue index's form (see GetDialogueIndex).
+	 * Allocation-free; callers picking lines often can keep the flag set between calls.
+	 */
+	const FNPCDialogueLine* SelectDialogue(FName Category, const FNPCDialogueQuery& Query) const;
+
+	/** Compiled form of DialogueSets, built on load or first use */
+	const FNPCDialogueIndex& GetDialogueIndex() const;
+
+	/** Recompile the dialogue index; call after changing DialogueSets at runtime */
+	void InvalidateDialogueIndex() { DialogueIndex.Reset(); }
+
 	/** Get current schedule slot for the given time */
 	UFUNCTION(BlueprintPure, Category = "NPC Data")
 	bool GetScheduleSlotForTime(float CurrentTime, int32 CurrentSeason, int32 CurrentDayOfWeek,
 		const FString& CurrentWeather, FNPCScheduleSlot& OutSlot) const;
 
+	/**
+	 * Time of day (hours) at which the schedule slot next changes after CurrentTime, or 24 if the
+	 * current one lasts until midnight. Lets a schedule driver sleep until then instead of polling.
+	 */
+	UFUNCTION(BlueprintPure, Category = "NPC Data")
+	float GetNextScheduleTransition(float CurrentTime, int32 CurrentSeason, int32 CurrentDayOfWeek,
+		const FString& CurrentWeather) const;
+
+	/** Compiled form of Schedule, built on load or first use */
+	const FNPCScheduleIndex& GetScheduleIndex() const;
+
+	/** Recompile the schedule index; call after changing Schedule at runtime */
+	void InvalidateScheduleIndex() { ScheduleIndex.Reset(); }
+
 	/** Get season name from index */
 	UFUNCTION(BlueprintPure, Category = "NPC Data")
 	static FString GetSeasonName(int32 SeasonIndex);
+
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+protected:
+	/** DialogueSets bucketed by category, season and day for selection */
+	mutable FNPCDialogueIndex DialogueIndex;
+
+	/** Schedule resolved into per season/weekday/weather timelines */
+	mutable FNPCScheduleIndex ScheduleIndex;
 };
@@ -3,6 +3,7 @@
 #include "NPCDataComponent.h"
 #include "NPCDataRegistry.h"
 #include "NPCScheduleComponent.h"
+#include "NPCAppearanceLoader.h"
 #include "Data/SpeciesDatabase.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/Character.h"
@@ -202,7 +203,29 @@ void UNPCDataComponent::ApplyAppearanceToMesh(USkeletalMeshComponent* MeshCompon
 		Appearance.Gender == ECharacterGender::Male ? TEXT("Male") : TEXT("Female"),
 		Appearance.OverrideMesh.IsNull() ? TEXT("Null") : TEXT("Set"));
 
-	// Try override mesh first
+	// Override mesh not resident yet: stream the NPC's appearance in and apply it once it's there,
+	// rather than stalling the spawn on a synchronous load
+	if (!Appearance.OverrideMesh.IsNull() && !Appearance.OverrideMesh.Get())
+	{
+		UWorld* World = GetWorld();
+		UNPCAppearanceLoader* AppearanceLoader = World ? World->GetSubsystem<UNPCAppearanceLoader>() : nullptr;
+		if (AppearanceLoader && !AppearanceLoader->IsAppearanceReady(LoadedData))
+		{
+			UE_LOG(LogTemp, Log, TEXT("NPCDataComponent '%s': Override mesh not loaded, applying appearance after async load"), *NPCId);
+
+			TWeakObjectPtr<USkeletalMeshComponent> WeakMeshComponent(MeshComponent);
+			AppearanceLoader->RequestAppearance(LoadedData, FSimpleDelegate::CreateWeakLambda(this, [this, WeakMeshComponent]()
+			{
+				if (USkeletalMeshComponent* LoadedMeshComponent = WeakMeshComponent.Get())
+				{
+					ApplyAppearanceToMesh(LoadedMeshComponent);
+				}
+			}));
+			return;
+		}
+	}
+
+	// Try override mesh first (already loaded unless there is no appearance loader)
 	if (!Appearance.OverrideMesh.IsNull())
 	{
 		MeshToApply = Appearance.OverrideMesh.LoadSynchronous();
@@ -481,6 +504,12 @@ bool UNPCDataComponent::GetCurrentScheduleSlot(float CurrentTime, int32 Season,
 	return LoadedData->GetScheduleSlotForTime(CurrentTime, Season, DayOfWeek, Weather, OutSlot);
 }
 
+float UNPCDataComponent::GetNextScheduleTransition(float CurrentTime, int32 Season, int32 DayOfWeek,
+	const FString& Weather) const
+{
+	return LoadedData ? LoadedData->GetNextScheduleTransition(CurrentTime, Season, DayOfWeek, Weather) : 24.0f;
+}
+
 void UNPCDataComponent::SetFlag(const FString& FlagName)
 {
 	if (!TriggeredFlags.Contains(FlagName))
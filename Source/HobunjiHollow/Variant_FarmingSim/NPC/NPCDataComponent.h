@@ -192,6 +192,10 @@ public:
 	bool GetCurrentScheduleSlot(float CurrentTime, int32 Season, int32 DayOfWeek,
 		const FString& Weather, FNPCScheduleSlot& OutSlot) const;
 
+	/** Time of day the current schedule slot ends (24 if it runs to midnight) */
+	UFUNCTION(BlueprintPure, Category = "NPC Data|Schedule")
+	float GetNextScheduleTransition(float CurrentTime, int32 Season, int32 DayOfWeek, const FString& Weather) const;
+
 	// ---- Events/Flags ----
 
 	/** Set a flag */
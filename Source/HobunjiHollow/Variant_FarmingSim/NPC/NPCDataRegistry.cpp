@@ -15,66 +15,75 @@ UNPCCharacterData* UNPCDataRegistry::GetNPCData(const FString& NPCId) const
 
 TArray<FString> UNPCDataRegistry::GetAllNPCIds() const
 {
-	TArray<FString> Result;
-	for (UNPCCharacterData* Data : NPCDataAssets)
+	return TArray<FString>(GetAllNPCIdsView());
+}
+
+TArray<UNPCCharacterData*> UNPCDataRegistry::GetNPCsByOccupation(const FString& Occupation) const
+{
+	return TArray<UNPCCharacterData*>(GetNPCsByOccupationView(Occupation));
+}
+
+TArray<UNPCCharacterData*> UNPCDataRegistry::GetRomanceableNPCs() const
+{
+	return TArray<UNPCCharacterData*>(GetRomanceableNPCsView());
+}
+
+TArray<UNPCCharacterData*> UNPCDataRegistry::GetNPCsWithBirthdayInSeason(int32 Season) const
+{
+	return TArray<UNPCCharacterData*>(GetNPCsWithBirthdayInSeasonView(Season));
+}
+
+UNPCCharacterData* UNPCDataRegistry::GetNPCWithBirthday(int32 Season, int32 Day) const
+{
+	if (!bCacheValid)
 	{
-		if (Data)
-		{
-			Result.Add(Data->NPCId);
-		}
+		RebuildCache();
 	}
-	return Result;
+
+	UNPCCharacterData* const* Found = CachedByBirthday.Find(FIntPoint(Season, Day));
+	return Found ? *Found : nullptr;
 }
 
-TArray<UNPCCharacterData*> UNPCDataRegistry::GetNPCsByOccupation(const FString& Occupation) const
+TConstArrayView<FString> UNPCDataRegistry::GetAllNPCIdsView() const
 {
-	TArray<UNPCCharacterData*> Result;
-	for (UNPCCharacterData* Data : NPCDataAssets)
+	if (!bCacheValid)
 	{
-		if (Data && Data->Occupation == Occupation)
-		{
-			Result.Add(Data);
-		}
+		RebuildCache();
 	}
-	return Result;
+
+	return CachedIds;
 }
 
-TArray<UNPCCharacterData*> UNPCDataRegistry::GetRomanceableNPCs() const
+TConstArrayView<UNPCCharacterData*> UNPCDataRegistry::GetNPCsByOccupationView(const FString& Occupation) const
 {
-	TArray<UNPCCharacterData*> Result;
-	for (UNPCCharacterData* Data : NPCDataAssets)
+	if (!bCacheValid)
 	{
-		if (Data && Data->RelationshipConfig.bIsRomanceable)
-		{
-			Result.Add(Data);
-		}
+		RebuildCache();
 	}
-	return Result;
+
+	const TArray<UNPCCharacterData*>* Found = CachedByOccupation.Find(Occupation);
+	return Found ? TConstArrayView<UNPCCharacterData*>(*Found) : TConstArrayView<UNPCCharacterData*>();
 }
 
-TArray<UNPCCharacterData*> UNPCDataRegistry::GetNPCsWithBirthdayInSeason(int32 Season) const
+TConstArrayView<UNPCCharacterData*> UNPCDataRegistry::GetRomanceableNPCsView() const
 {
-	TArray<UNPCCharacterData*> Result;
-	for (UNPCCharacterData* Data : NPCDataAssets)
+	if (!bCacheValid)
 	{
-		if (Data && Data->Birthday.Season == Season)
-		{
-			Result.Add(Data);
-		}
+		RebuildCache();
 	}
-	return Result;
+
+	return CachedRomanceable;
 }
 
-UNPCCharacterData* UNPCDataRegistry::GetNPCWithBirthday(int32 Season, int32 Day) const
+TConstArrayView<UNPCCharacterData*> UNPCDataRegistry::GetNPCsWithBirthdayInSeasonView(int32 Season) const
 {
-	for (UNPCCharacterData* Data : NPCDataAssets)
+	if (!bCacheValid)
 	{
-		if (Data && Data->Birthday.Season == Season && Data->Birthday.Day == Day)
-		{
-			return Data;
-		}
+		RebuildCache();
 	}
-	return nullptr;
+
+	const TArray<UNPCCharacterData*>* Found = CachedByBirthdaySeason.Find(Season);
+	return Found ? TConstArrayView<UNPCCharacterData*>(*Found) : TConstArrayView<UNPCCharacterData*>();
 }
 
 bool UNPCDataRegistry::HasNPC(const FString& NPCId) const
@@ -85,13 +94,37 @@ bool UNPCDataRegistry::HasNPC(const FString& NPCId) const
 void UNPCDataRegistry::RebuildCache() const
 {
 	CachedLookup.Empty();
+	CachedIds.Reset();
+	CachedByOccupation.Empty();
+	CachedRomanceable.Reset();
+	CachedByBirthdaySeason.Empty();
+	CachedByBirthday.Empty();
+
 	for (UNPCCharacterData* Data : NPCDataAssets)
 	{
-		if (Data && !Data->NPCId.IsEmpty())
+		if (!Data)
+		{
+			continue;
+		}
+
+		if (!Data->NPCId.IsEmpty())
 		{
 			CachedLookup.Add(Data->NPCId, Data);
 		}
+
+		CachedIds.Add(Data->NPCId);
+		CachedByOccupation.FindOrAdd(Data->Occupation).Add(Data);
+		CachedByBirthdaySeason.FindOrAdd(Data->Birthday.Season).Add(Data);
+
+		if (Data->RelationshipConfig.bIsRomanceable)
+		{
+			CachedRomanceable.Add(Data);
+		}
+
+		// First NPC in the list wins a shared birthday, as the linear search did
+		CachedByBirthday.FindOrAdd(FIntPoint(Data->Birthday.Season, Data->Birthday.Day), Data);
 	}
+
 	bCacheValid = true;
 }
 
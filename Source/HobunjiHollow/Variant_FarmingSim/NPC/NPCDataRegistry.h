@@ -53,6 +53,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "NPCs")
 	int32 GetNPCCount() const { return NPCDataAssets.Num(); }
 
+	// ---- Indexed Views ----
+	// Same results as the Blueprint queries above, straight from the cached indices without
+	// copying. Views stay valid until the registry's cache is rebuilt.
+
+	TConstArrayView<FString> GetAllNPCIdsView() const;
+	TConstArrayView<UNPCCharacterData*> GetNPCsByOccupationView(const FString& Occupation) const;
+	TConstArrayView<UNPCCharacterData*> GetRomanceableNPCsView() const;
+	TConstArrayView<UNPCCharacterData*> GetNPCsWithBirthdayInSeasonView(int32 Season) const;
+
+	/** Drop the cached lookup and indices; call after changing NPCDataAssets at runtime */
+	void InvalidateCache() { bCacheValid = false; }
+
 #if WITH_EDITOR
 	/** Validate all NPC data in editor */
 	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
@@ -63,6 +75,15 @@ protected:
 	mutable TMap<FString, UNPCCharacterData*> CachedLookup;
 	mutable bool bCacheValid = false;
 
+	/** Secondary indices, built with CachedLookup; lists keep NPCDataAssets order */
+	mutable TArray<FString> CachedIds;
+	mutable TMap<FString, TArray<UNPCCharacterData*>> CachedByOccupation;
+	mutable TArray<UNPCCharacterData*> CachedRomanceable;
+	mutable TMap<int32, TArray<UNPCCharacterData*>> CachedByBirthdaySeason;
+
+	/** (Season, Day) -> first NPC with that birthday */
+	mutable TMap<FIntPoint, UNPCCharacterData*> CachedByBirthday;
+
 	/** Rebuild the lookup cache */
 	void RebuildCache() const;
 };
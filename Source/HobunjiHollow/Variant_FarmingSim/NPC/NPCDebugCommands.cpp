@@ -4,12 +4,63 @@
 #include "NPCScheduleComponent.h"
 #include "NPCScheduleDebugComponent.h"
 #include "NPCDataComponent.h"
+#include "NPCSignificanceManager.h"
+#include "NPCAppearanceLoader.h"
+#include "NPCCharacterData.h"
 #include "FarmingTimeManager.h"
 #include "Grid/FarmGridManager.h"
 #include "Kismet/GameplayStatics.h"
 #include "NavigationSystem.h"
 #include "EngineUtils.h"
 
+namespace
+{
+	/** Dialogue selection as it was before the dialogue index, kept as the benchmark baseline */
+	const FNPCDialogueLine* SelectDialogueLinear(const UNPCCharacterData& Data, const FString& Category, int32 CurrentHearts,
+		int32 CurrentSeason, int32 CurrentDayOfWeek, const FString& CurrentWeather, const FString& CurrentLocation,
+		const TArray<FString>& ActiveFlags)
+	{
+		TArray<FNPCDialogueLine> CategoryLines = Data.GetDialogueForCategory(Category);
+
+		TArray<const FNPCDialogueLine*> MatchingLines;
+		int32 HighestPriority = TNumericLimits<int32>::Min();
+
+		for (const FNPCDialogueLine& Line : CategoryLines)
+		{
+			if ((Line.MinHearts > 0 && CurrentHearts < Line.MinHearts)
+				|| (Line.MaxHearts > 0 && CurrentHearts > Line.MaxHearts)
+				|| (Line.Season >= 0 && Line.Season != CurrentSeason)
+				|| (Line.DayOfWeek >= 0 && Line.DayOfWeek != CurrentDayOfWeek)
+				|| (!Line.Weather.IsEmpty() && Line.Weather != CurrentWeather)
+				|| (!Line.Location.IsEmpty() && Line.Location != CurrentLocation)
+				|| (!Line.RequiredFlag.IsEmpty() && !ActiveFlags.Contains(Line.RequiredFlag))
+				|| (!Line.BlockingFlag.IsEmpty() && ActiveFlags.Contains(Line.BlockingFlag)))
+			{
+				continue;
+			}
+
+			if (Line.Priority > HighestPriority)
+			{
+				HighestPriority = Line.Priority;
+				MatchingLines.Reset();
+				MatchingLines.Add(&Line);
+			}
+			else if (Line.Priority == HighestPriority)
+			{
+				MatchingLines.Add(&Line);
+			}
+		}
+
+		if (MatchingLines.Num() == 0)
+		{
+			return nullptr;
+		}
+
+		// Points into the copy, so only good for reading the priority straight away
+		return MatchingLines[FMath::RandRange(0, MatchingLines.Num() - 1)];
+	}
+}
+
 void UNPCDebugCommands::ValidateAllNPCSchedules(UObject* WorldContextObject)
 {
 	UNPCScheduleDebugComponent::ValidateAllNPCs(WorldContextObject);
@@ -453,3 +504,171 @@ void UNPCDebugCommands::ForceScheduleUpdate(UObject* WorldContextObject)
 
 	UE_LOG(LogTemp, Log, TEXT("Forced schedule update for %d NPCs"), Count);
 }
+
+void UNPCDebugCommands::LogNPCSignificance(UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UNPCSignificanceManager* SignificanceManager = World ? World->GetSubsystem<UNPCSignificanceManager>() : nullptr;
+	if (!SignificanceManager)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No NPCSignificanceManager in this world"));
+		return;
+	}
+
+	SignificanceManager->LogStats();
+}
+
+void UNPCDebugCommands::LogNPCAppearanceCache(UObject* WorldContextObject)
+{
+	UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UNPCAppearanceLoader* AppearanceLoader = World ? World->GetSubsystem<UNPCAppearanceLoader>() : nullptr;
+	if (!AppearanceLoader)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("No NPCAppearanceLoader in this world"));
+		return;
+	}
+
+	AppearanceLoader->LogStats();
+}
+
+void UNPCDebugCommands::BenchmarkDialogueSelection(int32 NumLines, int32 NumQueries)
+{
+	NumLines = FMath::Max(NumLines, 1);
+	NumQueries = FMath::Max(NumQueries, 1);
+
+	static const TCHAR* Weathers[] = { TEXT("Sunny"), TEXT("Rain"), TEXT("Storm"), TEXT("Snow") };
+	static const TCHAR* Locations[] = { TEXT("Town"), TEXT("Beach"), TEXT("Farm"), TEXT("Forest"), TEXT("Saloon") };
+	constexpr int32 NumFlags = 64;
+
+	FRandomStream Random(NumLines);
+
+	// A big greeting set with the mix of conditions authored dialogue tends to have, plus a few
+	// small categories so the lookup isn't trivially the only entry
+	UNPCCharacterData* Data = NewObject<UNPCCharacterData>(GetTransientPackage());
+	for (const TCHAR* Category : { TEXT("farewell"), TEXT("gift_loved"), TEXT("greeting"), TEXT("rain") })
+	{
+		FNPCDialogueSet& Set = Data->DialogueSets.AddDefaulted_GetRef();
+		Set.Category = Category;
+
+		const int32 Count = Set.Category == TEXT("greeting") ? NumLines : 20;
+		for (int32 i = 0; i < Count; ++i)
+		{
+			FNPCDialogueLine& Line = Set.Lines.AddDefaulted_GetRef();
+			Line.Text = FText::AsCultureInvariant(FString::Printf(TEXT("%s %d"), Category, i));
+			Line.MinHearts = Random.FRand() < 0.3f ? Random.RandRange(1, 8) : 0;
+			Line.MaxHearts = Random.FRand() < 0.1f ? Random.RandRange(Line.MinHearts + 1, 10) : 0;
+			Line.Season = Random.FRand() < 0.5f ? Random.RandRange(0, 3) : -1;
+			Line.DayOfWeek = Random.FRand() < 0.3f ? Random.RandRange(0, 6) : -1;
+			Line.Weather = Random.FRand() < 0.25f ? Weathers[Random.RandRange(0, UE_ARRAY_COUNT(Weathers) - 1)] : TEXT("");
+			Line.Location = Random.FRand() < 0.25f ? Locations[Random.RandRange(0, UE_ARRAY_COUNT(Locations) - 1)] : TEXT("");
+			Line.RequiredFlag = Random.FRand() < 0.2f ? FString::Printf(TEXT("flag_%d"), Random.RandRange(0, NumFlags - 1)) : FString();
+			Line.BlockingFlag = Random.FRand() < 0.1f ? FString::Printf(TEXT("flag_%d"), Random.RandRange(0, NumFlags - 1)) : FString();
+			Line.Priority = Random.RandRange(0, 3);
+		}
+	}
+
+	struct FQuery
+	{
+		int32 Hearts;
+		int32 Season;
+		int32 DayOfWeek;
+		FString Weather;
+		FString Location;
+		TArray<FString> Flags;
+	};
+
+	TArray<FQuery> Queries;
+	Queries.SetNum(FMath::Min(NumQueries, 4096));
+	for (FQuery& Query : Queries)
+	{
+		Query.Hearts = Random.RandRange(0, 10);
+		Query.Season = Random.RandRange(0, 3);
+		Query.DayOfWeek = Random.RandRange(0, 6);
+		Query.Weather = Weathers[Random.RandRange(0, UE_ARRAY_COUNT(Weathers) - 1)];
+		Query.Location = Locations[Random.RandRange(0, UE_ARRAY_COUNT(Locations) - 1)];
+		for (int32 i = Random.RandRange(0, 12); i > 0; --i)
+		{
+			Query.Flags.Add(FString::Printf(TEXT("flag_%d"), Random.RandRange(0, NumFlags - 1)));
+		}
+	}
+
+	const FString Category = TEXT("greeting");
+
+	double StartTime = FPlatformTime::Seconds();
+	const FNPCDialogueIndex& Index = Data->GetDialogueIndex();
+	const double BuildSeconds = FPlatformTime::Seconds() - StartTime;
+
+	// Old path: copy the category, FString compares, linear flag search
+	int32 LinearFound = 0;
+	int64 LinearPrioritySum = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		const FQuery& Query = Queries[i % Queries.Num()];
+		if (const FNPCDialogueLine* Line = SelectDialogueLinear(*Data, Category, Query.Hearts, Query.Season,
+			Query.DayOfWeek, Query.Weather, Query.Location, Query.Flags))
+		{
+			++LinearFound;
+			LinearPrioritySum += Line->Priority;
+		}
+	}
+	const double LinearSeconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-9);
+
+	// GetBestDialogue: same strings in, interned per call
+	int32 IndexedFound = 0;
+	int64 IndexedPrioritySum = 0;
+	FNPCDialogueLine Out;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		const FQuery& Query = Queries[i % Queries.Num()];
+		if (Data->GetBestDialogue(Category, Query.Hearts, Query.Season, Query.DayOfWeek,
+			Query.Weather, Query.Location, Query.Flags, Out))
+		{
+			++IndexedFound;
+			IndexedPrioritySum += Out.Priority;
+		}
+	}
+	const double IndexedSeconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-9);
+
+	// SelectDialogue with the queries already interned, as a caller holding its flag set would
+	TArray<TBitArray<>> FlagSets;
+	TArray<FNPCDialogueQuery> Compiled;
+	FlagSets.SetNum(Queries.Num());
+	Compiled.SetNum(Queries.Num());
+	for (int32 i = 0; i < Queries.Num(); ++i)
+	{
+		Index.MakeFlagSet(Queries[i].Flags, FlagSets[i]);
+		Compiled[i].Hearts = Queries[i].Hearts;
+		Compiled[i].Season = Queries[i].Season;
+		Compiled[i].DayOfWeek = Queries[i].DayOfWeek;
+		Compiled[i].Weather = FName(*Queries[i].Weather, FNAME_Find);
+		Compiled[i].Location = FName(*Queries[i].Location, FNAME_Find);
+		Compiled[i].Flags = &FlagSets[i];
+	}
+
+	const FName CategoryName(*Category);
+	int32 PreparedFound = 0;
+	StartTime = FPlatformTime::Seconds();
+	for (int32 i = 0; i < NumQueries; ++i)
+	{
+		PreparedFound += Data->SelectDialogue(CategoryName, Compiled[i % Compiled.Num()]) ? 1 : 0;
+	}
+	const double PreparedSeconds = FMath::Max(FPlatformTime::Seconds() - StartTime, 1e-9);
+
+	UE_LOG(LogTemp, Log, TEXT("========== DIALOGUE SELECTION BENCHMARK (%d lines, %d queries) =========="), NumLines, NumQueries);
+	UE_LOG(LogTemp, Log, TEXT("Index: built in %.3f ms, %d categories, %d flags, %.1f KB"),
+		BuildSeconds * 1000.0, Index.GetNumCategories(), Index.GetNumFlags(), Index.GetAllocatedSize() / 1024.0);
+	UE_LOG(LogTemp, Log, TEXT("Linear:          %.0f ns/query, %d matched"), LinearSeconds * 1e9 / NumQueries, LinearFound);
+	UE_LOG(LogTemp, Log, TEXT("GetBestDialogue: %.0f ns/query, %d matched (%.1fx)"),
+		IndexedSeconds * 1e9 / NumQueries, IndexedFound, LinearSeconds / IndexedSeconds);
+	UE_LOG(LogTemp, Log, TEXT("SelectDialogue:  %.0f ns/query, %d matched (%.1fx)"),
+		PreparedSeconds * 1e9 / NumQueries, PreparedFound, LinearSeconds / PreparedSeconds);
+
+	// Ties are picked at random, but the winning priority and whether anything matched must agree
+	if (LinearFound != IndexedFound || LinearPrioritySum != IndexedPrioritySum)
+	{
+		UE_LOG(LogTemp, Error, TEXT("Dialogue index disagrees with the linear scan: %d/%lld vs %d/%lld matches/priority sum"),
+			LinearFound, LinearPrioritySum, IndexedFound, IndexedPrioritySum);
+	}
+}
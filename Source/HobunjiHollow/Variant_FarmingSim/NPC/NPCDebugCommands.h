@@ -79,4 +79,23 @@ public:
 	 */
 	UFUNCTION(BlueprintCallable, Category = "NPC Debug", meta = (WorldContext = "WorldContextObject"))
 	static void ForceScheduleUpdate(UObject* WorldContextObject);
+
+	/**
+	 * Log how many NPCs are in each significance bucket (near / mid / far).
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NPC Debug", meta = (WorldContext = "WorldContextObject"))
+	static void LogNPCSignificance(UObject* WorldContextObject);
+
+	/**
+	 * Log the NPC appearance cache: NPCs cached, loads in flight, hit rate and evictions.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NPC Debug", meta = (WorldContext = "WorldContextObject"))
+	static void LogNPCAppearanceCache(UObject* WorldContextObject);
+
+	/**
+	 * Time dialogue selection on a synthetic NPC with NumLines greeting lines: the old linear
+	 * FString scan against the compiled dialogue index. Results go to the log.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "NPC Debug")
+	static void BenchmarkDialogueSelection(int32 NumLines = 1000, int32 NumQueries = 100000);
 };
@@ -0,0 +1,224 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NPCDialogueIndex.h"
+#include "NPCCharacterData.h"
+#include "Algo/StableSort.h"
+
+namespace
+{
+	bool IsFlagSet(const TBitArray<>* Flags, int32 Bit)
+	{
+		return Flags && Flags->IsValidIndex(Bit) && (*Flags)[Bit];
+	}
+}
+
+void FNPCDialogueIndex::Reset()
+{
+	Categories.Reset();
+	FlagBits.Reset();
+	bBuilt = false;
+}
+
+void FNPCDialogueIndex::Build(const TArray<FNPCDialogueSet>& DialogueSets)
+{
+	Reset();
+
+	TArray<int32> LineBuckets;
+
+	for (int32 SetIndex = 0; SetIndex < DialogueSets.Num(); ++SetIndex)
+	{
+		const FNPCDialogueSet& Set = DialogueSets[SetIndex];
+		const FName CategoryName(*Set.Category);
+
+		// First set with a category wins, as with the old linear lookup
+		if (Categories.Contains(CategoryName))
+		{
+			continue;
+		}
+
+		FCategory& Category = Categories.Add(CategoryName);
+		Category.SetIndex = SetIndex;
+		Category.Lines.Reserve(Set.Lines.Num());
+		LineBuckets.Reset();
+
+		for (int32 LineIndex = 0; LineIndex < Set.Lines.Num(); ++LineIndex)
+		{
+			const FNPCDialogueLine& Line = Set.Lines[LineIndex];
+
+			// A season or day outside the calendar can never come up
+			if (Line.Season > 3 || Line.DayOfWeek > 6)
+			{
+				continue;
+			}
+
+			FCompiledLine& Compiled = Category.Lines.AddDefaulted_GetRef();
+			Compiled.Priority = Line.Priority;
+			Compiled.MinHearts = Line.MinHearts > 0 ? Line.MinHearts : TNumericLimits<int32>::Min();
+			Compiled.MaxHearts = Line.MaxHearts > 0 ? Line.MaxHearts : TNumericLimits<int32>::Max();
+			Compiled.Weather = Line.Weather.IsEmpty() ? NAME_None : FName(*Line.Weather);
+			Compiled.Location = Line.Location.IsEmpty() ? NAME_None : FName(*Line.Location);
+			Compiled.RequiredFlag = InternFlag(Line.RequiredFlag);
+			Compiled.BlockingFlag = InternFlag(Line.BlockingFlag);
+			Compiled.LineIndex = LineIndex;
+
+			LineBuckets.Add(GetBucket(FMath::Max(Line.Season, -1), FMath::Max(Line.DayOfWeek, -1)));
+		}
+
+		// Group by bucket, highest priority first, keeping authored order among equals
+		TArray<int32> Order;
+		Order.SetNumUninitialized(Category.Lines.Num());
+		for (int32 i = 0; i < Order.Num(); ++i)
+		{
+			Order[i] = i;
+		}
+		Algo::StableSort(Order, [&](int32 A, int32 B)
+		{
+			if (LineBuckets[A] != LineBuckets[B])
+			{
+				return LineBuckets[A] < LineBuckets[B];
+			}
+			return Category.Lines[A].Priority > Category.Lines[B].Priority;
+		});
+
+		TArray<FCompiledLine> Sorted;
+		Sorted.Reserve(Order.Num());
+		for (const int32 Index : Order)
+		{
+			Sorted.Add(Category.Lines[Index]);
+			++Category.BucketStart[LineBuckets[Index] + 1];
+		}
+		Category.Lines = MoveTemp(Sorted);
+
+		for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+		{
+			Category.BucketStart[Bucket + 1] += Category.BucketStart[Bucket];
+		}
+	}
+
+	Categories.Compact();
+	bBuilt = true;
+}
+
+int32 FNPCDialogueIndex::InternFlag(const FString& Flag)
+{
+	if (Flag.IsEmpty())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 NextBit = FlagBits.Num();
+	return FlagBits.FindOrAdd(FName(*Flag), NextBit);
+}
+
+int32 FNPCDialogueIndex::FindSetIndex(FName Category) const
+{
+	const FCategory* Found = Categories.Find(Category);
+	return Found ? Found->SetIndex : INDEX_NONE;
+}
+
+void FNPCDialogueIndex::MakeFlagSet(const TArray<FString>& ActiveFlags, TBitArray<>& OutFlags) const
+{
+	OutFlags.Init(false, FlagBits.Num());
+
+	for (const FString& Flag : ActiveFlags)
+	{
+		// FNAME_Find: a flag no line mentions was never interned and can't matter
+		const FName FlagName(*Flag, FNAME_Find);
+		if (const int32* Bit = FlagName.IsNone() ? nullptr : FlagBits.Find(FlagName))
+		{
+			OutFlags[*Bit] = true;
+		}
+	}
+}
+
+int32 FNPCDialogueIndex::SelectLine(FName CategoryName, const FNPCDialogueQuery& Query) const
+{
+	const FCategory* Category = Categories.Find(CategoryName);
+	if (!Category)
+	{
+		return INDEX_NONE;
+	}
+
+	const bool bSeason = Query.Season >= 0 && Query.Season < NumSeasonBuckets - 1;
+	const bool bDay = Query.DayOfWeek >= 0 && Query.DayOfWeek < NumDayBuckets - 1;
+
+	int32 Buckets[4];
+	int32 NumToScan = 0;
+	Buckets[NumToScan++] = GetBucket(-1, -1);
+	if (bSeason)
+	{
+		Buckets[NumToScan++] = GetBucket(Query.Season, -1);
+	}
+	if (bDay)
+	{
+		Buckets[NumToScan++] = GetBucket(-1, Query.DayOfWeek);
+	}
+	if (bSeason && bDay)
+	{
+		Buckets[NumToScan++] = GetBucket(Query.Season, Query.DayOfWeek);
+	}
+
+	int32 BestPriority = TNumericLimits<int32>::Min();
+	int32 NumTied = 0;
+	int32 Chosen = INDEX_NONE;
+
+	for (int32 b = 0; b < NumToScan; ++b)
+	{
+		const int32 End = Category->BucketStart[Buckets[b] + 1];
+		for (int32 i = Category->BucketStart[Buckets[b]]; i < End; ++i)
+		{
+			const FCompiledLine& Line = Category->Lines[i];
+
+			// The rest of the bucket can't beat what we have
+			if (Line.Priority < BestPriority)
+			{
+				break;
+			}
+
+			if (Query.Hearts < Line.MinHearts || Query.Hearts > Line.MaxHearts)
+			{
+				continue;
+			}
+			if (!Line.Weather.IsNone() && Line.Weather != Query.Weather)
+			{
+				continue;
+			}
+			if (!Line.Location.IsNone() && Line.Location != Query.Location)
+			{
+				continue;
+			}
+			if (Line.RequiredFlag != INDEX_NONE && !IsFlagSet(Query.Flags, Line.RequiredFlag))
+			{
+				continue;
+			}
+			if (Line.BlockingFlag != INDEX_NONE && IsFlagSet(Query.Flags, Line.BlockingFlag))
+			{
+				continue;
+			}
+
+			if (Line.Priority > BestPriority)
+			{
+				BestPriority = Line.Priority;
+				NumTied = 1;
+				Chosen = Line.LineIndex;
+			}
+			else if (FMath::RandRange(0, NumTied++) == 0)
+			{
+				// Reservoir pick: each of the tied lines ends up chosen with equal odds
+				Chosen = Line.LineIndex;
+			}
+		}
+	}
+
+	return Chosen;
+}
+
+SIZE_T FNPCDialogueIndex::GetAllocatedSize() const
+{
+	SIZE_T Size = Categories.GetAllocatedSize() + FlagBits.GetAllocatedSize();
+	for (const TPair<FName, FCategory>& Pair : Categories)
+	{
+		Size += Pair.Value.Lines.GetAllocatedSize();
+	}
+	return Size;
+}
@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FNPCDialogueSet;
+
+/**
+ * Conditions a dialogue line is picked against, already in the index's representation.
+ * Weather and location are looked up with FNAME_Find, so an unknown string becomes NAME_None
+ * and only matches lines without that condition.
+ */
+struct FNPCDialogueQuery
+{
+	int32 Hearts = 0;
+
+	/** 0-3, anything else only matches lines for any season */
+	int32 Season = -1;
+
+	/** 0-6, anything else only matches lines for any day */
+	int32 DayOfWeek = -1;
+
+	FName Weather;
+	FName Location;
+
+	/** Active flags from FNPCDialogueIndex::MakeFlagSet (null = no flags) */
+	const TBitArray<>* Flags = nullptr;
+};
+
+/**
+ * Dialogue sets compiled for selection.
+ *
+ * Each category's lines are bucketed by season (any + 4) and day of week (any + 7) and sorted by
+ * priority inside a bucket, so a query only visits the four buckets that can match it and stops
+ * each one at the first line below the best priority found so far. Weather and location are
+ * interned as FNames and flags as bit indices, so picking a line compares integers and allocates
+ * nothing.
+ *
+ * Lines refer back to their source by index; rebuild whenever the dialogue sets change.
+ */
+class HOBUNJIHOLLOW_API FNPCDialogueIndex
+{
+public:
+	void Build(const TArray<FNPCDialogueSet>& DialogueSets);
+	void Reset();
+
+	bool IsBuilt() const { return bBuilt; }
+
+	/** Index into the dialogue sets of the first set with this category, or INDEX_NONE */
+	int32 FindSetIndex(FName Category) const;
+
+	/** Bit set of ActiveFlags over the flags the lines refer to; flags no line mentions are dropped */
+	void MakeFlagSet(const TArray<FString>& ActiveFlags, TBitArray<>& OutFlags) const;
+
+	/**
+	 * Pick a line of Category matching Query: the highest priority wins, ties are picked at random.
+	 * @return Index of the line within its dialogue set, or INDEX_NONE if nothing matches
+	 */
+	int32 SelectLine(FName Category, const FNPCDialogueQuery& Query) const;
+
+	int32 GetNumCategories() const { return Categories.Num(); }
+	int32 GetNumFlags() const { return FlagBits.Num(); }
+	SIZE_T GetAllocatedSize() const;
+
+private:
+	static constexpr int32 NumSeasonBuckets = 5;
+	static constexpr int32 NumDayBuckets = 8;
+	static constexpr int32 NumBuckets = NumSeasonBuckets * NumDayBuckets;
+
+	/** Bucket for a season/day pair, with -1 meaning "any" */
+	static int32 GetBucket(int32 Season, int32 DayOfWeek) { return (Season + 1) * NumDayBuckets + (DayOfWeek + 1); }
+
+	struct FCompiledLine
+	{
+		int32 Priority = 0;
+
+		/** Inclusive heart range, with "no limit" widened to the int32 range */
+		int32 MinHearts = 0;
+		int32 MaxHearts = 0;
+
+		/** NAME_None = any */
+		FName Weather;
+		FName Location;
+
+		/** Bit in the flag set, or INDEX_NONE for no condition */
+		int32 RequiredFlag = INDEX_NONE;
+		int32 BlockingFlag = INDEX_NONE;
+
+		/** Index within the source dialogue set */
+		int32 LineIndex = INDEX_NONE;
+	};
+
+	struct FCategory
+	{
+		int32 SetIndex = INDEX_NONE;
+
+		/** Lines grouped by bucket, each bucket sorted by descending priority */
+		TArray<FCompiledLine> Lines;
+
+		/** Lines of bucket B are [BucketStart[B], BucketStart[B + 1]) */
+		int32 BucketStart[NumBuckets + 1] = {};
+	};
+
+	int32 InternFlag(const FString& Flag);
+
+	TMap<FName, FCategory> Categories;
+
+	/** Flag name -> bit index */
+	TMap<FName, int32> FlagBits;
+
+	bool bBuilt = false;
+};
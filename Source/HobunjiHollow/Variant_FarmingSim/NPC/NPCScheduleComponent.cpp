@@ -4,6 +4,7 @@
 #include "Grid/FarmGridManager.h"
 #include "FarmingTimeManager.h"
 #include "GameFramework/Character.h"
+#include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "AIController.h"
@@ -41,6 +42,28 @@ void UNPCScheduleComponent::BeginPlay()
 	{
 		UpdateSchedule();
 	}
+
+	// Only the server simulates schedules, so only it needs fidelity levels
+	if (bAllowSignificanceLOD && GetOwner()->HasAuthority())
+	{
+		if (UNPCSignificanceManager* SignificanceManager = GetWorld()->GetSubsystem<UNPCSignificanceManager>())
+		{
+			SignificanceManager->RegisterNPC(this);
+		}
+	}
+}
+
+void UNPCScheduleComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UNPCSignificanceManager* SignificanceManager = World->GetSubsystem<UNPCSignificanceManager>())
+		{
+			SignificanceManager->UnregisterNPC(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UNPCScheduleComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -67,6 +90,12 @@ void UNPCScheduleComponent::TickComponent(float DeltaTime, ELevelTick TickType,
 		UpdateSchedule();
 	}
 
+	if (IsOnRails())
+	{
+		SimulateOnRails(DeltaTime);
+		return;
+	}
+
 	// Handle waiting at waypoint
 	if (bHasArrived && bIsPatrolling && WaitTimer > 0.0f)
 	{
@@ -285,6 +314,41 @@ void UNPCScheduleComponent::StopMovement()
 	}
 }
 
+void UNPCScheduleComponent::ResumePatrolAt(int32 WaypointIndex, float WaitRemaining)
+{
+	// Make sure the current entry is running
+	UpdateSchedule();
+
+	if (!bIsPatrolling || !Schedule.IsValidIndex(CurrentScheduleIndex))
+	{
+		return;
+	}
+
+	FPatrolRoute Route;
+	if (!GetPatrolRoute(Schedule[CurrentScheduleIndex].PatrolRouteId, Route) || !Route.Waypoints.IsValidIndex(WaypointIndex))
+	{
+		return;
+	}
+
+	CurrentPatrolWaypointIndex = WaypointIndex;
+	const FPatrolWaypoint& Waypoint = Route.Waypoints[WaypointIndex];
+	CurrentTargetPosition = Waypoint.WorldPosition;
+	CurrentTargetFacing = Waypoint.Facing;
+	CurrentArrivalTolerance = Waypoint.ArrivalTolerance;
+
+	if (WaitRemaining >= 0.0f)
+	{
+		StopMovement();
+		bHasArrived = true;
+		WaitTimer = WaitRemaining;
+		UpdateFacingDirection();
+	}
+	else
+	{
+		MoveToPosition(CurrentTargetPosition, CurrentArrivalTolerance);
+	}
+}
+
 void UNPCScheduleComponent::TeleportToLocation(const FVector& WorldLocation, EGridDirection Facing)
 {
 	if (AActor* Owner = GetOwner())
@@ -513,8 +577,8 @@ void UNPCScheduleComponent::MoveToPosition(const FVector& Position, float Tolera
 	// Direct navigation (no roads or roads not available)
 	CurrentTargetPosition = Position;
 
-	// Try to use AI navigation
-	if (AActor* Owner = GetOwner())
+	// Try to use AI navigation (Far NPCs walk there on rails)
+	if (AActor* Owner = IsOnRails() ? nullptr : GetOwner())
 	{
 		if (APawn* Pawn = Cast<APawn>(Owner))
 		{
@@ -536,51 +600,7 @@ void UNPCScheduleComponent::ExecuteMovement(float DeltaTime)
 	// Check if arrived
 	if (HasArrivedAtDestination())
 	{
-		// If following a road, advance to next road waypoint instead of declaring patrol arrival
-		if (bIsFollowingRoad)
-		{
-			AdvanceRoadPath();
-			// AdvanceRoadPath() will either:
-			// - Move to next road waypoint (keeps bIsFollowingRoad true)
-			// - Finish road and move to final destination (sets bIsFollowingRoad false)
-			// Either way, don't mark as arrived yet - wait for actual patrol waypoint arrival
-			return;
-		}
-
-		if (!bHasArrived)
-		{
-			bHasArrived = true;
-			bIsMoving = false;
-
-			UpdateFacingDirection();
-
-			if (bIsPatrolling)
-			{
-				// Get current waypoint for wait time
-				const FNPCScheduleEntry& Entry = Schedule[CurrentScheduleIndex];
-				FPatrolRoute Route;
-				if (GetPatrolRoute(Entry.PatrolRouteId, Route) &&
-					CurrentPatrolWaypointIndex >= 0 &&
-					CurrentPatrolWaypointIndex < Route.Waypoints.Num())
-				{
-					const FPatrolWaypoint& Waypoint = Route.Waypoints[CurrentPatrolWaypointIndex];
-					WaitTimer = Waypoint.WaitTime;
-
-					UE_LOG(LogTemp, Log, TEXT("NPC '%s' arrived at waypoint '%s', waiting %.1fs"),
-						*NPCId, *Waypoint.Name, WaitTimer);
-
-					OnArrivedAtWaypoint.Broadcast(Waypoint.Name);
-				}
-			}
-			else
-			{
-				const FNPCScheduleEntry& Entry = Schedule[CurrentScheduleIndex];
-				UE_LOG(LogTemp, Log, TEXT("NPC '%s' arrived at destination '%s'"),
-					*NPCId, *Entry.LocationName);
-
-				OnArrivedAtDestination.Broadcast(Entry.LocationName);
-			}
-		}
+		HandleArrival();
 		return;
 	}
 
@@ -611,7 +631,9 @@ void UNPCScheduleComponent::ExecuteMovement(float DeltaTime)
 	FVector CurrentLoc = Owner->GetActorLocation();
 	FVector Direction = (CurrentTargetPosition - CurrentLoc).GetSafeNormal2D();
 
-	FVector NewLocation = CurrentLoc + Direction * WalkSpeed * DeltaTime;
+	// Don't overshoot when ticking at a reduced rate
+	const float Step = FMath::Min(WalkSpeed * DeltaTime, FVector::Dist2D(CurrentLoc, CurrentTargetPosition));
+	FVector NewLocation = CurrentLoc + Direction * Step;
 	NewLocation.Z = CurrentLoc.Z;
 
 	Owner->SetActorLocation(NewLocation);
@@ -624,6 +646,170 @@ void UNPCScheduleComponent::ExecuteMovement(float DeltaTime)
 	}
 }
 
+void UNPCScheduleComponent::HandleArrival()
+{
+	// If following a road, advance to next road waypoint instead of declaring patrol arrival
+	if (bIsFollowingRoad)
+	{
+		AdvanceRoadPath();
+		// AdvanceRoadPath() will either:
+		// - Move to next road waypoint (keeps bIsFollowingRoad true)
+		// - Finish road and move to final destination (sets bIsFollowingRoad false)
+		// Either way, don't mark as arrived yet - wait for actual patrol waypoint arrival
+		return;
+	}
+
+	if (!bHasArrived)
+	{
+		bHasArrived = true;
+		bIsMoving = false;
+
+		UpdateFacingDirection();
+
+		if (bIsPatrolling)
+		{
+			// Get current waypoint for wait time
+			const FNPCScheduleEntry& Entry = Schedule[CurrentScheduleIndex];
+			FPatrolRoute Route;
+			if (GetPatrolRoute(Entry.PatrolRouteId, Route) &&
+				CurrentPatrolWaypointIndex >= 0 &&
+				CurrentPatrolWaypointIndex < Route.Waypoints.Num())
+			{
+				const FPatrolWaypoint& Waypoint = Route.Waypoints[CurrentPatrolWaypointIndex];
+				WaitTimer = Waypoint.WaitTime;
+
+				UE_LOG(LogTemp, Log, TEXT("NPC '%s' arrived at waypoint '%s', waiting %.1fs"),
+					*NPCId, *Waypoint.Name, WaitTimer);
+
+				OnArrivedAtWaypoint.Broadcast(Waypoint.Name);
+			}
+		}
+		else
+		{
+			const FNPCScheduleEntry& Entry = Schedule[CurrentScheduleIndex];
+			UE_LOG(LogTemp, Log, TEXT("NPC '%s' arrived at destination '%s'"),
+				*NPCId, *Entry.LocationName);
+
+			OnArrivedAtDestination.Broadcast(Entry.LocationName);
+		}
+	}
+}
+
+void UNPCScheduleComponent::SetSignificance(ENPCSignificance NewSignificance, float TickInterval)
+{
+	SetComponentTickInterval(TickInterval);
+
+	if (NewSignificance == Significance)
+	{
+		return;
+	}
+
+	const bool bWasOnRails = IsOnRails();
+	Significance = NewSignificance;
+
+	APawn* Pawn = Cast<APawn>(GetOwner());
+	AAIController* AIController = Pawn ? Cast<AAIController>(Pawn->GetController()) : nullptr;
+	ACharacter* Character = Cast<ACharacter>(Pawn);
+	UCharacterMovementComponent* Movement = Character ? Character->GetCharacterMovement() : nullptr;
+
+	if (IsOnRails() && !bWasOnRails)
+	{
+		// SimulateOnRails moves the actor from here on
+		if (AIController)
+		{
+			AIController->StopMovement();
+		}
+		if (Movement)
+		{
+			Movement->StopMovementImmediately();
+			Movement->SetComponentTickEnabled(false);
+		}
+	}
+	else if (!IsOnRails() && bWasOnRails)
+	{
+		if (Movement)
+		{
+			Movement->SetComponentTickEnabled(true);
+		}
+		// Same target the rails were heading for, from wherever they left the NPC
+		if (AIController && bIsMoving)
+		{
+			AIController->MoveToLocation(CurrentTargetPosition, CurrentArrivalTolerance);
+		}
+	}
+
+	UE_LOG(LogTemp, Verbose, TEXT("NPCScheduleComponent '%s': Significance -> %d (tick interval %.2fs)"),
+		*NPCId, (int32)Significance, TickInterval);
+}
+
+void UNPCScheduleComponent::SimulateOnRails(float DeltaTime)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	// Spend DeltaTime in order on waiting and walking, so a long step ends where the same time
+	// spent ticking every frame would have; bounded so a degenerate path can't spin
+	constexpr int32 MaxStepsPerTick = 64;
+	float TimeLeft = DeltaTime;
+	for (int32 Step = 0; Step < MaxStepsPerTick && TimeLeft > KINDA_SMALL_NUMBER; ++Step)
+	{
+		if (bHasArrived && bIsPatrolling && WaitTimer > 0.0f)
+		{
+			const float Waited = FMath::Min(WaitTimer, TimeLeft);
+			WaitTimer -= Waited;
+			TimeLeft -= Waited;
+			if (WaitTimer <= 0.0f)
+			{
+				WaitTimer = 0.0f;
+				AdvancePatrolWaypoint();
+			}
+			continue;
+		}
+
+		if (!bIsMoving || WalkSpeed <= 0.0f)
+		{
+			break;
+		}
+
+		const FVector CurrentLoc = Owner->GetActorLocation();
+		const FVector Direction = (CurrentTargetPosition - CurrentLoc).GetSafeNormal2D();
+		const float Distance = FVector::Dist2D(CurrentLoc, CurrentTargetPosition);
+		const float Travel = WalkSpeed * TimeLeft;
+
+		if (Travel < Distance)
+		{
+			// Movement isn't ticking to keep the NPC on the ground, so follow the tile heights
+			const FVector NewLocation = GetRailsLocation(CurrentLoc + Direction * Travel);
+			Owner->SetActorLocationAndRotation(NewLocation, FRotator(0, Direction.Rotation().Yaw, 0));
+			break;
+		}
+
+		// Reaches the end of this leg within the step
+		TimeLeft -= Distance / WalkSpeed;
+		Owner->SetActorLocation(GetRailsLocation(FVector(CurrentTargetPosition.X, CurrentTargetPosition.Y, CurrentLoc.Z)));
+		HandleArrival();
+	}
+}
+
+FVector UNPCScheduleComponent::GetRailsLocation(const FVector& Location) const
+{
+	FVector Result = Location;
+	if (GridManager)
+	{
+		Result.Z = GridManager->GridToWorldWithHeight(GridManager->WorldToGrid(Location)).Z;
+
+		// A character's location is its capsule centre, not its feet
+		if (const ACharacter* Character = Cast<ACharacter>(GetOwner()))
+		{
+			Result.Z += Character->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+		}
+	}
+	return Result;
+}
+
 void UNPCScheduleComponent::UpdateFacingDirection()
 {
 	AActor* Owner = GetOwner();
@@ -699,8 +885,8 @@ bool UNPCScheduleComponent::TryUseRoadNavigation(const FVector& Destination, EGr
 	UE_LOG(LogTemp, Log, TEXT("NPC '%s' using road navigation with %d waypoints"),
 		*NPCId, CurrentRoadPath.Num());
 
-	// Start moving to first road waypoint
-	if (APawn* Pawn = Cast<APawn>(Owner))
+	// Start moving to first road waypoint (Far NPCs walk the path on rails)
+	if (APawn* Pawn = IsOnRails() ? nullptr : Cast<APawn>(Owner))
 	{
 		if (AAIController* AIController = Cast<AAIController>(Pawn->GetController()))
 		{
@@ -750,7 +936,7 @@ void UNPCScheduleComponent::AdvanceRoadPath()
 			*NPCId);
 
 		// Move to final destination
-		if (AActor* Owner = GetOwner())
+		if (AActor* Owner = IsOnRails() ? nullptr : GetOwner())
 		{
 			if (APawn* Pawn = Cast<APawn>(Owner))
 			{
@@ -768,7 +954,7 @@ void UNPCScheduleComponent::AdvanceRoadPath()
 	CurrentTargetPosition = CurrentRoadPath[CurrentRoadPathIndex];
 	bHasArrived = false;
 
-	if (AActor* Owner = GetOwner())
+	if (AActor* Owner = IsOnRails() ? nullptr : GetOwner())
 	{
 		if (APawn* Pawn = Cast<APawn>(Owner))
 		{
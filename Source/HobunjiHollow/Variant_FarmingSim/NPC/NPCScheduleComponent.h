@@ -6,6 +6,7 @@
 #include "Components/ActorComponent.h"
 #include "Grid/GridTypes.h"
 #include "Grid/MapDataTypes.h"
+#include "NPCSignificanceManager.h"
 #include "NPCScheduleComponent.generated.h"
 
 class UFarmGridManager;
@@ -111,6 +112,9 @@ struct FNPCScheduleEntry
 /**
  * Component that manages NPC scheduling and movement based on JSON-defined locations.
  * Supports both single destinations and patrol routes.
+ *
+ * UNPCSignificanceManager lowers the tick rate of distant NPCs, and moves the furthest ones
+ * along their path analytically instead of through the AI controller (see SetSignificance).
  */
 UCLASS(ClassGroup=(NPC), meta=(BlueprintSpawnableComponent))
 class HOBUNJIHOLLOW_API UNPCScheduleComponent : public UActorComponent
@@ -150,6 +154,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Schedule|Roads")
 	float RoadSearchDistance = 10.0f;
 
+	/** Whether UNPCSignificanceManager may lower this NPC's fidelity when no player is near */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Schedule|Significance")
+	bool bAllowSignificanceLOD = true;
+
 	// ---- Schedule Data ----
 
 	/** Available patrol routes */
@@ -198,6 +206,10 @@ public:
 	UPROPERTY(BlueprintReadOnly, Category = "NPC Schedule|State")
 	int32 CurrentRoadPathIndex = 0;
 
+	/** Current simulation fidelity, set by UNPCSignificanceManager */
+	UPROPERTY(BlueprintReadOnly, Category = "NPC Schedule|State")
+	ENPCSignificance Significance = ENPCSignificance::Near;
+
 	// ---- Functions ----
 
 	/** Load schedule and routes from JSON via grid manager */
@@ -236,10 +248,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "NPC Schedule")
 	void TeleportToLocation(const FVector& WorldLocation, EGridDirection Facing);
 
+	/**
+	 * Continue the active patrol from WaypointIndex instead of its first waypoint: walking to it,
+	 * or, with WaitRemaining >= 0, already there and waiting. Used when an NPC simulated without
+	 * an actor is given one.
+	 */
+	void ResumePatrolAt(int32 WaypointIndex, float WaitRemaining);
+
 	/** Check if NPC has arrived at destination */
 	UFUNCTION(BlueprintPure, Category = "NPC Schedule")
 	bool HasArrivedAtDestination() const;
 
+	UFUNCTION(BlueprintPure, Category = "NPC Schedule")
+	ENPCSignificance GetSignificance() const { return Significance; }
+
+	/**
+	 * Switch fidelity. Far stops AI path following and character movement and walks the NPC
+	 * along its current path at WalkSpeed; coming back from Far resumes AI movement toward the
+	 * same target from wherever the rails left it.
+	 */
+	void SetSignificance(ENPCSignificance NewSignificance, float TickInterval);
+
 	// ---- Events ----
 
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnScheduleChanged, int32, NewScheduleIndex, const FString&, Activity);
@@ -260,6 +289,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	UPROPERTY()
@@ -300,6 +330,17 @@ protected:
 	/** Execute movement toward current target */
 	void ExecuteMovement(float DeltaTime);
 
+	/** Reached CurrentTargetPosition: advance the road path, or start waiting / report arrival */
+	void HandleArrival();
+
+	/** Far NPCs: spend DeltaTime waiting and walking straight between path points, no AI controller */
+	void SimulateOnRails(float DeltaTime);
+
+	bool IsOnRails() const { return Significance == ENPCSignificance::Far; }
+
+	/** Location with Z on the cached tile height under it, lifted to the capsule centre for characters */
+	FVector GetRailsLocation(const FVector& Location) const;
+
 	/** Update facing direction when arrived */
 	void UpdateFacingDirection();
 
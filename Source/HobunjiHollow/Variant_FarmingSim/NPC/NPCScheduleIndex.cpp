@@ -0,0 +1,153 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NPCScheduleIndex.h"
+#include "NPCCharacterData.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+
+namespace
+{
+	float WrapHours(float Time)
+	{
+		Time = FMath::Fmod(Time, 24.0f);
+		return Time < 0.0f ? Time + 24.0f : Time;
+	}
+}
+
+void FNPCScheduleIndex::Reset()
+{
+	Intervals.Reset();
+	TimelineStart.Reset();
+	Weathers.Reset();
+	bBuilt = false;
+}
+
+void FNPCScheduleIndex::Build(const TArray<FNPCScheduleSlot>& Schedule)
+{
+	Reset();
+
+	Weathers.Add(NAME_None);
+	TArray<int32> SlotWeathers;
+	SlotWeathers.Reserve(Schedule.Num());
+
+	// The winner can only change where some slot starts or ends
+	TArray<float> Boundaries;
+	Boundaries.Add(0.0f);
+
+	for (const FNPCScheduleSlot& Slot : Schedule)
+	{
+		SlotWeathers.Add(Slot.Weather.IsEmpty() ? 0 : Weathers.AddUnique(FName(*Slot.Weather)));
+
+		for (const float Time : { Slot.StartTime, Slot.EndTime })
+		{
+			if (Time > 0.0f && Time < 24.0f)
+			{
+				Boundaries.Add(Time);
+			}
+		}
+	}
+
+	Boundaries.Sort();
+	Boundaries.SetNum(Algo::Unique(Boundaries));
+
+	TimelineStart.Reserve(NumSeasonKeys * NumDayKeys * Weathers.Num() + 1);
+
+	for (int32 Season = -1; Season < NumSeasonKeys - 1; ++Season)
+	{
+		for (int32 DayOfWeek = -1; DayOfWeek < NumDayKeys - 1; ++DayOfWeek)
+		{
+			for (int32 WeatherIndex = 0; WeatherIndex < Weathers.Num(); ++WeatherIndex)
+			{
+				const int32 First = Intervals.Num();
+				TimelineStart.Add(First);
+
+				for (const float Time : Boundaries)
+				{
+					// Same rules as the old per-query scan, evaluated once per piece of the day
+					int32 Winner = INDEX_NONE;
+					int32 BestSpecificity = -1;
+
+					for (int32 SlotIndex = 0; SlotIndex < Schedule.Num(); ++SlotIndex)
+					{
+						const FNPCScheduleSlot& Slot = Schedule[SlotIndex];
+
+						const bool bTimeMatches = Slot.StartTime <= Slot.EndTime
+							? (Time >= Slot.StartTime && Time < Slot.EndTime)
+							: (Time >= Slot.StartTime || Time < Slot.EndTime);
+
+						if (!bTimeMatches
+							|| (Slot.Season >= 0 && Slot.Season != Season)
+							|| (Slot.DayOfWeek >= 0 && Slot.DayOfWeek != DayOfWeek)
+							|| (SlotWeathers[SlotIndex] != 0 && SlotWeathers[SlotIndex] != WeatherIndex))
+						{
+							continue;
+						}
+
+						int32 Specificity = 0;
+						if (Slot.Season >= 0) Specificity += 100;
+						if (Slot.DayOfWeek >= 0) Specificity += 10;
+						if (SlotWeathers[SlotIndex] != 0) Specificity += 1;
+
+						if (Specificity > BestSpecificity)
+						{
+							BestSpecificity = Specificity;
+							Winner = SlotIndex;
+						}
+					}
+
+					if (Intervals.Num() > First && Intervals.Last().SlotIndex == Winner)
+					{
+						continue;
+					}
+
+					FInterval& Interval = Intervals.AddDefaulted_GetRef();
+					Interval.Start = Time;
+					Interval.SlotIndex = Winner;
+				}
+			}
+		}
+	}
+
+	TimelineStart.Add(Intervals.Num());
+	bBuilt = true;
+}
+
+int32 FNPCScheduleIndex::GetTimeline(int32 Season, int32 DayOfWeek, FName Weather) const
+{
+	const int32 SeasonKey = (Season >= 0 && Season < NumSeasonKeys - 1) ? Season : -1;
+	const int32 DayKey = (DayOfWeek >= 0 && DayOfWeek < NumDayKeys - 1) ? DayOfWeek : -1;
+	const int32 WeatherIndex = Weather.IsNone() ? 0 : FMath::Max(Weathers.IndexOfByKey(Weather), 0);
+
+	return ((SeasonKey + 1) * NumDayKeys + (DayKey + 1)) * Weathers.Num() + WeatherIndex;
+}
+
+int32 FNPCScheduleIndex::FindInterval(int32 Timeline, float Time) const
+{
+	const int32 First = TimelineStart[Timeline];
+	const TArrayView<const FInterval> View(Intervals.GetData() + First, TimelineStart[Timeline + 1] - First);
+
+	// Every timeline starts at 0, so there is always an interval at or before Time
+	return First + Algo::UpperBoundBy(View, Time, &FInterval::Start) - 1;
+}
+
+int32 FNPCScheduleIndex::FindSlot(float Time, int32 Season, int32 DayOfWeek, FName Weather) const
+{
+	if (!bBuilt)
+	{
+		return INDEX_NONE;
+	}
+
+	return Intervals[FindInterval(GetTimeline(Season, DayOfWeek, Weather), WrapHours(Time))].SlotIndex;
+}
+
+float FNPCScheduleIndex::GetNextTransition(float Time, int32 Season, int32 DayOfWeek, FName Weather) const
+{
+	if (!bBuilt)
+	{
+		return 24.0f;
+	}
+
+	const int32 Timeline = GetTimeline(Season, DayOfWeek, Weather);
+	const int32 Next = FindInterval(Timeline, WrapHours(Time)) + 1;
+	return Next < TimelineStart[Timeline + 1] ? Intervals[Next].Start : 24.0f;
+}
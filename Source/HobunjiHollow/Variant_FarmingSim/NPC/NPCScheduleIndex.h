@@ -0,0 +1,68 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FNPCScheduleSlot;
+
+/**
+ * An NPC's schedule slots compiled into one timeline per (season, weekday, weather) key.
+ *
+ * Each timeline is the day cut at every slot start and end, with the slot that wins each piece
+ * (most specific, then first authored) resolved at build time and equal neighbours merged. The
+ * slot at a time is a binary search, and the next time the answer can change is simply the start
+ * of the following piece.
+ *
+ * Times are hours in [0, 24); anything else is wrapped into that range. Weathers the schedule
+ * never mentions, and seasons or weekdays outside the calendar, share the timeline that only
+ * holds unconditioned slots. Slots refer back to the schedule by index; rebuild when it changes.
+ */
+class HOBUNJIHOLLOW_API FNPCScheduleIndex
+{
+public:
+	void Build(const TArray<FNPCScheduleSlot>& Schedule);
+	void Reset();
+
+	bool IsBuilt() const { return bBuilt; }
+
+	/** Index into the schedule of the slot active at Time, or INDEX_NONE */
+	int32 FindSlot(float Time, int32 Season, int32 DayOfWeek, FName Weather) const;
+
+	/**
+	 * First time after Time at which the active slot changes, or 24 if it holds until midnight
+	 * (where the weekday, and so the timeline, changes anyway).
+	 */
+	float GetNextTransition(float Time, int32 Season, int32 DayOfWeek, FName Weather) const;
+
+	int32 GetNumIntervals() const { return Intervals.Num(); }
+
+private:
+	static constexpr int32 NumSeasonKeys = 5;
+	static constexpr int32 NumDayKeys = 8;
+
+	struct FInterval
+	{
+		float Start = 0.0f;
+
+		/** Slot active from Start until the next interval, or INDEX_NONE */
+		int32 SlotIndex = INDEX_NONE;
+	};
+
+	/** Timeline for a query; out-of-calendar seasons/days and unknown weathers use key -1 / 0 */
+	int32 GetTimeline(int32 Season, int32 DayOfWeek, FName Weather) const;
+
+	/** Position in Intervals of the interval covering Time on a timeline */
+	int32 FindInterval(int32 Timeline, float Time) const;
+
+	/** All timelines back to back */
+	TArray<FInterval> Intervals;
+
+	/** Intervals of timeline T are [TimelineStart[T], TimelineStart[T + 1]) */
+	TArray<int32> TimelineStart;
+
+	/** Weathers the schedule mentions; index 0 is NAME_None (no weather condition) */
+	TArray<FName> Weathers;
+
+	bool bBuilt = false;
+};
@@ -6,7 +6,10 @@
 #include "NPCDataRegistry.h"
 #include "NPCDataComponent.h"
 #include "NPCScheduleComponent.h"
+#include "NPCAppearanceLoader.h"
 #include "Kismet/GameplayStatics.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
 
 ANPCScheduleSpawner::ANPCScheduleSpawner()
 {
@@ -63,6 +66,7 @@ void ANPCScheduleSpawner::Tick(float DeltaTime)
 	TimeSinceLastCheck += DeltaTime;
 	if (TimeSinceLastCheck >= ScheduleCheckInterval)
 	{
+		const float Elapsed = TimeSinceLastCheck;
 		TimeSinceLastCheck = 0.0f;
 
 		// If no schedules loaded yet, try again (MapDataImporter may have finished)
@@ -72,6 +76,7 @@ void ANPCScheduleSpawner::Tick(float DeltaTime)
 		}
 
 		UpdateNPCStates();
+		UpdateOffscreenNPCs(Elapsed);
 	}
 }
 
@@ -107,6 +112,9 @@ void ANPCScheduleSpawner::LoadSchedules()
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner: Loaded %d NPC schedules"), ScheduledNPCs.Num());
+
+	// Next update evaluates every schedule and seeds the boundary heap
+	LastUpdateGameHours = -1.0;
 }
 
 bool ANPCScheduleSpawner::IsTimeInScheduleRange(float CurrentTime, float StartTime, float EndTime) const
@@ -130,59 +138,241 @@ void ANPCScheduleSpawner::UpdateNPCStates()
 		return;
 	}
 
-	float CurrentTime = TimeManager->CurrentTime;
+	const double NowGameHours = TimeManager->GetTotalGameHours();
+
+	// Going backwards (SetTime, save restore) or skipping a day or more (AdvanceDay) leaves the
+	// heap out of step with the clock; anything smaller is just a run of crossed boundaries
+	if (LastUpdateGameHours < 0.0 || NowGameHours < LastUpdateGameHours || NowGameHours - LastUpdateGameHours >= 24.0)
+	{
+		RebuildScheduleTimeline();
+	}
+	else
+	{
+		while (BoundaryHeap.Num() > 0 && BoundaryHeap.HeapTop().GameHours <= NowGameHours)
+		{
+			FNPCScheduleBoundary Boundary;
+			BoundaryHeap.HeapPop(Boundary, EAllowShrinking::No);
+
+			if (FScheduledNPCState* State = ScheduledNPCs.Find(Boundary.NpcId))
+			{
+				EvaluateNPC(*State, NowGameHours);
+			}
+		}
+	}
+
+	LastUpdateGameHours = NowGameHours;
+
+	PrefetchUpcomingNPCs(NowGameHours);
+
+	// Check if actors were destroyed externally
+	for (const FString& NpcId : PendingRespawns)
+	{
+		FScheduledNPCState* State = ScheduledNPCs.Find(NpcId);
+		if (State && State->bShouldBeActive && !IsValid(State->SpawnedActor) && !State->Sim.bActive)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("NPCScheduleSpawner '%s': Actor was destroyed externally, respawning"), *State->NpcId);
+			State->SpawnedActor = nullptr;
+			ActivateNPC(*State);
+		}
+	}
+	PendingRespawns.Reset();
+}
+
+void ANPCScheduleSpawner::RebuildScheduleTimeline()
+{
+	if (!TimeManager)
+	{
+		return;
+	}
+
+	const double NowGameHours = TimeManager->GetTotalGameHours();
 
+	BoundaryHeap.Reset();
+	PrefetchHeap.Reset();
 	for (auto& Pair : ScheduledNPCs)
 	{
-		FScheduledNPCState& State = Pair.Value;
+		EvaluateNPC(Pair.Value, NowGameHours);
+	}
+	LastUpdateGameHours = NowGameHours;
+
+	if (bDebugLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner: Rebuilt schedule timeline at %s, %d boundaries pending"),
+			*TimeManager->GetFormattedTime(), BoundaryHeap.Num());
+	}
+}
 
-		bool bShouldBeActive = IsTimeInScheduleRange(
+void ANPCScheduleSpawner::EvaluateNPC(FScheduledNPCState& State, double NowGameHours)
+{
+	const float CurrentTime = TimeManager->CurrentTime;
+
+	bool bShouldBeActive = IsTimeInScheduleRange(
+		CurrentTime,
+		State.ScheduleData.StartTime,
+		State.ScheduleData.EndTime
+	);
+
+	// Check if state changed
+	if (bShouldBeActive != State.bShouldBeActive)
+	{
+		UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner '%s': State change %s -> %s (Time=%.2f, Range=%.0f-%.0f, Actor=%s)"),
+			*State.NpcId,
+			State.bShouldBeActive ? TEXT("Active") : TEXT("Inactive"),
+			bShouldBeActive ? TEXT("Active") : TEXT("Inactive"),
 			CurrentTime,
 			State.ScheduleData.StartTime,
-			State.ScheduleData.EndTime
-		);
+			State.ScheduleData.EndTime,
+			IsValid(State.SpawnedActor) ? TEXT("Valid") : TEXT("Null"));
+
+		State.bShouldBeActive = bShouldBeActive;
 
-		// Check if state changed
-		if (bShouldBeActive != State.bShouldBeActive)
+		if (bShouldBeActive)
 		{
-			UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner '%s': State change %s -> %s (Time=%.2f, Range=%.0f-%.0f, Actor=%s)"),
-				*State.NpcId,
-				State.bShouldBeActive ? TEXT("Active") : TEXT("Inactive"),
-				bShouldBeActive ? TEXT("Active") : TEXT("Inactive"),
-				CurrentTime,
-				State.ScheduleData.StartTime,
-				State.ScheduleData.EndTime,
-				IsValid(State.SpawnedActor) ? TEXT("Valid") : TEXT("Null"));
-
-			State.bShouldBeActive = bShouldBeActive;
-
-			if (bShouldBeActive)
+			// Time to spawn
+			if (!State.SpawnedActor && !State.Sim.bActive)
 			{
-				// Time to spawn
-				if (!State.SpawnedActor)
-				{
-					UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner '%s': Spawning NPC"), *State.NpcId);
-					SpawnNPC(State);
-				}
+				UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner '%s': Spawning NPC"), *State.NpcId);
+				ActivateNPC(State);
 			}
-			else
+		}
+		else
+		{
+			State.Sim.bActive = false;
+
+			// Time to despawn
+			if (State.SpawnedActor)
 			{
-				// Time to despawn
-				if (State.SpawnedActor)
-				{
-					UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner '%s': Despawning NPC"), *State.NpcId);
-					DespawnNPC(State);
-				}
+				UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner '%s': Despawning NPC"), *State.NpcId);
+				DespawnNPC(State);
 			}
 		}
+	}
+
+	if (State.bShouldBeActive && !IsValid(State.SpawnedActor) && !State.Sim.bActive)
+	{
+		State.SpawnedActor = nullptr;
+		ActivateNPC(State);
+	}
+
+	State.PendingStartGameHours = -1.0;
 
-		// Check if actor was destroyed externally
-		if (State.bShouldBeActive && !IsValid(State.SpawnedActor))
+	double NextBoundary = 0.0;
+	if (GetNextBoundary(State, NowGameHours, NextBoundary))
+	{
+		BoundaryHeap.HeapPush(FNPCScheduleBoundary{ NextBoundary, State.NpcId });
+
+		// An inactive NPC's boundary is its next start
+		if (!State.bShouldBeActive)
 		{
-			UE_LOG(LogTemp, Warning, TEXT("NPCScheduleSpawner '%s': Actor was destroyed externally, respawning"), *State.NpcId);
-			State.SpawnedActor = nullptr;
-			SpawnNPC(State);
+			State.PendingStartGameHours = NextBoundary;
+			if (PrefetchLeadHours > 0.0f)
+			{
+				PrefetchHeap.HeapPush(FNPCPrefetchEntry{ NextBoundary - PrefetchLeadHours, NextBoundary, State.NpcId });
+			}
+		}
+	}
+
+	// A prefetch stops counting against the cap once its start is reached or no longer pending
+	if (State.PrefetchedStartGameHours >= 0.0 && State.PrefetchedStartGameHours != State.PendingStartGameHours)
+	{
+		State.PrefetchedStartGameHours = -1.0;
+		--NumOutstandingPrefetches;
+	}
+}
+
+void ANPCScheduleSpawner::PrefetchUpcomingNPCs(double NowGameHours)
+{
+	UNPCAppearanceLoader* AppearanceLoader = GetWorld()->GetSubsystem<UNPCAppearanceLoader>();
+	if (!AppearanceLoader || !NPCDataRegistry)
+	{
+		PrefetchHeap.Reset();
+		return;
+	}
+
+	bool bGatheredPlayers = false;
+	while (PrefetchHeap.Num() > 0 && PrefetchHeap.HeapTop().GameHours <= NowGameHours)
+	{
+		const FNPCPrefetchEntry& Top = PrefetchHeap.HeapTop();
+		FScheduledNPCState* State = ScheduledNPCs.Find(Top.NpcId);
+		const bool bStale = !State || State->bShouldBeActive
+			|| State->PendingStartGameHours != Top.StartGameHours
+			|| State->PrefetchedStartGameHours == Top.StartGameHours;
+
+		// Prefetching past the cache size would only evict earlier prefetches; wait for a start
+		if (!bStale && NumOutstandingPrefetches >= AppearanceLoader->MaxCachedNPCs)
+		{
+			break;
 		}
+
+		FNPCPrefetchEntry Entry;
+		PrefetchHeap.HeapPop(Entry, EAllowShrinking::No);
+		if (bStale)
+		{
+			continue;
+		}
+
+		// NPCs starting away from every player are simulated without an actor, so need no appearance yet
+		if (bSimulateOffscreen)
+		{
+			if (!bGatheredPlayers)
+			{
+				GatherPlayerLocations();
+				bGatheredPlayers = true;
+			}
+
+			FVector SpawnLocation;
+			FRotator SpawnRotation;
+			if (GetSpawnTransform(*State, SpawnLocation, SpawnRotation) && !IsNearAnyPlayer(SpawnLocation, RelevanceRange + DematerializeMargin))
+			{
+				continue;
+			}
+		}
+
+		AppearanceLoader->Prefetch(NPCDataRegistry->GetNPCData(Entry.NpcId));
+		State->PrefetchedStartGameHours = Entry.StartGameHours;
+		++NumOutstandingPrefetches;
+	}
+}
+
+bool ANPCScheduleSpawner::GetNextBoundary(const FScheduledNPCState& State, double NowGameHours, double& OutGameHours) const
+{
+	const float StartTime = State.ScheduleData.StartTime;
+	const float EndTime = State.ScheduleData.EndTime;
+
+	// Same test as IsTimeInScheduleRange: an empty range is never active
+	if (StartTime == EndTime)
+	{
+		return false;
+	}
+
+	const float BoundaryHour = State.bShouldBeActive ? EndTime : StartTime;
+	const double DayStartGameHours = NowGameHours - TimeManager->CurrentTime;
+
+	OutGameHours = DayStartGameHours + BoundaryHour;
+	while (OutGameHours <= NowGameHours)
+	{
+		// Already passed today (or a wrapping range ends tomorrow)
+		OutGameHours += 24.0;
+	}
+	return true;
+}
+
+void ANPCScheduleSpawner::HandleSpawnedActorDestroyed(AActor* DestroyedActor)
+{
+	for (auto& Pair : ScheduledNPCs)
+	{
+		FScheduledNPCState& State = Pair.Value;
+		if (State.SpawnedActor != DestroyedActor)
+		{
+			continue;
+		}
+
+		// Respawn outside the destroy callback
+		if (State.bShouldBeActive)
+		{
+			PendingRespawns.AddUnique(State.NpcId);
+		}
+		break;
 	}
 }
 
@@ -193,6 +383,19 @@ AActor* ANPCScheduleSpawner::SpawnNPC(FScheduledNPCState& State)
 		return nullptr;
 	}
 
+	FVector SpawnLocation;
+	FRotator SpawnRotation;
+	if (!GetSpawnTransform(State, SpawnLocation, SpawnRotation))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("NPCScheduleSpawner: No spawn location for NPC '%s'"), *State.NpcId);
+		return nullptr;
+	}
+
+	return SpawnNPCAt(State, SpawnLocation, SpawnRotation);
+}
+
+bool ANPCScheduleSpawner::GetSpawnTransform(const FScheduledNPCState& State, FVector& OutLocation, FRotator& OutRotation) const
+{
 	// Get spawn location
 	const FMapScheduleLocation* SpawnLoc = State.ScheduleData.GetSpawnLocation();
 	if (!SpawnLoc && State.ScheduleData.Locations.Num() > 0)
@@ -200,16 +403,19 @@ AActor* ANPCScheduleSpawner::SpawnNPC(FScheduledNPCState& State)
 		SpawnLoc = &State.ScheduleData.Locations[0];
 	}
 
-	if (!SpawnLoc)
+	if (!SpawnLoc || !GridManager)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("NPCScheduleSpawner: No spawn location for NPC '%s'"), *State.NpcId);
-		return nullptr;
+		return false;
 	}
 
 	// Get world position
-	FVector SpawnLocation = GridManager->GridToWorldWithHeight(SpawnLoc->GetGridCoordinate());
-	FRotator SpawnRotation = UGridFunctionLibrary::DirectionToRotation(SpawnLoc->GetFacingDirection());
+	OutLocation = GridManager->GridToWorldWithHeight(SpawnLoc->GetGridCoordinate());
+	OutRotation = UGridFunctionLibrary::DirectionToRotation(SpawnLoc->GetFacingDirection());
+	return true;
+}
 
+AActor* ANPCScheduleSpawner::SpawnNPCAt(FScheduledNPCState& State, const FVector& SpawnLocation, const FRotator& SpawnRotation)
+{
 	// Get class to spawn
 	TSubclassOf<AActor> NPCClass = GetNPCClass(State);
 	if (!NPCClass)
@@ -227,6 +433,7 @@ AActor* ANPCScheduleSpawner::SpawnNPC(FScheduledNPCState& State)
 	if (SpawnedActor)
 	{
 		State.SpawnedActor = SpawnedActor;
+		SpawnedActor->OnDestroyed.AddDynamic(this, &ANPCScheduleSpawner::HandleSpawnedActorDestroyed);
 
 		UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner: Actor spawned '%s' at location (%f, %f, %f), Class: %s"),
 			*State.NpcId, SpawnLocation.X, SpawnLocation.Y, SpawnLocation.Z,
@@ -277,8 +484,8 @@ AActor* ANPCScheduleSpawner::SpawnNPC(FScheduledNPCState& State)
 
 		if (bDebugLogging)
 		{
-			UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner: Spawned '%s' at (%d, %d)"),
-				*State.NpcId, SpawnLoc->X, SpawnLoc->Y);
+			UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner: Spawned '%s' at %s"),
+				*State.NpcId, *SpawnLocation.ToString());
 		}
 
 		OnNPCSpawned.Broadcast(State.NpcId, SpawnedActor);
@@ -306,8 +513,10 @@ void ANPCScheduleSpawner::DespawnNPC(FScheduledNPCState& State)
 
 	// TODO: Could animate walking to despawn point before destroying
 	// For now, just destroy immediately
-	State.SpawnedActor->Destroy();
+	AActor* Actor = State.SpawnedActor;
 	State.SpawnedActor = nullptr;
+	Actor->OnDestroyed.RemoveDynamic(this, &ANPCScheduleSpawner::HandleSpawnedActorDestroyed);
+	Actor->Destroy();
 
 	OnNPCDespawned.Broadcast(State.NpcId);
 }
@@ -346,12 +555,17 @@ void ANPCScheduleSpawner::RefreshAllSchedules()
 		FScheduledNPCState& State = Pair.Value;
 		if (IsValid(State.SpawnedActor))
 		{
+			State.SpawnedActor->OnDestroyed.RemoveDynamic(this, &ANPCScheduleSpawner::HandleSpawnedActorDestroyed);
 			State.SpawnedActor->Destroy();
 			State.SpawnedActor = nullptr;
 		}
 	}
 
 	ScheduledNPCs.Empty();
+	BoundaryHeap.Reset();
+	PrefetchHeap.Reset();
+	NumOutstandingPrefetches = 0;
+	PendingRespawns.Reset();
 
 	// Reload schedules
 	LoadSchedules();
@@ -372,12 +586,21 @@ AActor* ANPCScheduleSpawner::ForceSpawnNPC(const FString& NpcId)
 		return State->SpawnedActor;
 	}
 
+	if (State->Sim.bActive)
+	{
+		return MaterializeNPC(*State);
+	}
+
 	return SpawnNPC(*State);
 }
 
 void ANPCScheduleSpawner::ForceDespawnNPC(const FString& NpcId)
 {
 	FScheduledNPCState* State = ScheduledNPCs.Find(NpcId);
+	if (State)
+	{
+		State->Sim.bActive = false;
+	}
 	if (State && IsValid(State->SpawnedActor))
 	{
 		DespawnNPC(*State);
@@ -399,3 +622,285 @@ AActor* ANPCScheduleSpawner::GetSpawnedNPC(const FString& NpcId) const
 	}
 	return nullptr;
 }
+
+bool ANPCScheduleSpawner::IsNPCSimulated(const FString& NpcId) const
+{
+	const FScheduledNPCState* State = ScheduledNPCs.Find(NpcId);
+	return State && State->Sim.bActive;
+}
+
+bool ANPCScheduleSpawner::GetNPCLocation(const FString& NpcId, FVector& OutLocation) const
+{
+	const FScheduledNPCState* State = ScheduledNPCs.Find(NpcId);
+	if (!State)
+	{
+		return false;
+	}
+	if (IsValid(State->SpawnedActor))
+	{
+		OutLocation = State->SpawnedActor->GetActorLocation();
+		return true;
+	}
+	if (State->Sim.bActive)
+	{
+		OutLocation = GetSimulatedGroundLocation(State->Sim);
+		return true;
+	}
+	return false;
+}
+
+int32 ANPCScheduleSpawner::GetNumSimulatedNPCs() const
+{
+	int32 Count = 0;
+	for (const auto& Pair : ScheduledNPCs)
+	{
+		if (Pair.Value.Sim.bActive)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+void ANPCScheduleSpawner::ActivateNPC(FScheduledNPCState& State)
+{
+	FVector SpawnLocation;
+	FRotator SpawnRotation;
+	if (!bSimulateOffscreen || !GetSpawnTransform(State, SpawnLocation, SpawnRotation))
+	{
+		SpawnNPC(State);
+		return;
+	}
+
+	GatherPlayerLocations();
+	if (IsNearAnyPlayer(SpawnLocation, RelevanceRange))
+	{
+		SpawnNPC(State);
+		return;
+	}
+
+	// Start the patrol from the spawn point, as the schedule component would
+	FNPCOffscreenSim& Sim = State.Sim;
+	Sim = FNPCOffscreenSim();
+	Sim.bActive = true;
+	Sim.Location = SpawnLocation;
+	for (const FMapScheduleLocation& Location : State.ScheduleData.Locations)
+	{
+		Sim.Waypoints.Add(GridManager->GridToWorldWithHeight(Location.GetGridCoordinate()));
+	}
+	BeginSimulatedLeg(Sim);
+
+	if (bDebugLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner: Simulating '%s' offscreen (%d waypoints)"),
+			*State.NpcId, Sim.Waypoints.Num());
+	}
+}
+
+// ---- Offscreen simulation ----
+
+void ANPCScheduleSpawner::GatherPlayerLocations()
+{
+	PlayerLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+}
+
+bool ANPCScheduleSpawner::IsNearAnyPlayer(const FVector& Location, float Range) const
+{
+	const float RangeSq = FMath::Square(Range);
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		if (FVector::DistSquared(PlayerLocation, Location) < RangeSq)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void ANPCScheduleSpawner::UpdateOffscreenNPCs(float DeltaSeconds)
+{
+	GatherPlayerLocations();
+
+	for (auto& Pair : ScheduledNPCs)
+	{
+		FScheduledNPCState& State = Pair.Value;
+
+		if (State.Sim.bActive)
+		{
+			AdvanceSimulation(State.Sim, DeltaSeconds);
+
+			if (!bSimulateOffscreen || IsNearAnyPlayer(State.Sim.Location, RelevanceRange))
+			{
+				MaterializeNPC(State);
+			}
+		}
+		else if (bSimulateOffscreen && State.bShouldBeActive && IsValid(State.SpawnedActor)
+			&& !IsNearAnyPlayer(State.SpawnedActor->GetActorLocation(), RelevanceRange + DematerializeMargin))
+		{
+			DematerializeNPC(State);
+		}
+	}
+}
+
+void ANPCScheduleSpawner::AdvanceSimulation(FNPCOffscreenSim& Sim, float DeltaSeconds) const
+{
+	if (Sim.Waypoints.Num() == 0 || SimulatedWalkSpeed <= 0.0f)
+	{
+		return;
+	}
+
+	// Spend the time in order on waiting and walking; bounded so a degenerate path can't spin
+	constexpr int32 MaxStepsPerUpdate = 64;
+	float TimeLeft = DeltaSeconds;
+	for (int32 Step = 0; Step < MaxStepsPerUpdate && TimeLeft > KINDA_SMALL_NUMBER; ++Step)
+	{
+		if (Sim.bArrived)
+		{
+			const float Waited = FMath::Min(Sim.WaitRemaining, TimeLeft);
+			Sim.WaitRemaining -= Waited;
+			TimeLeft -= Waited;
+			if (Sim.WaitRemaining <= 0.0f)
+			{
+				// Patrol routes built from JSON loop
+				Sim.WaypointIndex = (Sim.WaypointIndex + 1) % Sim.Waypoints.Num();
+				BeginSimulatedLeg(Sim);
+			}
+			continue;
+		}
+
+		if (!Sim.LegPoints.IsValidIndex(Sim.LegIndex))
+		{
+			Sim.bArrived = true;
+			Sim.WaitRemaining = SimulatedWaitTime;
+			continue;
+		}
+
+		const FVector& Target = Sim.LegPoints[Sim.LegIndex];
+		const float Distance = FVector::Dist2D(Sim.Location, Target);
+		const float Travel = SimulatedWalkSpeed * TimeLeft;
+		if (Travel < Distance)
+		{
+			Sim.Location += (Target - Sim.Location).GetSafeNormal2D() * Travel;
+			break;
+		}
+
+		TimeLeft -= Distance / SimulatedWalkSpeed;
+		Sim.Location = Target;
+		++Sim.LegIndex;
+	}
+}
+
+void ANPCScheduleSpawner::BeginSimulatedLeg(FNPCOffscreenSim& Sim) const
+{
+	Sim.bArrived = false;
+	Sim.WaitRemaining = 0.0f;
+	Sim.LegPoints.Reset();
+	Sim.LegIndex = 0;
+
+	if (!Sim.Waypoints.IsValidIndex(Sim.WaypointIndex))
+	{
+		return;
+	}
+
+	const FVector Destination = Sim.Waypoints[Sim.WaypointIndex];
+
+	// Same rule as UNPCScheduleComponent::TryUseRoadNavigation: roads if the path has waypoints
+	// of its own, skipping index 0 (the start)
+	TArray<FVector> RoadPath;
+	if (GridManager && GridManager->FindRoadPath(GridManager->WorldToGrid(Sim.Location), GridManager->WorldToGrid(Destination), RoadPath)
+		&& RoadPath.Num() >= 3)
+	{
+		Sim.LegPoints.Append(RoadPath.GetData() + 1, RoadPath.Num() - 1);
+	}
+	Sim.LegPoints.Add(Destination);
+}
+
+FVector ANPCScheduleSpawner::GetSimulatedGroundLocation(const FNPCOffscreenSim& Sim) const
+{
+	FVector Location = Sim.Location;
+	if (GridManager)
+	{
+		Location.Z = GridManager->GridToWorldWithHeight(GridManager->WorldToGrid(Sim.Location)).Z;
+	}
+	return Location;
+}
+
+AActor* ANPCScheduleSpawner::MaterializeNPC(FScheduledNPCState& State)
+{
+	FNPCOffscreenSim& Sim = State.Sim;
+
+	// Face along the walk, or the way the schedule says once there
+	FRotator Rotation = FRotator::ZeroRotator;
+	if (Sim.bArrived && State.ScheduleData.Locations.IsValidIndex(Sim.WaypointIndex))
+	{
+		Rotation = UGridFunctionLibrary::DirectionToRotation(State.ScheduleData.Locations[Sim.WaypointIndex].GetFacingDirection());
+	}
+	else if (Sim.LegPoints.IsValidIndex(Sim.LegIndex))
+	{
+		Rotation = FRotator(0.0f, (Sim.LegPoints[Sim.LegIndex] - Sim.Location).GetSafeNormal2D().Rotation().Yaw, 0.0f);
+	}
+
+	// A failed spawn leaves the NPC simulated, to be tried again rather than lost
+	AActor* Actor = SpawnNPCAt(State, GetSimulatedGroundLocation(Sim), Rotation);
+	if (!Actor)
+	{
+		return nullptr;
+	}
+	Sim.bActive = false;
+
+	// Hand the patrol over where the simulation got to
+	if (UNPCScheduleComponent* ScheduleComp = Actor->FindComponentByClass<UNPCScheduleComponent>())
+	{
+		ScheduleComp->ResumePatrolAt(Sim.WaypointIndex, Sim.bArrived ? Sim.WaitRemaining : -1.0f);
+	}
+
+	if (bDebugLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner: Materialized '%s' heading for waypoint %d"),
+			*State.NpcId, Sim.WaypointIndex);
+	}
+	return Actor;
+}
+
+void ANPCScheduleSpawner::DematerializeNPC(FScheduledNPCState& State)
+{
+	AActor* Actor = State.SpawnedActor;
+
+	FNPCOffscreenSim& Sim = State.Sim;
+	Sim = FNPCOffscreenSim();
+	Sim.Location = Actor->GetActorLocation();
+	for (const FMapScheduleLocation& Location : State.ScheduleData.Locations)
+	{
+		Sim.Waypoints.Add(GridManager->GridToWorldWithHeight(Location.GetGridCoordinate()));
+	}
+
+	// Pick the patrol up from the schedule component
+	const UNPCScheduleComponent* ScheduleComp = Actor->FindComponentByClass<UNPCScheduleComponent>();
+	if (ScheduleComp && ScheduleComp->bIsPatrolling && Sim.Waypoints.IsValidIndex(ScheduleComp->CurrentPatrolWaypointIndex))
+	{
+		Sim.WaypointIndex = ScheduleComp->CurrentPatrolWaypointIndex;
+	}
+	BeginSimulatedLeg(Sim);
+	if (ScheduleComp && ScheduleComp->bIsPatrolling && ScheduleComp->bHasArrived)
+	{
+		Sim.bArrived = true;
+		Sim.WaitRemaining = ScheduleComp->WaitTimer;
+	}
+
+	DespawnNPC(State);
+	Sim.bActive = true;
+
+	if (bDebugLogging)
+	{
+		UE_LOG(LogTemp, Log, TEXT("NPCScheduleSpawner: Dematerialized '%s' at waypoint %d"),
+			*State.NpcId, Sim.WaypointIndex);
+	}
+}
@@ -11,6 +11,32 @@ class UFarmGridManager;
 class AFarmingTimeManager;
 class UNPCDataRegistry;
 
+/**
+ * Logical position of an active NPC that has no actor, walking its patrol the way
+ * UNPCScheduleComponent would: waypoint to waypoint in order, looping, over roads when there
+ * is a road path, waiting at each waypoint.
+ */
+struct FNPCOffscreenSim
+{
+	/** Simulated instead of spawned */
+	bool bActive = false;
+
+	FVector Location = FVector::ZeroVector;
+
+	/** Patrol waypoints (the schedule's locations) in world space */
+	TArray<FVector> Waypoints;
+
+	/** Waypoint being walked to, or waited at once bArrived */
+	int32 WaypointIndex = 0;
+
+	bool bArrived = false;
+	float WaitRemaining = 0.0f;
+
+	/** Points still to walk to reach the waypoint (road path, then the waypoint itself) */
+	TArray<FVector> LegPoints;
+	int32 LegIndex = 0;
+};
+
 /**
  * Runtime state for a scheduled NPC
  */
@@ -34,11 +60,54 @@ struct FScheduledNPCState
 	/** Cached schedule data */
 	UPROPERTY()
 	FMapPathData ScheduleData;
+
+	/** Actorless simulation while active but away from every player */
+	FNPCOffscreenSim Sim;
+
+	/** Next start boundary while inactive (-1 = none pending) */
+	double PendingStartGameHours = -1.0;
+
+	/** Start boundary whose appearance prefetch is outstanding (-1 = none) */
+	double PrefetchedStartGameHours = -1.0;
+};
+
+/** Next time (in AFarmingTimeManager::GetTotalGameHours) an NPC's schedule crosses its start or end */
+struct FNPCScheduleBoundary
+{
+	double GameHours = 0.0;
+	FString NpcId;
+
+	/** Earliest boundary on top of the heap */
+	bool operator<(const FNPCScheduleBoundary& Other) const { return GameHours < Other.GameHours; }
+};
+
+/** When to prefetch an inactive NPC's appearance ahead of its start boundary */
+struct FNPCPrefetchEntry
+{
+	/** Start boundary minus the prefetch lead */
+	double GameHours = 0.0;
+
+	/** The start boundary it was queued for; stale once the NPC's pending start differs */
+	double StartGameHours = 0.0;
+
+	FString NpcId;
+
+	bool operator<(const FNPCPrefetchEntry& Other) const { return GameHours < Other.GameHours; }
 };
 
 /**
  * Actor that manages spawning and despawning NPCs based on their schedule times.
  * Reads schedule data from FarmGridManager and spawns NPCs when their schedule starts.
+ *
+ * Each NPC's next start or end time is kept in a min-heap keyed on game hours, so a check only
+ * compares the earliest boundary against the clock and touches just the NPCs whose boundary was
+ * crossed. Jumps the heap can't follow (SetTime backwards, skipped days, save restore) re-evaluate
+ * every schedule once.
+ *
+ * With bSimulateOffscreen an active NPC only gets an actor while a player is within
+ * RelevanceRange. Otherwise the spawner walks its patrol abstractly (FNPCOffscreenSim) and
+ * materialises the actor where the simulation has got to when a player comes near, handing the
+ * patrol over to the NPC's schedule component; walking away dematerialises it again.
  */
 UCLASS(BlueprintType, Blueprintable)
 class HOBUNJIHOLLOW_API ANPCScheduleSpawner : public AActor
@@ -56,10 +125,34 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner")
 	TSubclassOf<AActor> DefaultNPCClass;
 
-	/** How often to check schedules (seconds) */
+	/** How often to check the clock against the next schedule boundary (seconds) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner")
 	float ScheduleCheckInterval = 1.0f;
 
+	/** Stream in the appearance of NPCs whose schedule starts within this many game hours (0 = off) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner", meta = (ClampMin = "0"))
+	float PrefetchLeadHours = 1.0f;
+
+	/** Simulate active NPCs without an actor while no player is within RelevanceRange */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner|Offscreen")
+	bool bSimulateOffscreen = true;
+
+	/** Distance from a player pawn at which a simulated NPC gets its actor (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner|Offscreen", meta = (EditCondition = "bSimulateOffscreen", ClampMin = "0"))
+	float RelevanceRange = 8000.0f;
+
+	/** Extra distance beyond RelevanceRange before an actor is removed again (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner|Offscreen", meta = (EditCondition = "bSimulateOffscreen", ClampMin = "0"))
+	float DematerializeMargin = 1000.0f;
+
+	/** Walking speed of simulated NPCs; keep in step with UNPCScheduleComponent::WalkSpeed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner|Offscreen", meta = (EditCondition = "bSimulateOffscreen", ClampMin = "0"))
+	float SimulatedWalkSpeed = 200.0f;
+
+	/** Wait at each waypoint for simulated NPCs (seconds); matches the schedule component's JSON patrols */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner|Offscreen", meta = (EditCondition = "bSimulateOffscreen", ClampMin = "0"))
+	float SimulatedWaitTime = 1.0f;
+
 	/** Whether to enable debug logging */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC Spawner|Debug")
 	bool bDebugLogging = false;
@@ -84,6 +177,18 @@ public:
 	UFUNCTION(BlueprintPure, Category = "NPC Spawner")
 	AActor* GetSpawnedNPC(const FString& NpcId) const;
 
+	/** Check if an NPC is active without an actor */
+	UFUNCTION(BlueprintPure, Category = "NPC Spawner")
+	bool IsNPCSimulated(const FString& NpcId) const;
+
+	/** Where an active NPC is: its actor, or its simulated position */
+	UFUNCTION(BlueprintPure, Category = "NPC Spawner")
+	bool GetNPCLocation(const FString& NpcId, FVector& OutLocation) const;
+
+	/** Number of NPCs currently simulated without an actor */
+	UFUNCTION(BlueprintPure, Category = "NPC Spawner")
+	int32 GetNumSimulatedNPCs() const;
+
 	/** Event when an NPC is spawned */
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnNPCSpawned, const FString&, NpcId, AActor*, SpawnedActor);
 	UPROPERTY(BlueprintAssignable, Category = "NPC Spawner|Events")
@@ -109,18 +214,88 @@ protected:
 
 	float TimeSinceLastCheck = 0.0f;
 
+	/** Pending schedule boundaries, one per NPC with a non-empty range */
+	TArray<FNPCScheduleBoundary> BoundaryHeap;
+
+	/** Pending appearance prefetches, queued as start boundaries are pushed */
+	TArray<FNPCPrefetchEntry> PrefetchHeap;
+
+	/** Prefetched NPCs that haven't reached their start yet; capped at the appearance cache size */
+	int32 NumOutstandingPrefetches = 0;
+
+	/** Game hours at the last schedule update, to spot jumps the heap can't follow */
+	double LastUpdateGameHours = -1.0;
+
+	/** NPCs whose actor was destroyed by something else while scheduled, respawned on the next check */
+	TArray<FString> PendingRespawns;
+
 	/** Load all NPC schedules from grid manager */
 	void LoadSchedules();
 
 	/** Check if current time is within a schedule's active range */
 	bool IsTimeInScheduleRange(float CurrentTime, float StartTime, float EndTime) const;
 
-	/** Update spawn/despawn state for all NPCs based on current time */
+	/** Spawn/despawn NPCs whose schedule boundary has passed, or all of them after a time jump */
 	void UpdateNPCStates();
 
+	/** Re-evaluate every NPC against the current time and rebuild the boundary heap */
+	void RebuildScheduleTimeline();
+
+	/** Evaluate one NPC at the current time, spawn/despawn on change and queue its next boundary */
+	void EvaluateNPC(FScheduledNPCState& State, double NowGameHours);
+
+	/**
+	 * Prefetch appearance assets for inactive NPCs starting within PrefetchLeadHours: each once
+	 * per start, at most the appearance cache's capacity at a time, and not those that will start
+	 * simulated offscreen
+	 */
+	void PrefetchUpcomingNPCs(double NowGameHours);
+
+	/** Next start (inactive NPC) or end (active NPC) strictly after NowGameHours; false if the range is empty */
+	bool GetNextBoundary(const FScheduledNPCState& State, double NowGameHours, double& OutGameHours) const;
+
+	/** Queues a respawn when a scheduled NPC's actor is destroyed by something other than DespawnNPC */
+	UFUNCTION()
+	void HandleSpawnedActorDestroyed(AActor* DestroyedActor);
+
 	/** Spawn an NPC at their spawn location */
 	AActor* SpawnNPC(FScheduledNPCState& State);
 
+	/** Spawn an NPC's actor at Location and configure its components */
+	AActor* SpawnNPCAt(FScheduledNPCState& State, const FVector& Location, const FRotator& Rotation);
+
+	/** Spawn location and facing from the schedule; false if it has no locations */
+	bool GetSpawnTransform(const FScheduledNPCState& State, FVector& OutLocation, FRotator& OutRotation) const;
+
+	/** The schedule started (or its actor was lost): spawn, or simulate if no player is near */
+	void ActivateNPC(FScheduledNPCState& State);
+
+	// ---- Offscreen simulation ----
+
+	/** Player pawn locations, refreshed each schedule check */
+	TArray<FVector> PlayerLocations;
+
+	void GatherPlayerLocations();
+	bool IsNearAnyPlayer(const FVector& Location, float Range) const;
+
+	/** Advance simulated NPCs, and (de)materialise NPCs crossing the relevance range */
+	void UpdateOffscreenNPCs(float DeltaSeconds);
+
+	/** Walk a simulated NPC's patrol forward by DeltaSeconds */
+	void AdvanceSimulation(FNPCOffscreenSim& Sim, float DeltaSeconds) const;
+
+	/** Plan the walk from Sim.Location to its current waypoint */
+	void BeginSimulatedLeg(FNPCOffscreenSim& Sim) const;
+
+	/** Sim.Location on the ground: the walk only tracks X/Y, so Z comes from the grid's tile height there */
+	FVector GetSimulatedGroundLocation(const FNPCOffscreenSim& Sim) const;
+
+	/** Replace the simulation with an actor that carries on from the same point */
+	AActor* MaterializeNPC(FScheduledNPCState& State);
+
+	/** Replace the actor with a simulation that carries on from the same point */
+	void DematerializeNPC(FScheduledNPCState& State);
+
 	/** Despawn an NPC (moves to despawn location first if applicable) */
 	void DespawnNPC(FScheduledNPCState& State);
 
@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "NPCSignificanceManager.h"
+#include "NPCScheduleComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+bool UNPCSignificanceManager::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UNPCSignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UNPCSignificanceManager, STATGROUP_Tickables);
+}
+
+void UNPCSignificanceManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	TimeSinceLastUpdate += DeltaTime;
+	if (TimeSinceLastUpdate >= UpdateInterval)
+	{
+		TimeSinceLastUpdate = 0.0f;
+		UpdateSignificance();
+	}
+}
+
+void UNPCSignificanceManager::RegisterNPC(UNPCScheduleComponent* Component)
+{
+	if (!Component || RegisteredNPCs.Contains(Component))
+	{
+		return;
+	}
+
+	RegisteredNPCs.Add(Component);
+
+	// Bucket it straight away rather than running a frame at full fidelity
+	if (bSignificanceEnabled)
+	{
+		GatherPlayerLocations();
+		const ENPCSignificance Level = Classify(Component->GetSignificance(), GetDistanceToNearestPlayer(Component->GetOwner()->GetActorLocation()));
+		Component->SetSignificance(Level, GetTickInterval(Level));
+	}
+}
+
+void UNPCSignificanceManager::UnregisterNPC(UNPCScheduleComponent* Component)
+{
+	RegisteredNPCs.RemoveSingleSwap(Component);
+}
+
+void UNPCSignificanceManager::UpdateSignificance()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	GatherPlayerLocations();
+
+	for (int32 i = RegisteredNPCs.Num() - 1; i >= 0; --i)
+	{
+		UNPCScheduleComponent* Component = RegisteredNPCs[i];
+		const AActor* Owner = IsValid(Component) ? Component->GetOwner() : nullptr;
+		if (!Owner)
+		{
+			RegisteredNPCs.RemoveAtSwap(i);
+			continue;
+		}
+
+		const ENPCSignificance Level = bSignificanceEnabled
+			? Classify(Component->GetSignificance(), GetDistanceToNearestPlayer(Owner->GetActorLocation()))
+			: ENPCSignificance::Near;
+
+		if (Level != Component->GetSignificance())
+		{
+			Component->SetSignificance(Level, GetTickInterval(Level));
+		}
+	}
+}
+
+void UNPCSignificanceManager::GatherPlayerLocations()
+{
+	PlayerLocations.Reset();
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		if (const APawn* Pawn = PlayerController ? PlayerController->GetPawn() : nullptr)
+		{
+			PlayerLocations.Add(Pawn->GetActorLocation());
+		}
+	}
+}
+
+float UNPCSignificanceManager::GetDistanceToNearestPlayer(const FVector& Location) const
+{
+	// No players (a server before anyone joins) leaves everything Far
+	float MinDistSq = TNumericLimits<float>::Max();
+	for (const FVector& PlayerLocation : PlayerLocations)
+	{
+		MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(PlayerLocation, Location));
+	}
+	return FMath::Sqrt(MinDistSq);
+}
+
+float UNPCSignificanceManager::GetTickInterval(ENPCSignificance Level) const
+{
+	switch (Level)
+	{
+	case ENPCSignificance::Mid: return MidTickInterval;
+	case ENPCSignificance::Far: return FarTickInterval;
+	default: return 0.0f;
+	}
+}
+
+ENPCSignificance UNPCSignificanceManager::Classify(ENPCSignificance Current, float Distance) const
+{
+	// Widen the bucket the NPC is already in
+	const float NearLimit = NearDistance + (Current == ENPCSignificance::Near ? Hysteresis : 0.0f);
+	const float FarLimit = FarDistance - (Current == ENPCSignificance::Far ? Hysteresis : 0.0f);
+
+	if (Distance < NearLimit)
+	{
+		return ENPCSignificance::Near;
+	}
+	return Distance < FarLimit ? ENPCSignificance::Mid : ENPCSignificance::Far;
+}
+
+void UNPCSignificanceManager::LogStats() const
+{
+	int32 Counts[3] = { 0, 0, 0 };
+	for (const UNPCScheduleComponent* Component : RegisteredNPCs)
+	{
+		if (IsValid(Component))
+		{
+			++Counts[(int32)Component->GetSignificance()];
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("NPCSignificance: %d NPCs - %d near, %d mid, %d far (near < %.0f, far > %.0f)"),
+		RegisteredNPCs.Num(), Counts[0], Counts[1], Counts[2], NearDistance, FarDistance);
+}
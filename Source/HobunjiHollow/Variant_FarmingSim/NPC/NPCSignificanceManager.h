@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "NPCSignificanceManager.generated.h"
+
+class UNPCScheduleComponent;
+
+/**
+ * How much simulation fidelity a scheduled NPC gets
+ */
+UENUM(BlueprintType)
+enum class ENPCSignificance : uint8
+{
+	/** Ticks every frame, moves with its AI controller on the navmesh */
+	Near UMETA(DisplayName = "Near"),
+	/** Ticks at MidTickInterval, still moves with its AI controller */
+	Mid UMETA(DisplayName = "Mid"),
+	/** Ticks at FarTickInterval and slides along its path analytically ("on rails"), no AI movement */
+	Far UMETA(DisplayName = "Far")
+};
+
+/**
+ * World subsystem bucketing NPC schedule components by distance to the nearest player pawn and
+ * switching their tick rate and movement mode to match.
+ *
+ * Server only, like the schedule components themselves. Buckets are re-evaluated every
+ * UpdateInterval seconds with a hysteresis band so NPCs on a boundary don't flip every update.
+ */
+UCLASS()
+class HOBUNJIHOLLOW_API UNPCSignificanceManager : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Turn off to run every NPC at full fidelity */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC|Significance")
+	bool bSignificanceEnabled = true;
+
+	/** NPCs closer than this to a player are Near (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC|Significance", meta = (ClampMin = "0"))
+	float NearDistance = 2500.0f;
+
+	/** NPCs further than this from every player are Far (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC|Significance", meta = (ClampMin = "0"))
+	float FarDistance = 6000.0f;
+
+	/** Distance an NPC must move past a boundary before it changes bucket (cm) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC|Significance", meta = (ClampMin = "0"))
+	float Hysteresis = 500.0f;
+
+	/** Schedule component tick interval for Mid NPCs (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC|Significance", meta = (ClampMin = "0"))
+	float MidTickInterval = 0.25f;
+
+	/** Schedule component tick interval for Far NPCs (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC|Significance", meta = (ClampMin = "0"))
+	float FarTickInterval = 1.0f;
+
+	/** How often buckets are re-evaluated (seconds) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "NPC|Significance", meta = (ClampMin = "0"))
+	float UpdateInterval = 0.5f;
+
+	void RegisterNPC(UNPCScheduleComponent* Component);
+	void UnregisterNPC(UNPCScheduleComponent* Component);
+
+	/** Re-bucket every registered NPC now */
+	UFUNCTION(BlueprintCallable, Category = "NPC|Significance")
+	void UpdateSignificance();
+
+	/** Tick interval a component should use at Level */
+	float GetTickInterval(ENPCSignificance Level) const;
+
+	/** Registered NPC count per bucket to the log */
+	UFUNCTION(BlueprintCallable, Category = "NPC|Significance")
+	void LogStats() const;
+
+protected:
+	UPROPERTY()
+	TArray<TObjectPtr<UNPCScheduleComponent>> RegisteredNPCs;
+
+	float TimeSinceLastUpdate = 0.0f;
+
+	/** Player pawn locations, reused between updates */
+	TArray<FVector> PlayerLocations;
+
+	void GatherPlayerLocations();
+	float GetDistanceToNearestPlayer(const FVector& Location) const;
+
+	/** Bucket for an NPC at Distance from the nearest player, currently in Current */
+	ENPCSignificance Classify(ENPCSignificance Current, float Distance) const;
+};
@@ -4,9 +4,110 @@
 #include "Kismet/GameplayStatics.h"
 #include "HAL/PlatformFileManager.h"
 #include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Async/Async.h"
 #include "FarmingWorldSaveGame.h"
 #include "FarmingCharacterSaveGame.h"
 
+namespace
+{
+	const TCHAR* SaveHeaderExtension = TEXT(".savh");
+	constexpr uint32 SaveHeaderMagic = 0x48534856;
+	constexpr int32 SaveHeaderVersion = 1;
+
+	/** Slot name -> info, valid while its LastSaveTime/LastPlayedTime matches the .sav timestamp */
+	FCriticalSection SaveInfoCacheLock;
+	TMap<FString, FWorldSaveInfo> WorldInfoCache;
+	TMap<FString, FCharacterSaveInfo> CharacterInfoCache;
+
+	// Names and timestamps come from the slot, so only the rest goes in the header
+	void SerializeHeaderFields(FArchive& Ar, FWorldSaveInfo& Info)
+	{
+		Ar << Info.OwnerCharacterName;
+		Ar << Info.CurrentDate;
+		Ar << Info.TotalPlayTime;
+		Ar << Info.Money;
+	}
+
+	void SerializeHeaderFields(FArchive& Ar, FCharacterSaveInfo& Info)
+	{
+		uint8 Gender = static_cast<uint8>(Info.Gender);
+		Ar << Info.SpeciesID;
+		Ar << Gender;
+		Ar << Info.TotalPlayTime;
+		Info.Gender = static_cast<ECharacterGender>(Gender);
+	}
+
+	template <typename InfoType>
+	bool ReadSaveHeader(const FString& HeaderPath, const FDateTime& SaveTimestamp, InfoType& OutInfo)
+	{
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *HeaderPath, FILEREAD_Silent))
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Bytes);
+		uint32 Magic = 0;
+		int32 Version = 0;
+		FDateTime HeaderTimestamp;
+		Reader << Magic;
+		Reader << Version;
+		if (Magic != SaveHeaderMagic || Version != SaveHeaderVersion)
+		{
+			return false;
+		}
+
+		Reader << HeaderTimestamp;
+		SerializeHeaderFields(Reader, OutInfo);
+
+		// A different timestamp means the save was written without updating its header
+		return !Reader.IsError() && HeaderTimestamp == SaveTimestamp;
+	}
+
+	template <typename InfoType>
+	void WriteSaveHeader(const FString& HeaderPath, FDateTime SaveTimestamp, InfoType Info)
+	{
+		TArray<uint8> Bytes;
+		FMemoryWriter Writer(Bytes);
+		uint32 Magic = SaveHeaderMagic;
+		int32 Version = SaveHeaderVersion;
+		Writer << Magic;
+		Writer << Version;
+		Writer << SaveTimestamp;
+		SerializeHeaderFields(Writer, Info);
+
+		if (!FFileHelper::SaveArrayToFile(Bytes, *HeaderPath))
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SaveManager: Failed to write save header %s"), *HeaderPath);
+		}
+	}
+
+	FDateTime GetFileTimestamp(const FString& FilePath)
+	{
+		return FPlatformFileManager::Get().GetPlatformFile().GetTimeStamp(*FilePath);
+	}
+
+	void SortWorldSaves(TArray<FWorldSaveInfo>& WorldSaves)
+	{
+		// Sort by last save time (most recent first)
+		WorldSaves.Sort([](const FWorldSaveInfo& A, const FWorldSaveInfo& B) {
+			return A.LastSaveTime > B.LastSaveTime;
+		});
+	}
+
+	void SortCharacterSaves(TArray<FCharacterSaveInfo>& CharacterSaves)
+	{
+		// Sort by last played time (most recent first)
+		CharacterSaves.Sort([](const FCharacterSaveInfo& A, const FCharacterSaveInfo& B) {
+			return A.LastPlayedTime > B.LastPlayedTime;
+		});
+	}
+}
+
 FString USaveManager::GetSaveDirectory()
 {
 	return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("SaveGames"));
@@ -33,6 +134,11 @@ TArray<FString> USaveManager::GetSaveFiles()
 	return SaveFiles;
 }
 
+FString USaveManager::GetSlotFilePath(const FString& SlotName, const TCHAR* Extension)
+{
+	return FPaths::Combine(GetSaveDirectory(), SlotName + Extension);
+}
+
 TArray<FWorldSaveInfo> USaveManager::GetAvailableWorldSaves()
 {
 	TArray<FWorldSaveInfo> WorldSaves;
@@ -53,11 +159,7 @@ TArray<FWorldSaveInfo> USaveManager::GetAvailableWorldSaves()
 		}
 	}
 
-	// Sort by last save time (most recent first)
-	WorldSaves.Sort([](const FWorldSaveInfo& A, const FWorldSaveInfo& B) {
-		return A.LastSaveTime > B.LastSaveTime;
-	});
-
+	SortWorldSaves(WorldSaves);
 	return WorldSaves;
 }
 
@@ -81,65 +183,262 @@ TArray<FCharacterSaveInfo> USaveManager::GetAvailableCharacterSaves()
 		}
 	}
 
-	// Sort by last played time (most recent first)
-	CharacterSaves.Sort([](const FCharacterSaveInfo& A, const FCharacterSaveInfo& B) {
-		return A.LastPlayedTime > B.LastPlayedTime;
+	SortCharacterSaves(CharacterSaves);
+	return CharacterSaves;
+}
+
+void USaveManager::GetAvailableWorldSavesAsync(FOnWorldSavesListed OnComplete)
+{
+	Async(EAsyncExecution::ThreadPool, [OnComplete]()
+	{
+		TArray<FWorldSaveInfo> WorldSaves;
+		TArray<FString> NeedFullLoad;
+
+		for (const FString& FileName : GetSaveFiles())
+		{
+			if (FileName.StartsWith(TEXT("World_")))
+			{
+				FString WorldName = FileName.RightChop(6);
+
+				FWorldSaveInfo Info;
+				if (ReadWorldSaveInfo(WorldName, Info, false))
+				{
+					WorldSaves.Add(Info);
+				}
+				else
+				{
+					NeedFullLoad.Add(MoveTemp(WorldName));
+				}
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [OnComplete, WorldSaves = MoveTemp(WorldSaves), NeedFullLoad = MoveTemp(NeedFullLoad)]() mutable
+		{
+			// Saves without a current header have to be deserialized, which can only happen here
+			for (const FString& WorldName : NeedFullLoad)
+			{
+				FWorldSaveInfo Info;
+				if (ReadWorldSaveInfo(WorldName, Info, true))
+				{
+					WorldSaves.Add(Info);
+				}
+			}
+
+			SortWorldSaves(WorldSaves);
+			OnComplete.ExecuteIfBound(WorldSaves);
+		});
 	});
+}
 
-	return CharacterSaves;
+void USaveManager::GetAvailableCharacterSavesAsync(FOnCharacterSavesListed OnComplete)
+{
+	Async(EAsyncExecution::ThreadPool, [OnComplete]()
+	{
+		TArray<FCharacterSaveInfo> CharacterSaves;
+		TArray<FString> NeedFullLoad;
+
+		for (const FString& FileName : GetSaveFiles())
+		{
+			if (FileName.StartsWith(TEXT("Character_")))
+			{
+				FString CharacterName = FileName.RightChop(10);
+
+				FCharacterSaveInfo Info;
+				if (ReadCharacterSaveInfo(CharacterName, Info, false))
+				{
+					CharacterSaves.Add(Info);
+				}
+				else
+				{
+					NeedFullLoad.Add(MoveTemp(CharacterName));
+				}
+			}
+		}
+
+		AsyncTask(ENamedThreads::GameThread, [OnComplete, CharacterSaves = MoveTemp(CharacterSaves), NeedFullLoad = MoveTemp(NeedFullLoad)]() mutable
+		{
+			for (const FString& CharacterName : NeedFullLoad)
+			{
+				FCharacterSaveInfo Info;
+				if (ReadCharacterSaveInfo(CharacterName, Info, true))
+				{
+					CharacterSaves.Add(Info);
+				}
+			}
+
+			SortCharacterSaves(CharacterSaves);
+			OnComplete.ExecuteIfBound(CharacterSaves);
+		});
+	});
 }
 
 bool USaveManager::GetWorldSaveInfo(const FString& WorldName, FWorldSaveInfo& OutInfo)
+{
+	return ReadWorldSaveInfo(WorldName, OutInfo, true);
+}
+
+bool USaveManager::GetCharacterSaveInfo(const FString& CharacterName, FCharacterSaveInfo& OutInfo)
+{
+	return ReadCharacterSaveInfo(CharacterName, OutInfo, true);
+}
+
+bool USaveManager::ReadWorldSaveInfo(const FString& WorldName, FWorldSaveInfo& OutInfo, bool bAllowFullLoad)
 {
 	FString SlotName = FString::Printf(TEXT("World_%s"), *WorldName);
 
-	if (USaveGame* LoadedGame = UGameplayStatics::LoadGameFromSlot(SlotName, 0))
+	const FDateTime SaveTimestamp = GetFileTimestamp(GetSlotFilePath(SlotName, TEXT(".sav")));
+	if (SaveTimestamp == FDateTime::MinValue())
 	{
-		if (UFarmingWorldSaveGame* WorldSave = Cast<UFarmingWorldSaveGame>(LoadedGame))
-		{
-			OutInfo.WorldName = WorldName;
-			OutInfo.OwnerCharacterName = WorldSave->CurrentCharacterName;
-			OutInfo.Money = WorldSave->Money;
-			OutInfo.TotalPlayTime = WorldSave->PlayTime;
+		return false;
+	}
 
-			// Format date string
-			OutInfo.CurrentDate = FormatGameDate(WorldSave->CurrentDay, WorldSave->CurrentSeason, WorldSave->CurrentYear);
+	{
+		FScopeLock Lock(&SaveInfoCacheLock);
+		const FWorldSaveInfo* Cached = WorldInfoCache.Find(SlotName);
+		if (Cached && Cached->LastSaveTime == SaveTimestamp)
+		{
+			OutInfo = *Cached;
+			return true;
+		}
+	}
 
-			// Get file timestamp
-			FString SaveDir = GetSaveDirectory();
-			FString FilePath = FPaths::Combine(SaveDir, SlotName + TEXT(".sav"));
-			OutInfo.LastSaveTime = FPlatformFileManager::Get().GetPlatformFile().GetTimeStamp(*FilePath);
+	FWorldSaveInfo Info;
+	if (!ReadSaveHeader(GetSlotFilePath(SlotName, SaveHeaderExtension), SaveTimestamp, Info))
+	{
+		if (!bAllowFullLoad)
+		{
+			return false;
+		}
 
-			return true;
+		check(IsInGameThread());
+		UFarmingWorldSaveGame* WorldSave = Cast<UFarmingWorldSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+		if (!WorldSave)
+		{
+			return false;
 		}
+
+		Info = MakeWorldSaveInfo(*WorldSave);
+		WriteSaveHeader(GetSlotFilePath(SlotName, SaveHeaderExtension), SaveTimestamp, Info);
 	}
 
-	return false;
+	Info.WorldName = WorldName;
+	Info.LastSaveTime = SaveTimestamp;
+
+	FScopeLock Lock(&SaveInfoCacheLock);
+	WorldInfoCache.Add(SlotName, Info);
+	OutInfo = MoveTemp(Info);
+	return true;
 }
 
-bool USaveManager::GetCharacterSaveInfo(const FString& CharacterName, FCharacterSaveInfo& OutInfo)
+bool USaveManager::ReadCharacterSaveInfo(const FString& CharacterName, FCharacterSaveInfo& OutInfo, bool bAllowFullLoad)
 {
 	FString SlotName = FString::Printf(TEXT("Character_%s"), *CharacterName);
 
-	if (USaveGame* LoadedGame = UGameplayStatics::LoadGameFromSlot(SlotName, 0))
+	const FDateTime SaveTimestamp = GetFileTimestamp(GetSlotFilePath(SlotName, TEXT(".sav")));
+	if (SaveTimestamp == FDateTime::MinValue())
 	{
-		if (UFarmingCharacterSaveGame* CharSave = Cast<UFarmingCharacterSaveGame>(LoadedGame))
+		return false;
+	}
+
+	{
+		FScopeLock Lock(&SaveInfoCacheLock);
+		const FCharacterSaveInfo* Cached = CharacterInfoCache.Find(SlotName);
+		if (Cached && Cached->LastPlayedTime == SaveTimestamp)
 		{
-			OutInfo.CharacterName = CharacterName;
-			OutInfo.SpeciesID = CharSave->SpeciesID;
-			OutInfo.Gender = CharSave->Gender;
-			OutInfo.TotalPlayTime = CharSave->TotalPlayTime;
+			OutInfo = *Cached;
+			return true;
+		}
+	}
 
-			// Get file timestamp
-			FString SaveDir = GetSaveDirectory();
-			FString FilePath = FPaths::Combine(SaveDir, SlotName + TEXT(".sav"));
-			OutInfo.LastPlayedTime = FPlatformFileManager::Get().GetPlatformFile().GetTimeStamp(*FilePath);
+	FCharacterSaveInfo Info;
+	if (!ReadSaveHeader(GetSlotFilePath(SlotName, SaveHeaderExtension), SaveTimestamp, Info))
+	{
+		if (!bAllowFullLoad)
+		{
+			return false;
+		}
 
-			return true;
+		check(IsInGameThread());
+		UFarmingCharacterSaveGame* CharSave = Cast<UFarmingCharacterSaveGame>(UGameplayStatics::LoadGameFromSlot(SlotName, 0));
+		if (!CharSave)
+		{
+			return false;
 		}
+
+		Info = MakeCharacterSaveInfo(*CharSave);
+		WriteSaveHeader(GetSlotFilePath(SlotName, SaveHeaderExtension), SaveTimestamp, Info);
 	}
 
-	return false;
+	Info.CharacterName = CharacterName;
+	Info.LastPlayedTime = SaveTimestamp;
+
+	FScopeLock Lock(&SaveInfoCacheLock);
+	CharacterInfoCache.Add(SlotName, Info);
+	OutInfo = MoveTemp(Info);
+	return true;
+}
+
+FWorldSaveInfo USaveManager::MakeWorldSaveInfo(const UFarmingWorldSaveGame& WorldSave)
+{
+	FWorldSaveInfo Info;
+	Info.WorldName = WorldSave.WorldName;
+	Info.OwnerCharacterName = WorldSave.CurrentCharacterName;
+	Info.Money = WorldSave.Money;
+	Info.TotalPlayTime = WorldSave.PlayTime;
+	Info.CurrentDate = FormatGameDate(WorldSave.CurrentDay, WorldSave.CurrentSeason, WorldSave.CurrentYear);
+	return Info;
+}
+
+FCharacterSaveInfo USaveManager::MakeCharacterSaveInfo(const UFarmingCharacterSaveGame& CharacterSave)
+{
+	FCharacterSaveInfo Info;
+	Info.CharacterName = CharacterSave.CharacterName;
+	Info.SpeciesID = CharacterSave.SpeciesID;
+	Info.Gender = CharacterSave.Gender;
+	Info.TotalPlayTime = CharacterSave.TotalPlayTime;
+	return Info;
+}
+
+void USaveManager::UpdateWorldSaveHeader(const UFarmingWorldSaveGame* WorldSave)
+{
+	if (!WorldSave)
+	{
+		return;
+	}
+
+	FString SlotName = FString::Printf(TEXT("World_%s"), *WorldSave->WorldName);
+	FWorldSaveInfo Info = MakeWorldSaveInfo(*WorldSave);
+	Info.LastSaveTime = GetFileTimestamp(GetSlotFilePath(SlotName, TEXT(".sav")));
+	if (Info.LastSaveTime == FDateTime::MinValue())
+	{
+		return;
+	}
+
+	WriteSaveHeader(GetSlotFilePath(SlotName, SaveHeaderExtension), Info.LastSaveTime, Info);
+
+	FScopeLock Lock(&SaveInfoCacheLock);
+	WorldInfoCache.Add(SlotName, MoveTemp(Info));
+}
+
+void USaveManager::UpdateCharacterSaveHeader(const UFarmingCharacterSaveGame* CharacterSave)
+{
+	if (!CharacterSave)
+	{
+		return;
+	}
+
+	FString SlotName = FString::Printf(TEXT("Character_%s"), *CharacterSave->CharacterName);
+	FCharacterSaveInfo Info = MakeCharacterSaveInfo(*CharacterSave);
+	Info.LastPlayedTime = GetFileTimestamp(GetSlotFilePath(SlotName, TEXT(".sav")));
+	if (Info.LastPlayedTime == FDateTime::MinValue())
+	{
+		return;
+	}
+
+	WriteSaveHeader(GetSlotFilePath(SlotName, SaveHeaderExtension), Info.LastPlayedTime, Info);
+
+	FScopeLock Lock(&SaveInfoCacheLock);
+	CharacterInfoCache.Add(SlotName, MoveTemp(Info));
 }
 
 bool USaveManager::DoesWorldSaveExist(const FString& WorldName)
@@ -157,12 +456,22 @@ bool USaveManager::DoesCharacterSaveExist(const FString& CharacterName)
 bool USaveManager::DeleteWorldSave(const FString& WorldName)
 {
 	FString SlotName = FString::Printf(TEXT("World_%s"), *WorldName);
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*GetSlotFilePath(SlotName, SaveHeaderExtension));
+	{
+		FScopeLock Lock(&SaveInfoCacheLock);
+		WorldInfoCache.Remove(SlotName);
+	}
 	return UGameplayStatics::DeleteGameInSlot(SlotName, 0);
 }
 
 bool USaveManager::DeleteCharacterSave(const FString& CharacterName)
 {
 	FString SlotName = FString::Printf(TEXT("Character_%s"), *CharacterName);
+	FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*GetSlotFilePath(SlotName, SaveHeaderExtension));
+	{
+		FScopeLock Lock(&SaveInfoCacheLock);
+		CharacterInfoCache.Remove(SlotName);
+	}
 	return UGameplayStatics::DeleteGameInSlot(SlotName, 0);
 }
 
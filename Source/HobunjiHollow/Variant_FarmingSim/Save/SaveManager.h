@@ -7,9 +7,20 @@
 #include "SaveDataStructures.h"
 #include "SaveManager.generated.h"
 
+class UFarmingWorldSaveGame;
+class UFarmingCharacterSaveGame;
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnWorldSavesListed, const TArray<FWorldSaveInfo>&, WorldSaves);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FOnCharacterSavesListed, const TArray<FCharacterSaveInfo>&, CharacterSaves);
+
 /**
  * Utility class for managing and discovering save files
  * Provides functions to list available worlds and characters
+ *
+ * Each save slot gets a small header file next to it (.savh) holding just what the save lists
+ * show, stamped with the .sav file's timestamp. Lists read headers instead of deserializing whole
+ * saves, and keep what they read in a cache checked against the same timestamp. A save without a
+ * matching header (older build, copied in by hand) is loaded fully once and its header rewritten.
  */
 UCLASS()
 class HOBUNJIHOLLOW_API USaveManager : public UBlueprintFunctionLibrary
@@ -25,6 +36,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Save Manager")
 	static TArray<FCharacterSaveInfo> GetAvailableCharacterSaves();
 
+	/** List world saves on a worker thread; OnComplete runs on the game thread */
+	UFUNCTION(BlueprintCallable, Category = "Save Manager")
+	static void GetAvailableWorldSavesAsync(FOnWorldSavesListed OnComplete);
+
+	/** List character saves on a worker thread; OnComplete runs on the game thread */
+	UFUNCTION(BlueprintCallable, Category = "Save Manager")
+	static void GetAvailableCharacterSavesAsync(FOnCharacterSavesListed OnComplete);
+
 	/** Get detailed info about a specific world save */
 	UFUNCTION(BlueprintCallable, Category = "Save Manager")
 	static bool GetWorldSaveInfo(const FString& WorldName, FWorldSaveInfo& OutInfo);
@@ -33,6 +52,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Save Manager")
 	static bool GetCharacterSaveInfo(const FString& CharacterName, FCharacterSaveInfo& OutInfo);
 
+	/** Write the list header for a world save just saved to its slot */
+	static void UpdateWorldSaveHeader(const UFarmingWorldSaveGame* WorldSave);
+
+	/** Write the list header for a character save just saved to its slot */
+	static void UpdateCharacterSaveHeader(const UFarmingCharacterSaveGame* CharacterSave);
+
 	/** Check if a world save exists */
 	UFUNCTION(BlueprintPure, Category = "Save Manager")
 	static bool DoesWorldSaveExist(const FString& WorldName);
@@ -63,4 +88,17 @@ private:
 
 	/** Get all .sav files in the save directory */
 	static TArray<FString> GetSaveFiles();
+
+	/** Path of a slot's file with the given extension (".sav" or the header's) */
+	static FString GetSlotFilePath(const FString& SlotName, const TCHAR* Extension);
+
+	/**
+	 * Save info from the cache or the slot's header. With bAllowFullLoad (game thread only) a
+	 * slot without a current header is deserialized instead and its header rewritten.
+	 */
+	static bool ReadWorldSaveInfo(const FString& WorldName, FWorldSaveInfo& OutInfo, bool bAllowFullLoad);
+	static bool ReadCharacterSaveInfo(const FString& CharacterName, FCharacterSaveInfo& OutInfo, bool bAllowFullLoad);
+
+	static FWorldSaveInfo MakeWorldSaveInfo(const UFarmingWorldSaveGame& WorldSave);
+	static FCharacterSaveInfo MakeCharacterSaveInfo(const UFarmingCharacterSaveGame& CharacterSave);
 };